@@ -121,6 +121,7 @@ class Isolate;
 class LocalEmbedderHeapTracer;
 class NeverReadOnlySpaceObject;
 struct ScriptStreamingData;
+class CodeCacheValidationTask;
 template<typename T> class CustomArguments;
 class PropertyCallbackArguments;
 class FunctionCallbackArguments;
@@ -1422,13 +1423,17 @@ class V8_EXPORT ScriptCompiler {
   /**
    * Source code which can be then compiled to a UnboundScript or Script.
    */
+  class ValidateCodeCacheTask;
+
   class Source {
    public:
-    // Source takes ownership of CachedData.
+    // Source takes ownership of CachedData and of ValidateCodeCacheTask.
     V8_INLINE Source(Local<String> source_string, const ScriptOrigin& origin,
-                     CachedData* cached_data = nullptr);
+                     CachedData* cached_data = nullptr,
+                     ValidateCodeCacheTask* validate_cache_task = nullptr);
     V8_INLINE Source(Local<String> source_string,
-                     CachedData* cached_data = nullptr);
+                     CachedData* cached_data = nullptr,
+                     ValidateCodeCacheTask* validate_cache_task = nullptr);
     V8_INLINE ~Source();
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -1459,6 +1464,9 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+    // Validates {cached_data} on a background thread, see
+    // ScriptCompiler::StartValidatingCodeCache.
+    std::unique_ptr<ValidateCodeCacheTask> validate_cache_task;
   };
 
   /**
@@ -1535,7 +1543,8 @@ class V8_EXPORT ScriptCompiler {
 
   /**
    * A streaming task which the embedder must run on a background thread to
-   * stream scripts into V8. Returned by ScriptCompiler::StartStreamingScript.
+   * stream scripts into V8. Returned by ScriptCompiler::StartStreamingScript
+   * and ScriptCompiler::StartStreamingModule.
    */
   class V8_EXPORT ScriptStreamingTask final {
    public:
@@ -1550,6 +1559,28 @@ class V8_EXPORT ScriptCompiler {
     internal::ScriptStreamingData* data_;
   };
 
+  /**
+   * A task which the embedder can run on a background thread to validate a
+   * code cache: it checks that the data is intact and was produced by this
+   * version of V8 with the same flags, and decodes its space reservations.
+   * The objects themselves are still deserialized on the main thread. Returned
+   * by ScriptCompiler::StartValidatingCodeCache.
+   */
+  class V8_EXPORT ValidateCodeCacheTask final {
+   public:
+    ~ValidateCodeCacheTask();
+
+    void Run();
+
+   private:
+    friend class ScriptCompiler;
+
+    explicit ValidateCodeCacheTask(
+        std::unique_ptr<internal::CodeCacheValidationTask> impl);
+
+    std::unique_ptr<internal::CodeCacheValidationTask> impl_;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kConsumeCodeCache,
@@ -1637,6 +1668,36 @@ class V8_EXPORT ScriptCompiler {
       Local<Context> context, StreamedSource* source,
       Local<String> full_source_string, const ScriptOrigin& origin);
 
+  /**
+   * Like StartStreamingScript, but parses the streamed source as an ES module.
+   * The module must be compiled with the CompileModule overload that takes a
+   * StreamedSource.
+   */
+  static ScriptStreamingTask* StartStreamingModule(Isolate* isolate,
+                                                   StreamedSource* source);
+
+  /**
+   * Compiles a streamed ES module (see StartStreamingModule). The same
+   * restrictions as for compiling streamed scripts apply, and the origin must
+   * have is_module set.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
+      Local<Context> context, StreamedSource* v8_source,
+      Local<String> full_source_string, const ScriptOrigin& origin);
+
+  /**
+   * Returns a task which validates |cached_data| on a background thread. The
+   * embedder is responsible for running the task on a background thread, and
+   * then passes it to the Source of the script together with |cached_data|,
+   * which must stay alive until then. Compiling the Source with
+   * kConsumeCodeCache deserializes the code on the main thread, as without
+   * the task, and sets CachedData::rejected as usual. Only the validation,
+   * which is linear in the size of the cache, moves off the main thread. A
+   * task that did not run validates the data during compilation.
+   */
+  static ValidateCodeCacheTask* StartValidatingCodeCache(
+      Isolate* isolate, const CachedData* cached_data);
+
   /**
    * Return a version tag for CachedData for the current V8 version & flags.
    *
@@ -1709,6 +1770,27 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCacheForFunction(Local<Function> function);
 
+  /**
+   * Creates and returns a type feedback cache for the functions that have
+   * run in the isolate so far. It records the type feedback that can be
+   * carried over to another process and which functions got optimized,
+   * keyed by a hash of the script source and the position of the function.
+   * The CachedData returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateTypeFeedbackCache(Isolate* isolate);
+
+  /**
+   * Loads a type feedback cache produced by CreateTypeFeedbackCache, usually
+   * in a previous run of the same embedder, before any scripts are run.
+   * Functions from the same script sources are then seeded with that
+   * feedback when they first run, and functions that got optimized before
+   * are optimized again early. Returns false and ignores the data if it was
+   * produced by a different V8 version or with different flags, or is
+   * corrupt. Feedback for functions whose source changed is ignored.
+   */
+  static bool ConsumeTypeFeedbackCache(Isolate* isolate,
+                                       const CachedData* cached_data);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options,
@@ -6966,6 +7048,35 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about the compilation cache of an isolate, which keeps the code
+ * of compiled scripts and of the code compiled by eval and the Function
+ * constructor. The eval statistics include the Function constructor.
+ */
+class V8_EXPORT CompilationCacheStatistics {
+ public:
+  CompilationCacheStatistics();
+  size_t script_hits() { return script_hits_; }
+  size_t script_misses() { return script_misses_; }
+  size_t eval_hits() { return eval_hits_; }
+  size_t eval_misses() { return eval_misses_; }
+  /**
+   * The number of bytes of source, function infos and bytecode kept alive by
+   * the eval caches. Each cache is trimmed to at most
+   * --compilation-cache-eval-max-size KB whenever an entry is added.
+   */
+  size_t eval_cache_size() { return eval_cache_size_; }
+
+ private:
+  size_t script_hits_;
+  size_t script_misses_;
+  size_t eval_hits_;
+  size_t eval_misses_;
+  size_t eval_cache_size_;
+
+  friend class Isolate;
+};
+
 /**
  * A JIT code event is issued each time code is added, moved or removed.
  *
@@ -7760,6 +7871,16 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about the hits and misses of the compilation cache since
+   * the isolate was created.
+   *
+   * \param cache_statistics The CompilationCacheStatistics object to fill in.
+   * \returns true on success.
+   */
+  bool GetCompilationCacheStatistics(
+      CompilationCacheStatistics* cache_statistics);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -10098,7 +10219,8 @@ Local<Integer> ScriptOrigin::ScriptID() const { return script_id_; }
 Local<Value> ScriptOrigin::SourceMapUrl() const { return source_map_url_; }
 
 ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
-                               CachedData* data)
+                               CachedData* data,
+                               ValidateCodeCacheTask* validate_cache_task)
     : source_string(string),
       resource_name(origin.ResourceName()),
       resource_line_offset(origin.ResourceLineOffset()),
@@ -10106,11 +10228,14 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       resource_options(origin.Options()),
       source_map_url(origin.SourceMapUrl()),
       host_defined_options(origin.HostDefinedOptions()),
-      cached_data(data) {}
+      cached_data(data),
+      validate_cache_task(validate_cache_task) {}
 
-ScriptCompiler::Source::Source(Local<String> string,
-                               CachedData* data)
-    : source_string(string), cached_data(data) {}
+ScriptCompiler::Source::Source(Local<String> string, CachedData* data,
+                               ValidateCodeCacheTask* validate_cache_task)
+    : source_string(string),
+      cached_data(data),
+      validate_cache_task(validate_cache_task) {}
 
 
 ScriptCompiler::Source::~Source() {
@@ -26,6 +26,7 @@
 #include "src/bootstrapper.h"
 #include "src/builtins/builtins-utils.h"
 #include "src/char-predicates-inl.h"
+#include "src/compilation-cache.h"
 #include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler.h"
 #include "src/contexts.h"
@@ -86,6 +87,7 @@
 #include "src/runtime/runtime.h"
 #include "src/simulator.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/snapshot/feedback-serializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/partial-serializer.h"
 #include "src/snapshot/read-only-serializer.h"
@@ -804,6 +806,12 @@ StartupData SnapshotCreator::CreateBlob(
     data->contexts_.Clear();
   }
 
+  // Optimized code is not serialized, so drop the cached OSR code.
+  for (i::Context context : contexts) {
+    context->set_osr_code_cache(
+        i::ReadOnlyRoots(isolate).empty_weak_fixed_array());
+  }
+
   // Check that values referenced by global/eternal handles are accounted for.
   i::SerializedHandleChecker handle_checker(isolate, &contexts);
   CHECK(handle_checker.CheckGlobalAndEternalHandles());
@@ -2390,11 +2398,21 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
                      InternalEscapableScope);
 
   i::ScriptData* script_data = nullptr;
+  i::CodeCacheValidationTask* validation_task = nullptr;
   if (options == kConsumeCodeCache) {
     DCHECK(source->cached_data);
-    // ScriptData takes care of pointer-aligning the data.
-    script_data = new i::ScriptData(source->cached_data->data,
-                                    source->cached_data->length);
+    if (source->validate_cache_task) {
+      validation_task = source->validate_cache_task->impl_.get();
+      Utils::ApiCheck(
+          validation_task->cached_data() == source->cached_data,
+          "v8::ScriptCompiler::CompileUnboundScript",
+          "The ValidateCodeCacheTask must validate the CachedData of the "
+          "Source");
+    } else {
+      // ScriptData takes care of pointer-aligning the data.
+      script_data = new i::ScriptData(source->cached_data->data,
+                                      source->cached_data->length);
+    }
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -2404,12 +2422,20 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
       isolate, source->resource_name, source->resource_line_offset,
       source->resource_column_offset, source->source_map_url,
       source->host_defined_options);
-  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
-      i::Compiler::GetSharedFunctionInfoForScript(
-          isolate, str, script_details, source->resource_options, nullptr,
-          script_data, options, no_cache_reason, i::NOT_NATIVES_CODE);
-  if (options == kConsumeCodeCache) {
-    source->cached_data->rejected = script_data->rejected();
+  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info;
+  if (validation_task != nullptr) {
+    maybe_function_info =
+        i::Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask(
+            isolate, str, script_details, source->resource_options,
+            validation_task, no_cache_reason, i::NOT_NATIVES_CODE);
+    source->cached_data->rejected = validation_task->rejected();
+  } else {
+    maybe_function_info = i::Compiler::GetSharedFunctionInfoForScript(
+        isolate, str, script_details, source->resource_options, nullptr,
+        script_data, options, no_cache_reason, i::NOT_NATIVES_CODE);
+    if (options == kConsumeCodeCache) {
+      source->cached_data->rejected = script_data->rejected();
+    }
   }
   delete script_data;
   has_pending_exception = !maybe_function_info.ToHandle(&result);
@@ -2557,6 +2583,48 @@ MaybeLocal<Function> ScriptCompiler::CompileFunctionInContext(
 
 void ScriptCompiler::ScriptStreamingTask::Run() { data_->task->Run(); }
 
+ScriptCompiler::ValidateCodeCacheTask::ValidateCodeCacheTask(
+    std::unique_ptr<i::CodeCacheValidationTask> impl)
+    : impl_(std::move(impl)) {}
+
+ScriptCompiler::ValidateCodeCacheTask::~ValidateCodeCacheTask() = default;
+
+void ScriptCompiler::ValidateCodeCacheTask::Run() { impl_->Run(); }
+
+ScriptCompiler::ValidateCodeCacheTask* ScriptCompiler::StartValidatingCodeCache(
+    Isolate* v8_isolate, const CachedData* cached_data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return new ScriptCompiler::ValidateCodeCacheTask(
+      base::make_unique<i::CodeCacheValidationTask>(isolate, cached_data));
+}
+
+namespace {
+
+void CreateStreamingTask(Isolate* v8_isolate,
+                         ScriptCompiler::StreamedSource* source,
+                         bool is_module) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::ScriptStreamingData* data = source->impl();
+  std::unique_ptr<i::BackgroundCompileTask> task =
+      base::make_unique<i::BackgroundCompileTask>(data, isolate, is_module);
+  data->task = std::move(task);
+}
+
+i::MaybeHandle<i::SharedFunctionInfo> CompileStreamedSource(
+    i::Isolate* isolate, ScriptCompiler::StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::Compiler::ScriptDetails script_details = GetScriptDetails(
+      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
+      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
+      origin.HostDefinedOptions());
+  i::ScriptStreamingData* data = v8_source->impl();
+  return i::Compiler::GetSharedFunctionInfoForStreamedScript(
+      isolate, str, script_details, origin.Options(), data);
+}
+
+}  // namespace
+
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
     Isolate* v8_isolate, StreamedSource* source, CompileOptions options) {
   if (!i::FLAG_script_streaming) {
@@ -2565,12 +2633,17 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
   // We don't support other compile options on streaming background compiles.
   // TODO(rmcilroy): remove CompileOptions from the API.
   CHECK(options == ScriptCompiler::kNoCompileOptions);
-  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
-  i::ScriptStreamingData* data = source->impl();
-  std::unique_ptr<i::BackgroundCompileTask> task =
-      base::make_unique<i::BackgroundCompileTask>(data, isolate);
-  data->task = std::move(task);
-  return new ScriptCompiler::ScriptStreamingTask(data);
+  CreateStreamingTask(v8_isolate, source, false);
+  return new ScriptCompiler::ScriptStreamingTask(source->impl());
+}
+
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingModule(
+    Isolate* v8_isolate, StreamedSource* source) {
+  if (!i::FLAG_script_streaming) {
+    return nullptr;
+  }
+  CreateStreamingTask(v8_isolate, source, true);
+  return new ScriptCompiler::ScriptStreamingTask(source->impl());
 }
 
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
@@ -2582,16 +2655,8 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompileStreamedScript");
 
-  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
-  i::Compiler::ScriptDetails script_details = GetScriptDetails(
-      isolate, origin.ResourceName(), origin.ResourceLineOffset(),
-      origin.ResourceColumnOffset(), origin.SourceMapUrl(),
-      origin.HostDefinedOptions());
-  i::ScriptStreamingData* data = v8_source->impl();
-
   i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
-      i::Compiler::GetSharedFunctionInfoForStreamedScript(
-          isolate, str, script_details, origin.Options(), data);
+      CompileStreamedSource(isolate, v8_source, full_source_string, origin);
 
   i::Handle<i::SharedFunctionInfo> result;
   has_pending_exception = !maybe_function_info.ToHandle(&result);
@@ -2606,6 +2671,29 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   RETURN_ESCAPED(bound);
 }
 
+MaybeLocal<Module> ScriptCompiler::CompileModule(
+    Local<Context> context, StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Module);
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.ScriptCompiler");
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileStreamedModule");
+
+  Utils::ApiCheck(origin.Options().IsModule(),
+                  "v8::ScriptCompiler::CompileModule",
+                  "Invalid ScriptOrigin: is_module must be true");
+  i::MaybeHandle<i::SharedFunctionInfo> maybe_function_info =
+      CompileStreamedSource(isolate, v8_source, full_source_string, origin);
+
+  i::Handle<i::SharedFunctionInfo> result;
+  has_pending_exception = !maybe_function_info.ToHandle(&result);
+  if (has_pending_exception) isolate->ReportPendingMessages();
+
+  RETURN_ON_FAILED_EXECUTION(Module);
+
+  RETURN_ESCAPED(ToApiHandle<Module>(isolate->factory()->NewModule(result)));
+}
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -2641,6 +2729,28 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheForFunction(
   return i::CodeSerializer::Serialize(shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateTypeFeedbackCache(
+    Isolate* v8_isolate) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  return i::FeedbackSerializer::Serialize(isolate);
+}
+
+// static
+bool ScriptCompiler::ConsumeTypeFeedbackCache(Isolate* v8_isolate,
+                                              const CachedData* cached_data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  i::PersistedFeedback::SanityCheckResult rejection_result;
+  std::unique_ptr<i::PersistedFeedback> feedback =
+      i::PersistedFeedback::Deserialize(cached_data->data, cached_data->length,
+                                        &rejection_result);
+  if (!feedback) return false;
+  isolate->set_persisted_feedback(std::move(feedback));
+  return true;
+}
+
 MaybeLocal<Script> Script::Compile(Local<Context> context, Local<String> source,
                                    ScriptOrigin* origin) {
   if (origin) {
@@ -5877,6 +5987,13 @@ HeapCodeStatistics::HeapCodeStatistics()
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0) {}
 
+CompilationCacheStatistics::CompilationCacheStatistics()
+    : script_hits_(0),
+      script_misses_(0),
+      eval_hits_(0),
+      eval_misses_(0),
+      eval_cache_size_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -8482,6 +8599,20 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetCompilationCacheStatistics(
+    CompilationCacheStatistics* cache_statistics) {
+  if (!cache_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::CompilationCache* compilation_cache = isolate->compilation_cache();
+  cache_statistics->script_hits_ = compilation_cache->script_hits();
+  cache_statistics->script_misses_ = compilation_cache->script_misses();
+  cache_statistics->eval_hits_ = compilation_cache->eval_hits();
+  cache_statistics->eval_misses_ = compilation_cache->eval_misses();
+  cache_statistics->eval_cache_size_ = compilation_cache->EvalSize();
+  return true;
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -9747,6 +9878,33 @@ bool debug::SetFunctionBreakpoint(v8::Local<v8::Function> function,
                                                     condition_string, id);
 }
 
+std::vector<debug::DeoptHistoryEntry> debug::GetDeoptHistory(
+    v8::Local<v8::Function> function) {
+  std::vector<debug::DeoptHistoryEntry> result;
+  i::Handle<i::JSReceiver> callable = Utils::OpenHandle(*function);
+  if (!callable->IsJSFunction()) return result;
+  i::JSFunction func = i::JSFunction::cast(*callable);
+  if (!func->has_feedback_vector()) return result;
+  i::Object history = func->feedback_vector()->deopt_history();
+  if (!history->IsFixedArray()) return result;
+  i::FixedArray entries = i::FixedArray::cast(history);
+  for (int i = 0; i < entries->length();
+       i += i::FeedbackVector::kDeoptHistoryEntrySize) {
+    auto reason = static_cast<i::DeoptimizeReason>(i::Smi::ToInt(
+        entries->get(i + i::FeedbackVector::kDeoptHistoryReasonIndex)));
+    auto kind = static_cast<i::DeoptimizeKind>(i::Smi::ToInt(
+        entries->get(i + i::FeedbackVector::kDeoptHistoryKindIndex)));
+    result.push_back(
+        {i::Smi::ToInt(entries->get(
+             i + i::FeedbackVector::kDeoptHistoryBytecodeOffsetIndex)),
+         i::DeoptimizeReasonToString(reason),
+         i::Deoptimizer::MessageFor(kind),
+         i::Smi::ToInt(
+             entries->get(i + i::FeedbackVector::kDeoptHistoryCountIndex))});
+  }
+  return result;
+}
+
 debug::PostponeInterruptsScope::PostponeInterruptsScope(v8::Isolate* isolate)
     : scope_(
           new i::PostponeInterruptsScope(reinterpret_cast<i::Isolate*>(isolate),
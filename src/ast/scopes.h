@@ -351,6 +351,11 @@ class V8_EXPORT_PRIVATE Scope : public NON_EXPORTED_BASE(ZoneObject) {
   bool is_declaration_scope() const { return is_declaration_scope_; }
 
   bool inner_scope_calls_eval() const { return inner_scope_calls_eval_; }
+  // Whether references this scope could not resolve are kept, e.g. private
+  // names that AnalyzePartially keeps so that resolving them fails later.
+  bool has_unresolved_references() const {
+    return !unresolved_list_.is_empty();
+  }
   bool IsAsmModule() const;
   // Returns true if this scope or any inner scopes that might be eagerly
   // compiled are asm modules.
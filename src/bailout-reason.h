@@ -106,6 +106,7 @@ namespace internal {
   V(kNotEnoughVirtualRegistersRegalloc,                                     \
     "Not enough virtual registers (regalloc)")                              \
   V(kOptimizationDisabled, "Optimization disabled")                         \
+  V(kZoneBudgetExceeded, "Optimization exceeded the zone memory budget")    \
   V(kNeverOptimize, "Optimization is always disabled")
 
 #define ERROR_MESSAGES_CONSTANTS(C, T) C,
@@ -192,7 +192,12 @@ class V8_BASE_EXPORT OS {
     virtual void* memory() const = 0;
     virtual size_t size() const = 0;
 
-    static MemoryMappedFile* open(const char* name);
+    enum class FileMode { kReadOnly, kReadWrite };
+
+    // Maps an existing file. Memory of files opened with kReadOnly must not
+    // be written.
+    static MemoryMappedFile* open(const char* name,
+                                  FileMode mode = FileMode::kReadWrite);
     static MemoryMappedFile* create(const char* name, size_t size,
                                     void* initial);
   };
@@ -1413,6 +1413,8 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
   Handle<ScriptContextTable> script_context_table =
       factory->NewScriptContextTable();
   native_context()->set_script_context_table(*script_context_table);
+  native_context()->set_osr_code_cache(
+      ReadOnlyRoots(isolate()).empty_weak_fixed_array());
   InstallGlobalThisBinding();
 
   {  // --- O b j e c t ---
@@ -112,7 +112,9 @@ namespace internal {
   TFC(StringLessThan, Compare, 1)                                              \
   TFC(StringLessThanOrEqual, Compare, 1)                                       \
   TFS(StringRepeat, kString, kCount)                                           \
+  TFS(StringSplit, kString, kSeparator)                                        \
   TFC(StringSubstring, StringSubstring, 1)                                     \
+  TFS(StringTrimWhitespace, kString)                                           \
                                                                                \
   /* OrderedHashTable helpers */                                               \
   TFS(OrderedHashTableHealIndex, kTable, kIndex)                               \
@@ -669,6 +671,7 @@ namespace internal {
                                                                                \
   /* Map */                                                                    \
   TFS(FindOrderedHashMapEntry, kTable, kKey)                                   \
+  TFS(FindOrderedHashSetEntry, kTable, kKey)                                   \
   TFJ(MapConstructor, SharedFunctionInfo::kDontAdaptArgumentsSentinel)         \
   TFJ(MapPrototypeSet, 2, kReceiver, kKey, kValue)                             \
   TFJ(MapPrototypeDelete, 1, kReceiver, kKey)                                  \
@@ -127,14 +127,19 @@ void LazyBuiltinsAssembler::CompileLazy(TNode<JSFunction> function) {
       CAST(LoadObjectField(function, JSFunction::kSharedFunctionInfoOffset));
   TNode<Code> sfi_code = GetSharedFunctionInfoCode(shared, &compile_function);
 
-  // Compile function if we don't have a valid feedback vector.
+  // A compiled function without a feedback vector either runs in lite mode or
+  // allocates its vector lazily from the budget interrupt. Either way there
+  // is no optimized code to look for, so run the SFI's code directly.
+  Label install_sfi_code(this);
   TNode<FeedbackVector> feedback_vector =
-      LoadFeedbackVector(function, &compile_function);
+      LoadFeedbackVector(function, &install_sfi_code);
 
   // Is there an optimization marker or optimized code in the feedback vector?
   MaybeTailCallOptimizedCodeSlot(function, feedback_vector);
+  Goto(&install_sfi_code);
 
   // If not, install the SFI's code entry and jump to that.
+  BIND(&install_sfi_code);
   CSA_ASSERT(this, WordNotEqual(sfi_code, HeapConstant(BUILTIN_CODE(
                                               isolate(), CompileLazy))));
   StoreObjectField(function, JSFunction::kCodeOffset, sfi_code);
@@ -1895,25 +1895,49 @@ TF_BUILTIN(StringPrototypeSplit, StringBuiltinsAssembler) {
     BIND(&next);
   }
 
+  args.PopAndReturn(
+      SplitString(context, subject_string, CAST(separator_string),
+                  limit_number));
+
+  BIND(&return_empty_array);
+  {
+    const ElementsKind kind = PACKED_ELEMENTS;
+    Node* const native_context = LoadNativeContext(context);
+    TNode<Map> array_map = LoadJSArrayElementsMap(kind, native_context);
+
+    TNode<Smi> length = smi_zero;
+    TNode<IntPtrT> capacity = IntPtrConstant(0);
+    TNode<JSArray> result = AllocateJSArray(kind, array_map, capacity, length);
+
+    args.PopAndReturn(result);
+  }
+}
+
+TNode<JSArray> StringBuiltinsAssembler::SplitString(TNode<Context> context,
+                                                    TNode<String> subject,
+                                                    TNode<String> separator,
+                                                    TNode<Number> limit) {
+  Label return_empty_array(this), out(this);
+  TVARIABLE(JSArray, var_result);
+
   // If the separator string is empty then return the elements in the subject.
   {
     Label next(this);
-    GotoIfNot(SmiEqual(LoadStringLengthAsSmi(separator_string), smi_zero),
+    GotoIfNot(SmiEqual(LoadStringLengthAsSmi(separator), SmiConstant(0)),
               &next);
 
-    TNode<Smi> subject_length = LoadStringLengthAsSmi(subject_string);
-    GotoIf(SmiEqual(subject_length, smi_zero), &return_empty_array);
+    TNode<Smi> subject_length = LoadStringLengthAsSmi(subject);
+    GotoIf(SmiEqual(subject_length, SmiConstant(0)), &return_empty_array);
 
-    args.PopAndReturn(
-        StringToArray(context, subject_string, subject_length, limit_number));
+    var_result = StringToArray(context, subject, subject_length, limit);
+    Goto(&out);
 
     BIND(&next);
   }
 
-  Node* const result =
-      CallRuntime(Runtime::kStringSplit, context, subject_string,
-                  separator_string, limit_number);
-  args.PopAndReturn(result);
+  var_result = CAST(
+      CallRuntime(Runtime::kStringSplit, context, subject, separator, limit));
+  Goto(&out);
 
   BIND(&return_empty_array);
   {
@@ -1921,12 +1945,24 @@ TF_BUILTIN(StringPrototypeSplit, StringBuiltinsAssembler) {
     Node* const native_context = LoadNativeContext(context);
     TNode<Map> array_map = LoadJSArrayElementsMap(kind, native_context);
 
-    TNode<Smi> length = smi_zero;
-    TNode<IntPtrT> capacity = IntPtrConstant(0);
-    TNode<JSArray> result = AllocateJSArray(kind, array_map, capacity, length);
-
-    args.PopAndReturn(result);
+    var_result =
+        AllocateJSArray(kind, array_map, IntPtrConstant(0), SmiConstant(0));
+    Goto(&out);
   }
+
+  BIND(&out);
+  return var_result.value();
+}
+
+// Splits the String {string} at every occurrence of the String {separator};
+// used by TurboFan to lower String.prototype.split once the separator is
+// known to be a String and String.prototype has no @@split method.
+TF_BUILTIN(StringSplit, StringBuiltinsAssembler) {
+  TNode<String> string = CAST(Parameter(Descriptor::kString));
+  TNode<String> separator = CAST(Parameter(Descriptor::kSeparator));
+  TNode<Context> context = CAST(Parameter(Descriptor::kContext));
+
+  Return(SplitString(context, string, separator, NumberConstant(kMaxUInt32)));
 }
 
 // ES6 #sec-string.prototype.substr
@@ -2167,16 +2203,33 @@ TF_BUILTIN(StringPrototypeTrimEnd, StringTrimAssembler) {
   Generate(String::kTrimEnd, "String.prototype.trimRight", argc, context);
 }
 
+// Trims whitespace from both ends of the String {string}; used by TurboFan
+// to lower String.prototype.trim once the receiver is known to be a String.
+TF_BUILTIN(StringTrimWhitespace, StringTrimAssembler) {
+  TNode<String> string = CAST(Parameter(Descriptor::kString));
+  TNode<Context> context = CAST(Parameter(Descriptor::kContext));
+
+  Return(TrimString(context, string, String::kTrim));
+}
+
 void StringTrimAssembler::Generate(String::TrimMode mode,
                                    const char* method_name, TNode<IntPtrT> argc,
                                    TNode<Context> context) {
-  Label return_emptystring(this), if_runtime(this);
-
   CodeStubArguments arguments(this, argc);
   Node* const receiver = arguments.GetReceiver();
 
   // Check that {receiver} is coercible to Object and convert it to a String.
   TNode<String> const string = ToThisString(context, receiver, method_name);
+
+  arguments.PopAndReturn(TrimString(context, string, mode));
+}
+
+TNode<String> StringTrimAssembler::TrimString(TNode<Context> context,
+                                              TNode<String> string,
+                                              String::TrimMode mode) {
+  Label return_emptystring(this), if_runtime(this), out(this);
+  TVARIABLE(String, var_result);
+
   TNode<IntPtrT> const string_length = LoadStringLengthAsWord(string);
 
   ToDirectStringAssembler to_direct(state(), string);
@@ -2200,16 +2253,21 @@ void StringTrimAssembler::Generate(String::TrimMode mode,
         IntPtrConstant(-1), -1, &return_emptystring);
   }
 
-  arguments.PopAndReturn(
-      SubString(string, var_start.value(),
-                IntPtrAdd(var_end.value(), IntPtrConstant(1))));
+  var_result = SubString(string, var_start.value(),
+                         IntPtrAdd(var_end.value(), IntPtrConstant(1)));
+  Goto(&out);
 
   BIND(&if_runtime);
-  arguments.PopAndReturn(
+  var_result = CAST(
       CallRuntime(Runtime::kStringTrim, context, string, SmiConstant(mode)));
+  Goto(&out);
 
   BIND(&return_emptystring);
-  arguments.PopAndReturn(EmptyStringConstant());
+  var_result = EmptyStringConstant();
+  Goto(&out);
+
+  BIND(&out);
+  return var_result.value();
 }
 
 void StringTrimAssembler::ScanForNonWhiteSpaceOrLineTerminator(
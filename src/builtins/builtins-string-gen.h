@@ -88,6 +88,12 @@ class StringBuiltinsAssembler : public CodeStubAssembler {
                                TNode<Smi> subject_length,
                                TNode<Number> limit_number);
 
+  // Splits {subject} at the String {separator} into at most {limit} parts,
+  // i.e. the tail of String.prototype.split after the @@split lookup and the
+  // argument conversions.
+  TNode<JSArray> SplitString(TNode<Context> context, TNode<String> subject,
+                             TNode<String> separator, TNode<Number> limit);
+
   void RequireObjectCoercible(Node* const context, Node* const value,
                               const char* method_name);
 
@@ -137,6 +143,9 @@ class StringTrimAssembler : public StringBuiltinsAssembler {
   void GotoIfNotWhiteSpaceOrLineTerminator(Node* const char_code,
                                            Label* const if_not_whitespace);
 
+  TNode<String> TrimString(TNode<Context> context, TNode<String> string,
+                           String::TrimMode mode);
+
  protected:
   void Generate(String::TrimMode mode, const char* method, TNode<IntPtrT> argc,
                 TNode<Context> context);
@@ -163,9 +163,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
     DCHECK(HasOrigin(function_info, name, line_offset, column_offset,
                      resource_options));
 #endif
+    hits_++;
     isolate()->counters()->compilation_cache_hits()->Increment();
     LOG(isolate(), CompilationCacheEvent("hit", "script", *function_info));
   } else {
+    misses_++;
     isolate()->counters()->compilation_cache_misses()->Increment();
   }
   return result;
@@ -194,12 +196,17 @@ InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
   const int generation = 0;
   DCHECK_EQ(generations(), 1);
   Handle<CompilationCacheTable> table = GetTable(generation);
-  result = CompilationCacheTable::LookupEval(
-      table, source, outer_info, native_context, language_mode, position);
+  result = CompilationCacheTable::LookupEval(table, source, outer_info,
+                                             native_context, language_mode,
+                                             position, NextUseTick(*table));
   if (result.has_shared()) {
+    hits_++;
     isolate()->counters()->compilation_cache_hits()->Increment();
+    isolate()->counters()->compilation_cache_eval_hits()->Increment();
   } else {
+    misses_++;
     isolate()->counters()->compilation_cache_misses()->Increment();
+    isolate()->counters()->compilation_cache_eval_misses()->Increment();
   }
   return result;
 }
@@ -212,12 +219,48 @@ void CompilationCacheEval::Put(Handle<String> source,
                                int position) {
   HandleScope scope(isolate());
   Handle<CompilationCacheTable> table = GetFirstTable();
-  table =
-      CompilationCacheTable::PutEval(table, source, outer_info, function_info,
-                                     native_context, feedback_cell, position);
+  // Make room before adding the entry, so that it is not evicted right away.
+  source = String::Flatten(isolate(), source);
+  MakeRoom(table,
+           CompilationCacheTable::EvalEntrySize(*source, *function_info));
+  table = CompilationCacheTable::PutEval(
+      table, source, outer_info, function_info, native_context, feedback_cell,
+      position, NextUseTick(*table));
   SetFirstTable(table);
 }
 
+void CompilationCacheEval::Age() {
+  Object table = first_table();
+  if (table->IsUndefined(isolate())) return;
+  size_ = CompilationCacheTable::cast(table)->AgeEval();
+}
+
+size_t CompilationCacheEval::Size() {
+  Object table = first_table();
+  if (table->IsUndefined(isolate())) return 0;
+  size_ = CompilationCacheTable::cast(table)->EvalSize();
+  return size_;
+}
+
+void CompilationCacheEval::MakeRoom(Handle<CompilationCacheTable> table,
+                                    size_t size) {
+  size_ += size;
+  size_t max_size =
+      static_cast<size_t>(FLAG_compilation_cache_eval_max_size) * KB;
+  if (size_ <= max_size) return;
+  // Evict down to three quarters of the maximum size, so that the table is
+  // not walked again for each of the next entries.
+  int evicted;
+  size_ = table->TrimEval(max_size - max_size / 4, &evicted) + size;
+  isolate()->counters()->compilation_cache_eval_evictions()->Increment(
+      evicted);
+}
+
+int CompilationCacheEval::NextUseTick(CompilationCacheTable table) {
+  if (use_tick_ == Smi::kMaxValue) use_tick_ = table->ResetEvalUseTicks();
+  return use_tick_++;
+}
+
 MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(
     Handle<String> source,
     JSRegExp::Flags flags) {
@@ -363,10 +406,15 @@ void CompilationCache::Iterate(RootVisitor* v) {
   }
 }
 
+size_t CompilationCache::EvalSize() {
+  return eval_global_.Size() + eval_contextual_.Size();
+}
+
 void CompilationCache::MarkCompactPrologue() {
-  for (int i = 0; i < kSubCacheCount; i++) {
-    subcaches_[i]->Age();
-  }
+  script_.Age();
+  eval_global_.Age();
+  eval_contextual_.Age();
+  reg_exp_.Age();
 }
 
 void CompilationCache::Enable() {
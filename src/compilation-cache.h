@@ -65,6 +65,9 @@ class CompilationSubCache {
  protected:
   Isolate* isolate() { return isolate_; }
 
+  // The table of the first generation without allocating it, or undefined.
+  Object first_table() const { return tables_[kFirstGeneration]; }
+
  private:
   Isolate* isolate_;
   int generations_;  // Number of generations.
@@ -90,11 +93,17 @@ class CompilationCacheScript : public CompilationSubCache {
            LanguageMode language_mode,
            Handle<SharedFunctionInfo> function_info);
 
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
  private:
   bool HasOrigin(Handle<SharedFunctionInfo> function_info,
                  MaybeHandle<Object> name, int line_offset, int column_offset,
                  ScriptOriginOptions resource_options);
 
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheScript);
 };
 
@@ -111,6 +120,9 @@ class CompilationCacheScript : public CompilationSubCache {
 //    More specifically these are the CompileString, DebugEvaluate and
 //    DebugEvaluateGlobal runtime functions.
 // 4. The start position of the calling scope.
+// Instead of aging by generations, the cache evicts the least recently used
+// entries once they keep more than --compilation-cache-eval-max-size KB of
+// source, function infos and bytecode alive.
 class CompilationCacheEval: public CompilationSubCache {
  public:
   explicit CompilationCacheEval(Isolate* isolate)
@@ -126,7 +138,33 @@ class CompilationCacheEval: public CompilationSubCache {
            Handle<Context> native_context, Handle<FeedbackCell> feedback_cell,
            int position);
 
+  // Removes the entries whose bytecode was flushed, and ages the hashes of
+  // sources that were compiled only once. Hides CompilationSubCache::Age.
+  void Age();
+
+  // The number of bytes of source, function infos and bytecode that the
+  // entries keep alive.
+  size_t Size();
+
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
  private:
+  // Evicts entries from {table} if adding an entry of {size} bytes would
+  // exceed the maximum size.
+  void MakeRoom(Handle<CompilationCacheTable> table, size_t size);
+
+  // Returns the tick that marks a use of an entry of {table}.
+  int NextUseTick(CompilationCacheTable table);
+
+  // An estimate of the size of the entries, which is recomputed at every
+  // mark-compact and whenever it exceeds the maximum size. Inner functions
+  // that are compiled in between are not accounted for until then.
+  size_t size_ = 0;
+  int use_tick_ = 0;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationCacheEval);
 };
 
@@ -211,6 +249,18 @@ class CompilationCache {
   void Enable();
   void Disable();
 
+  // Statistics for v8::Isolate::GetCompilationCacheStatistics. The eval
+  // statistics include code compiled by the Function constructor.
+  size_t script_hits() const { return script_.hits(); }
+  size_t script_misses() const { return script_.misses(); }
+  size_t eval_hits() const {
+    return eval_global_.hits() + eval_contextual_.hits();
+  }
+  size_t eval_misses() const {
+    return eval_global_.misses() + eval_contextual_.misses();
+  }
+  size_t EvalSize();
+
  private:
   explicit CompilationCache(Isolate* isolate);
   ~CompilationCache() = default;
@@ -9,6 +9,7 @@
 #include "src/cancelable-task.h"
 #include "src/compiler.h"
 #include "src/counters.h"
+#include "src/interpreter/bytecode-array-accessor.h"
 #include "src/isolate.h"
 #include "src/log.h"
 #include "src/objects-inl.h"
@@ -23,7 +24,8 @@ namespace {
 
 void DisposeCompilationJob(OptimizedCompilationJob* job,
                            bool restore_function_code) {
-  if (restore_function_code) {
+  // OSR jobs never replace the code of the function.
+  if (restore_function_code && !job->compilation_info()->is_osr()) {
     Handle<JSFunction> function = job->compilation_info()->closure();
     function->set_code(function->shared()->GetCode());
     if (function->IsInOptimizationQueue()) {
@@ -103,6 +105,12 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 #endif
   DCHECK_EQ(0, input_queue_length_);
   DeleteArray(input_queue_);
+#ifdef DEBUG
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    DCHECK_NULL(osr_buffer_[i].job);
+  }
+#endif
+  DeleteArray(osr_buffer_);
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
@@ -116,6 +124,7 @@ OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
   if (check_if_flushing) {
     if (mode_ == FLUSH) {
       AllowHandleDereference allow_handle_dereference;
+      RemoveFromOsrBuffer(job);
       DisposeCompilationJob(job, true);
       return nullptr;
     }
@@ -130,6 +139,17 @@ void OptimizingCompileDispatcher::CompileNext(OptimizedCompilationJob* job) {
   CompilationJob::Status status = job->ExecuteJob();
   USE(status);  // Prevent an unused-variable error.
 
+  if (job->compilation_info()->is_osr()) {
+    // OSR jobs stay in the OSR buffer; the main thread re-arms the back
+    // edges of the function when handling the install code request.
+    base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+    for (int i = 0; i < osr_buffer_capacity_; i++) {
+      if (osr_buffer_[i].job == job) osr_buffer_[i].ready = true;
+    }
+    isolate_->stack_guard()->RequestInstallCode();
+    return;
+  }
+
   // The function may have already been optimized by OSR.  Simply continue.
   // Use a mutex to make sure that functions marked for install
   // are always also queued.
@@ -152,6 +172,17 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
   }
 }
 
+void OptimizingCompileDispatcher::FlushOsrBuffer() {
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    // Jobs that are still being compiled are flushed once they are ready.
+    if (osr_buffer_[i].ready) {
+      DisposeCompilationJob(osr_buffer_[i].job, false);
+      osr_buffer_[i] = OsrBufferEntry();
+    }
+  }
+}
+
 void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
@@ -161,9 +192,11 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
       DCHECK_NOT_NULL(job);
       input_queue_shift_ = InputQueueIndex(1);
       input_queue_length_--;
+      RemoveFromOsrBuffer(job);
       DisposeCompilationJob(job, true);
     }
     FlushOutputQueue(true);
+    FlushOsrBuffer();
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Flushed concurrent recompilation queues (not blocking).\n");
     }
@@ -177,6 +210,7 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
     mode_ = COMPILE;
   }
   FlushOutputQueue(true);
+  FlushOsrBuffer();
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Flushed concurrent recompilation queues.\n");
   }
@@ -199,11 +233,14 @@ void OptimizingCompileDispatcher::Stop() {
   } else {
     FlushOutputQueue(false);
   }
+  FlushOsrBuffer();
 }
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
 
+  ArmReadyOSRCandidates();
+
   for (;;) {
     OptimizedCompilationJob* job = nullptr;
     {
@@ -227,9 +264,143 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+void OptimizingCompileDispatcher::ArmReadyOSRCandidates() {
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    OsrBufferEntry& entry = osr_buffer_[i];
+    if (!entry.ready) continue;
+    OptimizedCompilationInfo* info = entry.job->compilation_info();
+    if (!info->closure()->shared()->HasBytecodeArray()) {
+      // The bytecode was flushed, so the interpreter cannot be running the
+      // loop anymore.
+      DisposeCompilationJob(entry.job, false);
+      entry = OsrBufferEntry();
+      continue;
+    }
+
+    // Arm the back edge that requested the OSR job (and the back edges of
+    // the loops enclosing it), so that the interpreter calls back into
+    // Runtime_CompileForOnStackReplacement the next time it gets there.
+    Handle<BytecodeArray> bytecode(
+        info->closure()->shared()->GetBytecodeArray(), isolate_);
+    interpreter::BytecodeArrayAccessor accessor(bytecode,
+                                                info->osr_offset().ToInt());
+    DCHECK_EQ(interpreter::Bytecode::kJumpLoop, accessor.current_bytecode());
+    int level = Min(accessor.GetImmediateOperand(1) + 1,
+                    AbstractCode::kMaxLoopNestingMarker);
+    if (bytecode->osr_loop_nesting_level() >= level) continue;
+    if (entry.arm_count == kMaxOsrArmCount) {
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Discarded ready job of ");
+        info->closure()->PrintName();
+        PrintF(" at AST id %d that was not picked up]\n",
+               info->osr_offset().ToInt());
+      }
+      DisposeCompilationJob(entry.job, false);
+      entry = OsrBufferEntry();
+      continue;
+    }
+    entry.arm_count++;
+    if (FLAG_trace_osr) {
+      PrintF("[OSR - Arming back edges for ready job of ");
+      info->closure()->PrintName();
+      PrintF(" at AST id %d]\n", info->osr_offset().ToInt());
+    }
+    bytecode->set_osr_loop_nesting_level(
+        Max(bytecode->osr_loop_nesting_level(), level));
+  }
+}
+
+OptimizedCompilationJob* OptimizingCompileDispatcher::FindReadyOSRCandidate(
+    Handle<JSFunction> function, BailoutId osr_offset) {
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    OsrBufferEntry& entry = osr_buffer_[i];
+    if (entry.ready &&
+        *entry.job->compilation_info()->closure() == *function &&
+        entry.job->compilation_info()->osr_offset() == osr_offset) {
+      OptimizedCompilationJob* job = entry.job;
+      entry = OsrBufferEntry();
+      return job;
+    }
+  }
+  return nullptr;
+}
+
+bool OptimizingCompileDispatcher::IsQueuedForOSR(Handle<JSFunction> function,
+                                                 BailoutId osr_offset) {
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    OsrBufferEntry& entry = osr_buffer_[i];
+    if (entry.job != nullptr && !entry.ready &&
+        *entry.job->compilation_info()->closure() == *function &&
+        entry.job->compilation_info()->osr_offset() == osr_offset) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool OptimizingCompileDispatcher::IsOsrBufferAvailable() {
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    if (osr_buffer_[i].job == nullptr || osr_buffer_[i].ready) return true;
+  }
+  return false;
+}
+
+bool OptimizingCompileDispatcher::AddToOsrBuffer(OptimizedCompilationJob* job) {
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  // Find the next slot that is empty or holds a stale finished job. Jobs
+  // that are still being compiled can occupy every slot, and only a worker
+  // thread holding the mutex can finish them, so give up after one round.
+  int probes = 0;
+  while (osr_buffer_[osr_buffer_cursor_].job != nullptr &&
+         !osr_buffer_[osr_buffer_cursor_].ready) {
+    if (++probes == osr_buffer_capacity_) return false;
+    osr_buffer_cursor_ = (osr_buffer_cursor_ + 1) % osr_buffer_capacity_;
+  }
+
+  // Evict the stale job, if any.
+  OsrBufferEntry& entry = osr_buffer_[osr_buffer_cursor_];
+  if (entry.job != nullptr) {
+    if (FLAG_trace_osr) {
+      OptimizedCompilationInfo* info = entry.job->compilation_info();
+      PrintF("[OSR - Discarded ready job of ");
+      info->closure()->PrintName();
+      PrintF(" at AST id %d]\n", info->osr_offset().ToInt());
+    }
+    DisposeCompilationJob(entry.job, false);
+  }
+  entry = OsrBufferEntry();
+  entry.job = job;
+  osr_buffer_cursor_ = (osr_buffer_cursor_ + 1) % osr_buffer_capacity_;
+  return true;
+}
+
+void OptimizingCompileDispatcher::RemoveFromOsrBuffer(
+    OptimizedCompilationJob* job) {
+  if (!job->compilation_info()->is_osr()) return;
+  base::MutexGuard access_osr_buffer(&osr_buffer_mutex_);
+  for (int i = 0; i < osr_buffer_capacity_; i++) {
+    if (osr_buffer_[i].job == job) osr_buffer_[i] = OsrBufferEntry();
+  }
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  if (job->compilation_info()->is_osr() && !AddToOsrBuffer(job)) {
+    if (FLAG_trace_osr) {
+      OptimizedCompilationInfo* info = job->compilation_info();
+      PrintF("[OSR - Dropped job of ");
+      info->closure()->PrintName();
+      PrintF(" at AST id %d because the OSR buffer is full]\n",
+             info->osr_offset().ToInt());
+    }
+    DisposeCompilationJob(job, false);
+    return;
+  }
   {
     // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
@@ -18,6 +18,8 @@
 namespace v8 {
 namespace internal {
 
+class BailoutId;
+class JSFunction;
 class OptimizedCompilationJob;
 class SharedFunctionInfo;
 
@@ -28,11 +30,14 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
         input_queue_length_(0),
         input_queue_shift_(0),
+        osr_buffer_capacity_(FLAG_concurrent_recompilation_queue_length + 4),
+        osr_buffer_cursor_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
     input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    osr_buffer_ = NewArray<OsrBufferEntry>(osr_buffer_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -44,11 +49,33 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void Unblock();
   void InstallOptimizedFunctions();
 
+  // Returns the finished OSR job for the back edge at {osr_offset} in
+  // {function}, if any, and transfers its ownership to the caller.
+  OptimizedCompilationJob* FindReadyOSRCandidate(Handle<JSFunction> function,
+                                                 BailoutId osr_offset);
+  // Returns true if an OSR job for the back edge at {osr_offset} in
+  // {function} is still waiting to be compiled or being compiled.
+  bool IsQueuedForOSR(Handle<JSFunction> function, BailoutId osr_offset);
+  // Returns true if the OSR buffer has room for another job.
+  bool IsOsrBufferAvailable();
+  // Arms the back edges of every function with a finished OSR job again if
+  // they were disarmed in the meantime, e.g. by an OSR request for another
+  // loop. A job whose back edges were disarmed {kMaxOsrArmCount} times
+  // without being picked up is discarded.
+  void ArmReadyOSRCandidates();
+
+  static const int kMaxOsrArmCount = 2;
+
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  inline int InputQueueLength() {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    return input_queue_length_;
+  }
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
@@ -56,7 +83,20 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct OsrBufferEntry {
+    OptimizedCompilationJob* job = nullptr;
+    // Set by the background thread once {job} has been executed.
+    bool ready = false;
+    // Number of times the back edges of the function have been armed so that
+    // the interpreter picks up the finished {job}.
+    int arm_count = 0;
+  };
+
   void FlushOutputQueue(bool restore_function_code);
+  void FlushOsrBuffer();
+  // Returns false if every slot holds a job that is not finished yet.
+  bool AddToOsrBuffer(OptimizedCompilationJob* job);
+  void RemoveFromOsrBuffer(OptimizedCompilationJob* job);
   void CompileNext(OptimizedCompilationJob* job);
   OptimizedCompilationJob* NextInput(bool check_if_flushing = false);
 
@@ -82,6 +122,14 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // different threads.
   base::Mutex output_queue_mutex_;
 
+  // Cyclic buffer of OSR jobs, both queued and finished. Finished jobs stay
+  // in the buffer until the interpreter reaches their back edge again, or
+  // until they are evicted by newer OSR jobs.
+  OsrBufferEntry* osr_buffer_;
+  int osr_buffer_capacity_;
+  int osr_buffer_cursor_;
+  base::Mutex osr_buffer_mutex_;
+
   std::atomic<ModeFlag> mode_;
 
   int blocked_jobs_;
@@ -13,6 +13,8 @@
 #include "src/ast/prettyprinter.h"
 #include "src/ast/scopes.h"
 #include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/bootstrapper.h"
 #include "src/compilation-cache.h"
 #include "src/compiler-dispatcher/compiler-dispatcher.h"
@@ -23,6 +25,7 @@
 #include "src/frames-inl.h"
 #include "src/globals.h"
 #include "src/heap/heap.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/interpreter.h"
 #include "src/isolate-inl.h"
 #include "src/log-inl.h"
@@ -37,8 +40,10 @@
 #include "src/parsing/rewriter.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/runtime-profiler.h"
+#include "src/snapshot/code-cache-directory.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/unoptimized-compilation-info.h"
+#include "src/v8.h"
 #include "src/vm-state-inl.h"
 
 namespace v8 {
@@ -171,6 +176,19 @@ void UnoptimizedCompilationJob::RecordCompilationStats(Isolate* isolate) const {
   // TODO(4280): Rename counters from "baseline" to "unoptimized" eventually.
   counters->total_baseline_code_size()->Increment(code_size);
   counters->total_baseline_compile_count()->Increment(1);
+  if (FLAG_ignition_short_star && compilation_info()->has_bytecode_array() &&
+      counters->short_star_bytes_saved()->Enabled()) {
+    // Each short Star is one byte shorter than the Star it replaces.
+    int short_stars = 0;
+    for (interpreter::BytecodeArrayIterator it(
+             compilation_info()->bytecode_array());
+         !it.done(); it.Advance()) {
+      if (interpreter::Bytecodes::IsShortStar(it.current_bytecode())) {
+        short_stars++;
+      }
+    }
+    counters->short_star_bytes_saved()->Increment(short_stars);
+  }
 
   // TODO(5203): Add timers for each phase of compilation.
 }
@@ -607,6 +625,68 @@ bool FinalizeUnoptimizedCode(
   return true;
 }
 
+// With --concurrent-osr, OSR code is cached in the native context, as a list of
+// (shared function info, code, OSR offset) entries that hold the function and
+// code weakly.
+const int kOsrCodeCacheSharedOffset = 0;
+const int kOsrCodeCacheCodeOffset = 1;
+const int kOsrCodeCacheOffsetOffset = 2;
+const int kOsrCodeCacheEntryLength = 3;
+
+// Whether the OSR code cache entry at {entry} is free to be reused.
+bool IsOsrCodeCacheEntryFree(WeakFixedArray cache, int entry) {
+  HeapObject code;
+  if (!cache->Get(entry + kOsrCodeCacheCodeOffset)
+           ->GetHeapObjectIfWeak(&code)) {
+    return true;
+  }
+  return cache->Get(entry + kOsrCodeCacheSharedOffset)->IsCleared() ||
+         Code::cast(code)->marked_for_deoptimization();
+}
+
+MaybeHandle<Code> GetCodeFromOsrCodeCache(Handle<JSFunction> function,
+                                          BailoutId osr_offset) {
+  DisallowHeapAllocation no_gc;
+  WeakFixedArray cache =
+      function->context()->native_context()->osr_code_cache();
+  MaybeObject shared = HeapObjectReference::Weak(function->shared());
+  MaybeObject offset = MaybeObject::FromSmi(Smi::FromInt(osr_offset.ToInt()));
+  for (int entry = 0; entry < cache->length();
+       entry += kOsrCodeCacheEntryLength) {
+    if (cache->Get(entry + kOsrCodeCacheSharedOffset) != shared ||
+        cache->Get(entry + kOsrCodeCacheOffsetOffset) != offset ||
+        IsOsrCodeCacheEntryFree(cache, entry)) {
+      continue;
+    }
+    HeapObject code =
+        cache->Get(entry + kOsrCodeCacheCodeOffset)->GetHeapObjectAssumeWeak();
+    return handle(Code::cast(code), function->GetIsolate());
+  }
+  return MaybeHandle<Code>();
+}
+
+void InsertCodeIntoOsrCodeCache(Handle<JSFunction> function,
+                                Handle<Code> code, BailoutId osr_offset) {
+  Isolate* isolate = function->GetIsolate();
+  Handle<Context> native_context(function->context()->native_context(),
+                                 isolate);
+  Handle<WeakFixedArray> cache(native_context->osr_code_cache(), isolate);
+  int entry = 0;
+  while (entry < cache->length() && !IsOsrCodeCacheEntryFree(*cache, entry)) {
+    entry += kOsrCodeCacheEntryLength;
+  }
+  if (entry == cache->length()) {
+    cache = isolate->factory()->CopyWeakFixedArrayAndGrow(
+        cache, kOsrCodeCacheEntryLength, TENURED);
+    native_context->set_osr_code_cache(*cache);
+  }
+  cache->Set(entry + kOsrCodeCacheSharedOffset,
+             HeapObjectReference::Weak(function->shared()));
+  cache->Set(entry + kOsrCodeCacheCodeOffset, HeapObjectReference::Weak(*code));
+  cache->Set(entry + kOsrCodeCacheOffsetOffset,
+             MaybeObject::FromSmi(Smi::FromInt(osr_offset.ToInt())));
+}
+
 V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
     Handle<JSFunction> function, BailoutId osr_offset) {
   RuntimeCallTimerScope runtimeTimer(
@@ -628,8 +708,10 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
         return Handle<Code>(code, feedback_vector->GetIsolate());
       }
     }
+    return MaybeHandle<Code>();
   }
-  return MaybeHandle<Code>();
+  if (!FLAG_concurrent_osr) return MaybeHandle<Code>();
+  return GetCodeFromOsrCodeCache(function, osr_offset);
 }
 
 void ClearOptimizedCodeCache(OptimizedCompilationInfo* compilation_info) {
@@ -664,6 +746,8 @@ void InsertCodeIntoOptimizedCodeCache(
     Handle<FeedbackVector> vector =
         handle(function->feedback_vector(), function->GetIsolate());
     FeedbackVector::SetOptimizedCode(vector, code);
+  } else if (FLAG_concurrent_osr) {
+    InsertCodeIntoOsrCodeCache(function, code, compilation_info->osr_offset());
   }
 }
 
@@ -706,6 +790,16 @@ bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
     return false;
   }
 
+  if (compilation_info->is_osr() &&
+      !isolate->optimizing_compile_dispatcher()->IsOsrBufferAvailable()) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** OSR buffer full, will retry optimizing ");
+      compilation_info->closure()->ShortPrint();
+      PrintF(" later.\n");
+    }
+    return false;
+  }
+
   if (isolate->heap()->HighMemoryPressure()) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** High memory pressure, will retry optimizing ");
@@ -715,6 +809,14 @@ bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
     return false;
   }
 
+  // When the queue is backing up, prefer getting optimized code out quickly
+  // over the quality of its register allocation.
+  if (FLAG_turbo_fast_register_allocation_queue_length > 0 &&
+      isolate->optimizing_compile_dispatcher()->InputQueueLength() >=
+          FLAG_turbo_fast_register_allocation_queue_length) {
+    compilation_info->MarkAsFastRegisterAllocation();
+  }
+
   TimerEventScope<TimerEventRecompileSynchronous> timer(isolate);
   RuntimeCallTimerScope runtimeTimer(
       isolate, RuntimeCallCounterId::kRecompileSynchronous);
@@ -727,7 +829,10 @@ bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
     compilation_info->closure()->ShortPrint();
-    PrintF(" for concurrent optimization.\n");
+    PrintF(" for concurrent optimization%s.\n",
+           compilation_info->is_fast_register_allocation()
+               ? " with fast register allocation"
+               : "");
   }
   return true;
 }
@@ -822,6 +927,10 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     if (GetOptimizedCodeLater(job.get(), isolate)) {
       job.release();  // The background recompile job owns this now.
 
+      // OSR code is picked up at the back edge that requested it, so the
+      // function keeps running in the interpreter in the meantime.
+      if (compilation_info->is_osr()) return MaybeHandle<Code>();
+
       // Set the optimization marker and return a code object which checks it.
       function->SetOptimizationMarker(OptimizationMarker::kInOptimizationQueue);
       DCHECK(function->IsInterpreted() ||
@@ -945,9 +1054,184 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(
   return shared_info;
 }
 
+// Compiles the eager inner functions of a streamed script in parallel. The
+// thread that parsed the script and worker tasks take function literals off a
+// shared worklist and compile them, and the eager literals discovered while
+// compiling a function are added to the worklist in turn. The state is
+// reference counted because worker tasks that start running only after all
+// functions were compiled still access it, find the worklist empty and exit.
+class ParallelInnerFunctionCompiler
+    : public std::enable_shared_from_this<ParallelInnerFunctionCompiler> {
+ public:
+  ParallelInnerFunctionCompiler(ParseInfo* parse_info,
+                                AccountingAllocator* allocator, int stack_size,
+                                std::vector<FunctionLiteral*> literals)
+      : parse_info_(parse_info),
+        allocator_(allocator),
+        stack_size_(stack_size),
+        max_tasks_(V8::GetCurrentPlatform()->NumberOfWorkerThreads()),
+        worklist_(std::move(literals)) {}
+
+  // Compiles all literals on the worklist, with the help of worker tasks, and
+  // adds their jobs to |inner_function_jobs|. Returns false if compiling any
+  // of them failed.
+  bool Run(UnoptimizedCompilationJobList* inner_function_jobs) {
+    {
+      base::MutexGuard guard(&mutex_);
+      ScheduleTasksLocked();
+    }
+    while (true) {
+      CompileLiterals(parse_info_->stack_limit());
+      base::MutexGuard guard(&mutex_);
+      // Wait for the worker tasks, and help out if they find more literals.
+      while (active_jobs_ > 0 && (worklist_.empty() || failed_)) {
+        cv_.Wait(&mutex_);
+      }
+      if (active_jobs_ == 0 && (worklist_.empty() || failed_)) break;
+    }
+    if (failed_) return false;
+    inner_function_jobs->splice_after(inner_function_jobs->before_begin(),
+                                      std::move(jobs_));
+
+    // asm.js validation reports warnings through the parse info, so it is
+    // not done on worker threads.
+    for (FunctionLiteral* literal : asm_literals_) {
+      std::unique_ptr<UnoptimizedCompilationJob> job(
+          ExecuteUnoptimizedCompileJobs(parse_info_, literal, allocator_,
+                                        inner_function_jobs));
+      if (!job) return false;
+      inner_function_jobs->emplace_front(std::move(job));
+    }
+    return true;
+  }
+
+ private:
+  class CompileTask : public Task {
+   public:
+    explicit CompileTask(
+        std::shared_ptr<ParallelInnerFunctionCompiler> compiler)
+        : compiler_(std::move(compiler)) {}
+
+    void Run() override { compiler_->RunOnWorkerThread(); }
+
+   private:
+    std::shared_ptr<ParallelInnerFunctionCompiler> compiler_;
+
+    DISALLOW_COPY_AND_ASSIGN(CompileTask);
+  };
+
+  void RunOnWorkerThread() {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHeapAccess no_heap_access;
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.CompileInnerFunctionsBackground");
+    CompileLiterals(GetCurrentStackPosition() - stack_size_ * KB);
+    base::MutexGuard guard(&mutex_);
+    pending_tasks_--;
+  }
+
+  // Compiles literals from the worklist until it is empty.
+  void CompileLiterals(uintptr_t stack_limit) {
+    while (true) {
+      FunctionLiteral* literal;
+      {
+        base::MutexGuard guard(&mutex_);
+        if (worklist_.empty() || failed_) return;
+        literal = worklist_.back();
+        worklist_.pop_back();
+        if (UseAsmWasm(literal, parse_info_->is_asm_wasm_broken())) {
+          asm_literals_.push_back(literal);
+          continue;
+        }
+        active_jobs_++;
+      }
+
+      std::vector<FunctionLiteral*> eager_inner_literals;
+      std::unique_ptr<UnoptimizedCompilationJob> job(
+          interpreter::Interpreter::NewCompilationJob(
+              parse_info_, literal, allocator_, &eager_inner_literals));
+      job->set_stack_limit(stack_limit);
+      bool succeeded = job->ExecuteJob() == CompilationJob::SUCCEEDED;
+
+      base::MutexGuard guard(&mutex_);
+      active_jobs_--;
+      if (succeeded) {
+        jobs_.emplace_front(std::move(job));
+        worklist_.insert(worklist_.end(), eager_inner_literals.begin(),
+                         eager_inner_literals.end());
+        ScheduleTasksLocked();
+      } else {
+        failed_ = true;
+      }
+      cv_.NotifyOne();
+    }
+  }
+
+  // Posts worker tasks for literals that no thread will pick up soon.
+  void ScheduleTasksLocked() {
+    while (pending_tasks_ < max_tasks_ &&
+           static_cast<size_t>(pending_tasks_) < worklist_.size()) {
+      pending_tasks_++;
+      V8::GetCurrentPlatform()->CallOnWorkerThread(
+          base::make_unique<CompileTask>(shared_from_this()));
+    }
+  }
+
+  ParseInfo* const parse_info_;
+  AccountingAllocator* const allocator_;
+  const int stack_size_;
+  const int max_tasks_;
+
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  std::vector<FunctionLiteral*> worklist_;
+  std::vector<FunctionLiteral*> asm_literals_;
+  UnoptimizedCompilationJobList jobs_;
+  int active_jobs_ = 0;
+  int pending_tasks_ = 0;
+  bool failed_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelInnerFunctionCompiler);
+};
+
+// Like GenerateUnoptimizedCode, but only compiles the top-level code on the
+// calling thread and fans the eager inner functions out to worker threads.
+std::unique_ptr<UnoptimizedCompilationJob> GenerateUnoptimizedCodeInParallel(
+    ParseInfo* parse_info, AccountingAllocator* allocator,
+    UnoptimizedCompilationJobList* inner_function_jobs, int stack_size) {
+  DisallowHeapAccess no_heap_access;
+  DCHECK(inner_function_jobs->empty());
+  DCHECK(parse_info->is_toplevel());
+
+  if (!Compiler::Analyze(parse_info)) {
+    return std::unique_ptr<UnoptimizedCompilationJob>();
+  }
+
+  std::vector<FunctionLiteral*> eager_inner_literals;
+  std::unique_ptr<UnoptimizedCompilationJob> outer_function_job(
+      interpreter::Interpreter::NewCompilationJob(
+          parse_info, parse_info->literal(), allocator,
+          &eager_inner_literals));
+  if (outer_function_job->ExecuteJob() != CompilationJob::SUCCEEDED) {
+    return std::unique_ptr<UnoptimizedCompilationJob>();
+  }
+
+  auto inner_compiler = std::make_shared<ParallelInnerFunctionCompiler>(
+      parse_info, allocator, stack_size, std::move(eager_inner_literals));
+  if (!inner_compiler->Run(inner_function_jobs)) {
+    return std::unique_ptr<UnoptimizedCompilationJob>();
+  }
+
+  // Character stream shouldn't be used again.
+  parse_info->ResetCharacterStream();
+
+  return outer_function_job;
+}
+
 std::unique_ptr<UnoptimizedCompilationJob> CompileOnBackgroundThread(
     ParseInfo* parse_info, AccountingAllocator* allocator,
-    UnoptimizedCompilationJobList* inner_function_jobs) {
+    UnoptimizedCompilationJobList* inner_function_jobs, int stack_size) {
   DisallowHeapAccess no_heap_access;
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompileCodeBackground");
@@ -959,6 +1243,14 @@ std::unique_ptr<UnoptimizedCompilationJob> CompileOnBackgroundThread(
                 : RuntimeCallCounterId::kCompileBackgroundScript
           : RuntimeCallCounterId::kCompileBackgroundFunction);
 
+  // Runtime call stats are not thread-safe, so streamed scripts are only
+  // compiled in parallel when they are off.
+  if (parse_info->is_toplevel() && FLAG_parallel_streaming_compile &&
+      !FLAG_runtime_stats) {
+    return GenerateUnoptimizedCodeInParallel(parse_info, allocator,
+                                             inner_function_jobs, stack_size);
+  }
+
   // Generate the unoptimized bytecode or asm-js data.
   std::unique_ptr<UnoptimizedCompilationJob> outer_function_job(
       GenerateUnoptimizedCode(parse_info, allocator, inner_function_jobs));
@@ -968,7 +1260,7 @@ std::unique_ptr<UnoptimizedCompilationJob> CompileOnBackgroundThread(
 }  // namespace
 
 BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
-                                             Isolate* isolate)
+                                             Isolate* isolate, bool is_module)
     : info_(new ParseInfo(isolate)),
       stack_size_(i::FLAG_stack_size),
       worker_thread_runtime_call_stats_(
@@ -982,6 +1274,7 @@ BackgroundCompileTask::BackgroundCompileTask(ScriptStreamingData* streamed_data,
   LOG(isolate, ScriptEvent(Logger::ScriptEventType::kStreamingCompile,
                            info_->script_id()));
   info_->set_toplevel();
+  if (is_module) info_->set_module();
   info_->set_allow_lazy_parsing();
   if (V8_UNLIKELY(info_->block_coverage_enabled())) {
     info_->AllocateSourceRangeMap();
@@ -1088,8 +1381,8 @@ void BackgroundCompileTask::Run() {
   parser_->ParseOnBackground(info_.get());
   if (info_->literal() != nullptr) {
     // Parsing has succeeded, compile.
-    outer_function_job_ = CompileOnBackgroundThread(info_.get(), allocator_,
-                                                    &inner_function_jobs_);
+    outer_function_job_ = CompileOnBackgroundThread(
+        info_.get(), allocator_, &inner_function_jobs_, stack_size_);
   }
 }
 
@@ -1153,12 +1446,22 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
     return true;
   }
 
+  // Bytecode flushing is the only way a function loses its literal id.
+  if (shared_info->HasUncompiledData() &&
+      !shared_info->uncompiled_data()->has_function_literal_id()) {
+    isolate->counters()->bytecode_recompiles()->Increment();
+  }
+
   if (shared_info->HasUncompiledDataWithPreparseData()) {
-    parse_info.set_consumed_preparse_data(ConsumedPreparseData::For(
-        isolate,
-        handle(
-            shared_info->uncompiled_data_with_preparse_data()->preparse_data(),
-            isolate)));
+    Handle<PreparseData> preparse_data(
+        shared_info->uncompiled_data_with_preparse_data()->preparse_data(),
+        isolate);
+    if (FLAG_flush_bytecode_keep_preparse_data &&
+        shared_info->CanFlushBytecode()) {
+      isolate->heap()->KeepPreparseData(shared_info, preparse_data);
+    }
+    parse_info.set_consumed_preparse_data(
+        ConsumedPreparseData::For(isolate, preparse_data));
   }
 
   // Parse and update ParseInfo with the results.
@@ -1215,8 +1518,11 @@ bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag,
   DCHECK(is_compiled_scope->is_compiled());
   Handle<Code> code = handle(shared_info->GetCode(), isolate);
 
-  // Allocate FeedbackVector for the JSFunction.
-  JSFunction::EnsureFeedbackVector(function);
+  // Allocate FeedbackVector for the JSFunction, unless it is allocated lazily
+  // by the first budget interrupt.
+  if (!FLAG_lazy_feedback_allocation || FLAG_always_opt) {
+    JSFunction::EnsureFeedbackVector(function);
+  }
 
   // Optimize now if --always-opt is enabled.
   if (FLAG_always_opt && !function->shared()->HasAsmWasmData()) {
@@ -1708,22 +2014,22 @@ Handle<Script> NewScript(Isolate* isolate, ParseInfo* parse_info,
   return script;
 }
 
-}  // namespace
-
-MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
+MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     Isolate* isolate, Handle<String> source,
     const Compiler::ScriptDetails& script_details,
     ScriptOriginOptions origin_options, v8::Extension* extension,
-    ScriptData* cached_data, ScriptCompiler::CompileOptions compile_options,
+    ScriptData* cached_data, CodeCacheValidationTask* validation_task,
+    ScriptCompiler::CompileOptions compile_options,
     ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason);
 
   if (compile_options == ScriptCompiler::kNoCompileOptions ||
       compile_options == ScriptCompiler::kEagerCompile) {
     DCHECK_NULL(cached_data);
+    DCHECK_NULL(validation_task);
   } else {
     DCHECK(compile_options == ScriptCompiler::kConsumeCodeCache);
-    DCHECK(cached_data);
+    DCHECK_NE(cached_data == nullptr, validation_task == nullptr);
     DCHECK_NULL(extension);
   }
   int source_length = source->length();
@@ -1736,6 +2042,9 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   // Do a lookup in the compilation cache but not for extensions.
   MaybeHandle<SharedFunctionInfo> maybe_result;
   IsCompiledScope is_compiled_scope;
+  // Set if the script is missing from the --code-cache-dir.
+  CodeCacheDirectory* code_cache_directory = nullptr;
+  std::string code_cache_file_name;
   if (extension == nullptr) {
     bool can_consume_code_cache =
         compile_options == ScriptCompiler::kConsumeCodeCache;
@@ -1759,9 +2068,12 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                    "V8.CompileDeserialize");
       Handle<SharedFunctionInfo> inner_result;
-      if (CodeSerializer::Deserialize(isolate, cached_data, source,
-                                      origin_options)
-              .ToHandle(&inner_result)) {
+      MaybeHandle<SharedFunctionInfo> maybe_deserialized =
+          validation_task != nullptr
+              ? validation_task->Finish(isolate, source, origin_options)
+              : CodeSerializer::Deserialize(isolate, cached_data, source,
+                                            origin_options);
+      if (maybe_deserialized.ToHandle(&inner_result)) {
         // Promote to per-isolate compilation cache.
         is_compiled_scope = inner_result->is_compiled_scope();
         DCHECK(is_compiled_scope.is_compiled());
@@ -1773,6 +2085,26 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (isolate->code_cache_directory() != nullptr &&
+               natives == NOT_NATIVES_CODE && !origin_options.IsModule()) {
+      // Then check the code cache managed by V8.
+      HistogramTimerScope timer(isolate->counters()->compile_deserialize());
+      RuntimeCallTimerScope runtimeTimer(
+          isolate, RuntimeCallCounterId::kCompileDeserialize);
+      code_cache_file_name = isolate->code_cache_directory()->FileNameFor(
+          source, script_details, origin_options);
+      Handle<SharedFunctionInfo> inner_result;
+      if (isolate->code_cache_directory()
+              ->Lookup(code_cache_file_name, source, origin_options)
+              .ToHandle(&inner_result)) {
+        is_compiled_scope = inner_result->is_compiled_scope();
+        DCHECK(is_compiled_scope.is_compiled());
+        compilation_cache->PutScript(source, isolate->native_context(),
+                                     language_mode, inner_result);
+        maybe_result = inner_result;
+      } else {
+        code_cache_directory = isolate->code_cache_directory();
+      }
     }
   }
 
@@ -1795,6 +2127,9 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, isolate->native_context(),
                                    language_mode, result);
+      if (code_cache_directory != nullptr) {
+        code_cache_directory->Add(code_cache_file_name, result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE &&
                natives != NATIVES_CODE) {
       isolate->ReportPendingMessages();
@@ -1804,6 +2139,32 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   return maybe_result;
 }
 
+}  // namespace
+
+MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
+    Isolate* isolate, Handle<String> source,
+    const Compiler::ScriptDetails& script_details,
+    ScriptOriginOptions origin_options, v8::Extension* extension,
+    ScriptData* cached_data, ScriptCompiler::CompileOptions compile_options,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, origin_options, extension, cached_data,
+      nullptr, compile_options, no_cache_reason, natives);
+}
+
+MaybeHandle<SharedFunctionInfo>
+Compiler::GetSharedFunctionInfoForScriptWithDeserializeTask(
+    Isolate* isolate, Handle<String> source,
+    const Compiler::ScriptDetails& script_details,
+    ScriptOriginOptions origin_options,
+    CodeCacheValidationTask* validation_task,
+    ScriptCompiler::NoCacheReason no_cache_reason, NativesFlag natives) {
+  return GetSharedFunctionInfoForScriptImpl(
+      isolate, source, script_details, origin_options, nullptr, nullptr,
+      validation_task, ScriptCompiler::kConsumeCodeCache, no_cache_reason,
+      natives);
+}
+
 MaybeHandle<JSFunction> Compiler::GetWrappedFunction(
     Handle<String> source, Handle<FixedArray> arguments,
     Handle<Context> context, const Compiler::ScriptDetails& script_details,
@@ -1903,6 +2264,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
   BackgroundCompileTask* task = streaming_data->task.get();
   ParseInfo* parse_info = task->info();
   DCHECK(parse_info->is_toplevel());
+  DCHECK_EQ(origin_options.IsModule(), parse_info->is_module());
   // Check if compile cache already holds the SFI, if so no need to finalize
   // the code compiled on the background thread.
   CompilationCache* compilation_cache = isolate->compilation_cache();
@@ -1973,11 +2335,13 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
 
 MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    BailoutId osr_offset,
-                                                   JavaScriptFrame* osr_frame) {
+                                                   JavaScriptFrame* osr_frame,
+                                                   ConcurrencyMode mode) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(function, ConcurrencyMode::kNotConcurrent, osr_offset,
-                          osr_frame);
+  // The frame does not outlive a concurrent job, so don't hand it out.
+  if (mode == ConcurrencyMode::kConcurrent) osr_frame = nullptr;
+  return GetOptimizedCode(function, mode, osr_offset, osr_frame);
 }
 
 bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
@@ -2038,6 +2402,42 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
   return CompilationJob::FAILED;
 }
 
+MaybeHandle<Code> Compiler::FinalizeOptimizedCompilationJobForOSR(
+    OptimizedCompilationJob* job, Isolate* isolate) {
+  VMState<COMPILER> state(isolate);
+  // Take ownership of compilation job.  Deleting job also tears down the zone.
+  std::unique_ptr<OptimizedCompilationJob> job_scope(job);
+  OptimizedCompilationInfo* compilation_info = job->compilation_info();
+  DCHECK(compilation_info->is_osr());
+
+  TimerEventScope<TimerEventRecompileSynchronous> timer(isolate);
+  RuntimeCallTimerScope runtimeTimer(
+      isolate, RuntimeCallCounterId::kRecompileSynchronous);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.RecompileSynchronous");
+
+  // Optimization on the concurrent thread may have failed, optimization may
+  // have been disabled in the meantime, or the code may have already been
+  // invalidated due to dependency change.
+  if (job->state() == CompilationJob::State::kReadyToFinalize &&
+      !compilation_info->shared_info()->optimization_disabled() &&
+      job->FinalizeJob(isolate) == CompilationJob::SUCCEEDED) {
+    job->RecordCompilationStats();
+    InsertCodeIntoOptimizedCodeCache(compilation_info);
+    job->RecordFunctionCompilation(CodeEventListener::LAZY_COMPILE_TAG,
+                                   isolate);
+    return handle(*compilation_info->code(), isolate);
+  }
+
+  if (FLAG_trace_osr) {
+    PrintF("[OSR - Aborted concurrent compilation of ");
+    compilation_info->closure()->PrintName();
+    PrintF(" because: %s]\n",
+           GetBailoutReason(compilation_info->bailout_reason()));
+  }
+  return MaybeHandle<Code>();
+}
+
 void Compiler::PostInstantiation(Handle<JSFunction> function,
                                  PretenureFlag pretenure) {
   Isolate* isolate = function->GetIsolate();
@@ -2047,7 +2447,11 @@ void Compiler::PostInstantiation(Handle<JSFunction> function,
   // If code is compiled to bytecode (i.e., isn't asm.js), then allocate a
   // feedback and check for optimized code.
   if (is_compiled_scope.is_compiled() && shared->HasBytecodeArray()) {
-    JSFunction::EnsureFeedbackVector(function);
+    // With --lazy-feedback-allocation the vector is allocated by the first
+    // budget interrupt instead, unless the feedback cell already holds one.
+    if (!FLAG_lazy_feedback_allocation || FLAG_always_opt) {
+      JSFunction::EnsureFeedbackVector(function);
+    }
 
     Code code = function->has_feedback_vector()
                     ? function->feedback_vector()->optimized_code()
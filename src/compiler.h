@@ -21,6 +21,7 @@ namespace internal {
 // Forward declarations.
 class AstRawString;
 class BackgroundCompileTask;
+class CodeCacheValidationTask;
 class IsCompiledScope;
 class JavaScriptFrame;
 class OptimizedCompilationInfo;
@@ -145,6 +146,17 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       ScriptCompiler::NoCacheReason no_cache_reason,
       NativesFlag is_natives_code);
 
+  // Like GetSharedFunctionInfoForScript with kConsumeCodeCache, but consumes
+  // the code cache with a {validation_task} that may have run on a
+  // background thread before.
+  static MaybeHandle<SharedFunctionInfo>
+  GetSharedFunctionInfoForScriptWithDeserializeTask(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details, ScriptOriginOptions origin_options,
+      CodeCacheValidationTask* validation_task,
+      ScriptCompiler::NoCacheReason no_cache_reason,
+      NativesFlag is_natives_code);
+
   // Create a shared function info object for a Script source that has already
   // been parsed and possibly compiled on a background thread while being loaded
   // from a streamed source. On return, the data held by |streaming_data| will
@@ -171,9 +183,21 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // With {ConcurrencyMode::kConcurrent} the job is queued on the
+  // OptimizingCompileDispatcher instead and an empty handle is returned; the
+  // code is picked up with {FinalizeOptimizedCompilationJobForOSR} once the
+  // interpreter reaches the same back edge again.
   V8_WARN_UNUSED_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Handle<JSFunction> function, BailoutId osr_offset,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame,
+      ConcurrencyMode mode = ConcurrencyMode::kNotConcurrent);
+
+  // Finalize and return code from a previously run OSR job. Unlike
+  // {FinalizeOptimizedCompilationJob}, the code is not installed on the
+  // function, since it can only be entered at the OSR entry point.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Code>
+  FinalizeOptimizedCompilationJobForOSR(OptimizedCompilationJob* job,
+                                        Isolate* isolate);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
@@ -322,9 +346,11 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
  public:
   // Creates a new task that when run will parse and compile the streamed
   // script associated with |data| and can be finalized with
-  // Compiler::GetSharedFunctionInfoForStreamedScript.
+  // Compiler::GetSharedFunctionInfoForStreamedScript. The source is parsed as
+  // an ES module if |is_module| is set.
   // Note: does not take ownership of |data|.
-  BackgroundCompileTask(ScriptStreamingData* data, Isolate* isolate);
+  BackgroundCompileTask(ScriptStreamingData* data, Isolate* isolate,
+                        bool is_module);
   ~BackgroundCompileTask();
 
   // Creates a new task that when run will parse and compile the
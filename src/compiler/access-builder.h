@@ -42,6 +42,18 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to BigInt's bit field.
   static FieldAccess ForBigIntBitfield();
 
+  // Provides access to BigInt's 32 bit padding that is placed after the
+  // bitfield on 64 bit architectures without pointer compression.
+  static FieldAccess ForBigIntOptionalPadding();
+
+  // Provides access to BigInt's least significant digit on 64 bit
+  // architectures.
+  static FieldAccess ForBigIntLeastSignificantDigit64();
+
+  // Provides access to the digit at {index} of a BigInt on 32 bit
+  // architectures.
+  static FieldAccess ForBigIntDigit32(int index);
+
   // Provides access to JSObject::properties() field.
   static FieldAccess ForJSObjectPropertiesOrHash();
 
@@ -266,12 +266,20 @@ void CodeGenerator::AssembleCode() {
   tasm()->nop();
 
   // Assemble deoptimization exits.
+  deopt_exit_start_offset_ = tasm()->pc_offset();
   int last_updated = 0;
   for (DeoptimizationExit* exit : deoptimization_exits_) {
     tasm()->bind(exit->label());
     int trampoline_pc = tasm()->pc_offset();
     int deoptimization_id = exit->deoptimization_id();
     DeoptimizationState* ds = deoptimization_states_[deoptimization_id];
+    // With fixed size exits the Deoptimizer recovers the deoptimization id
+    // from the position of the exit, so a misplaced exit would deoptimize
+    // with the wrong translation.
+    CHECK_IMPLIES(Deoptimizer::kSupportsFixedDeoptExitSize,
+                  trampoline_pc == deopt_exit_start_offset_ +
+                                       deoptimization_id *
+                                           Deoptimizer::kDeoptExitSize);
 
     if (ds->kind() == DeoptimizeKind::kLazy) {
       last_updated = safepoints()->UpdateDeoptimizationInfo(
@@ -824,6 +832,7 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
   Handle<PodArray<InliningPosition>> inl_pos =
       CreateInliningPositions(info, isolate());
   data->SetInliningPositions(*inl_pos);
+  data->SetDeoptExitStart(Smi::FromInt(deopt_exit_start_offset_));
 
   if (info->is_osr()) {
     DCHECK_LE(0, osr_pc_offset_);
@@ -841,7 +850,8 @@ Handle<DeoptimizationData> CodeGenerator::GenerateDeoptimizationData() {
     data->SetBytecodeOffset(i, deoptimization_state->bailout_id());
     CHECK(deoptimization_state);
     data->SetTranslationIndex(
-        i, Smi::FromInt(deoptimization_state->translation_id()));
+        i, Smi::FromInt(translations_.IndexInByteArray(
+               deoptimization_state->translation_id())));
     data->SetPc(i, Smi::FromInt(deoptimization_state->pc_offset()));
   }
 
@@ -1066,11 +1076,12 @@ int CodeGenerator::BuildTranslation(Instruction* instr, int pc_offset,
   InstructionOperandIterator iter(instr, frame_state_offset);
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, &translation,
                                           state_combine);
+  int translation_index = translations_.Deduplicate(translation.index());
 
   int deoptimization_id = static_cast<int>(deoptimization_states_.size());
 
   deoptimization_states_.push_back(new (zone()) DeoptimizationState(
-      descriptor->bailout_id(), translation.index(), pc_offset, entry.kind(),
+      descriptor->bailout_id(), translation_index, pc_offset, entry.kind(),
       entry.reason()));
 
   return deoptimization_id;
@@ -421,6 +421,9 @@ class CodeGenerator final : public GapResolver::Assembler {
   TranslationBuffer translations_;
   int handler_table_offset_ = 0;
   int last_lazy_deopt_pc_ = 0;
+  // Offset of the first deoptimization exit, see
+  // Deoptimizer::kSupportsFixedDeoptExitSize.
+  int deopt_exit_start_offset_ = 0;
 
   // kArchCallCFunction could be reached either:
   //   kArchCallCFunction;
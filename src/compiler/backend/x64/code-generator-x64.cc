@@ -964,11 +964,10 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       // don't emit code for nops.
       break;
     case kArchDeoptimize: {
-      int deopt_state_id =
-          BuildTranslation(instr, -1, 0, OutputFrameStateCombine::Ignore());
-      CodeGenResult result =
-          AssembleDeoptimizerCall(deopt_state_id, current_source_position_);
-      if (result != kSuccess) return result;
+      // Jump to an exit at the end of the code, since the Deoptimizer
+      // computes the deoptimization id from the position of the exit.
+      DeoptimizationExit* exit = AddDeoptimizationExit(instr, 0);
+      __ jmp(exit->label());
       unwinding_info_writer_.MarkBlockWillExit();
       break;
     }
@@ -113,6 +113,13 @@ void UpdateInLiveness(Bytecode bytecode, BytecodeLivenessState& in_liveness,
     return;
   }
 
+  // Short Star bytecodes write their register without a register operand.
+  if (Bytecodes::IsShortStar(bytecode)) {
+    in_liveness.MarkRegisterDead(accessor.GetStarTargetRegister().index());
+    in_liveness.MarkAccumulatorLive();
+    return;
+  }
+
   if (Bytecodes::WritesAccumulator(bytecode)) {
     in_liveness.MarkAccumulatorDead();
   }
@@ -278,6 +285,11 @@ void UpdateAssignments(Bytecode bytecode, BytecodeLoopAssignments& assignments,
   int num_operands = Bytecodes::NumberOfOperands(bytecode);
   const OperandType* operand_types = Bytecodes::GetOperandTypes(bytecode);
 
+  if (Bytecodes::IsShortStar(bytecode)) {
+    assignments.Add(accessor.GetStarTargetRegister());
+    return;
+  }
+
   for (int i = 0; i < num_operands; ++i) {
     switch (operand_types[i]) {
       case OperandType::kRegOut: {
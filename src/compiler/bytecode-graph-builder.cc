@@ -972,9 +972,15 @@ void BytecodeGraphBuilder::VisitLdar() {
 
 void BytecodeGraphBuilder::VisitStar() {
   Node* value = environment()->LookupAccumulator();
-  environment()->BindRegister(bytecode_iterator().GetRegisterOperand(0), value);
+  environment()->BindRegister(bytecode_iterator().GetStarTargetRegister(),
+                              value);
 }
 
+#define SHORT_STAR_VISITOR(Name, ...) \
+  void BytecodeGraphBuilder::Visit##Name() { VisitStar(); }
+SHORT_STAR_BYTECODE_LIST(SHORT_STAR_VISITOR)
+#undef SHORT_STAR_VISITOR
+
 void BytecodeGraphBuilder::VisitMov() {
   Node* value =
       environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
@@ -3268,10 +3274,18 @@ void BytecodeGraphBuilder::BuildJumpIfJSReceiver() {
   BuildJumpIf(condition);
 }
 
+bool BytecodeGraphBuilder::IsDeoptLoopSite() const {
+  if (FLAG_max_deopts_per_site == 0) return false;
+  return feedback_vector()->EagerDeoptCountAt(
+             bytecode_iterator().current_offset()) >=
+         FLAG_max_deopts_per_site;
+}
+
 JSTypeHintLowering::LoweringResult
 BytecodeGraphBuilder::TryBuildSimplifiedUnaryOp(const Operator* op,
                                                 Node* operand,
                                                 FeedbackSlot slot) {
+  if (IsDeoptLoopSite()) return JSTypeHintLowering::LoweringResult::NoChange();
   Node* effect = environment()->GetEffectDependency();
   Node* control = environment()->GetControlDependency();
   JSTypeHintLowering::LoweringResult result =
@@ -3285,6 +3299,7 @@ JSTypeHintLowering::LoweringResult
 BytecodeGraphBuilder::TryBuildSimplifiedBinaryOp(const Operator* op, Node* left,
                                                  Node* right,
                                                  FeedbackSlot slot) {
+  if (IsDeoptLoopSite()) return JSTypeHintLowering::LoweringResult::NoChange();
   Node* effect = environment()->GetEffectDependency();
   Node* control = environment()->GetControlDependency();
   JSTypeHintLowering::LoweringResult result =
@@ -3323,6 +3338,7 @@ BytecodeGraphBuilder::TryBuildSimplifiedForInPrepare(Node* enumerator,
 JSTypeHintLowering::LoweringResult
 BytecodeGraphBuilder::TryBuildSimplifiedToNumber(Node* value,
                                                  FeedbackSlot slot) {
+  if (IsDeoptLoopSite()) return JSTypeHintLowering::LoweringResult::NoChange();
   Node* effect = environment()->GetEffectDependency();
   Node* control = environment()->GetControlDependency();
   JSTypeHintLowering::LoweringResult result =
@@ -223,6 +223,11 @@ class BytecodeGraphBuilder {
   // Applies the given early reduction onto the current environment.
   void ApplyEarlyReduction(JSTypeHintLowering::LoweringResult reduction);
 
+  // Returns true if earlier optimized code eagerly deoptimized at the current
+  // bytecode at least --max-deopts-per-site times, in which case we no longer
+  // speculate on the number feedback there and keep the generic operation.
+  bool IsDeoptLoopSite() const;
+
   // Check the context chain for extensions, for lookup fast paths.
   Environment* CheckContextExtensions(uint32_t depth);
 
@@ -257,6 +257,34 @@ class ProtectorDependency final : public CompilationDependencies::Dependency {
   PropertyCellRef cell_;
 };
 
+class ScriptContextSlotDependency final
+    : public CompilationDependencies::Dependency {
+ public:
+  ScriptContextSlotDependency(const ContextRef& context, int index)
+      : context_(context), index_(index) {
+    DCHECK(context_.IsConstScriptContextSlot(index_));
+  }
+
+  bool IsValid() const override {
+    return context_.object()->IsConstScriptContextSlot(index_);
+  }
+
+  void Install(const MaybeObjectHandle& code) override {
+    SLOW_DCHECK(IsValid());
+    Isolate* isolate = context_.isolate();
+    Handle<PropertyCell> cell(
+        PropertyCell::cast(context_.object()->script_context_side_table()->get(
+            Context::kScriptContextSideTableCellIndex)),
+        isolate);
+    DependentCode::InstallDependency(isolate, code, cell,
+                                     DependentCode::kPropertyCellChangedGroup);
+  }
+
+ private:
+  ContextRef context_;
+  int index_;
+};
+
 class ElementsKindDependency final
     : public CompilationDependencies::Dependency {
  public:
@@ -384,6 +412,12 @@ void CompilationDependencies::DependOnProtector(const PropertyCellRef& cell) {
   dependencies_.push_front(new (zone_) ProtectorDependency(cell));
 }
 
+void CompilationDependencies::DependOnScriptContextSlot(
+    const ContextRef& context, int index) {
+  dependencies_.push_front(new (zone_)
+                               ScriptContextSlotDependency(context, index));
+}
+
 void CompilationDependencies::DependOnElementsKind(
     const AllocationSiteRef& site) {
   // Do nothing if the object doesn't have any useful element transitions left.
@@ -62,6 +62,10 @@ class V8_EXPORT_PRIVATE CompilationDependencies : public ZoneObject {
   // Record the assumption that the protector remains valid.
   void DependOnProtector(const PropertyCellRef& cell);
 
+  // Record the assumption that the let binding at {index} of the script
+  // context {context} is not reassigned.
+  void DependOnScriptContextSlot(const ContextRef& context, int index);
+
   // Record the assumption that {site}'s {ElementsKind} doesn't change.
   void DependOnElementsKind(const AllocationSiteRef& site);
 
@@ -674,6 +674,9 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kPoisonIndex:
       result = LowerPoisonIndex(node);
       break;
+    case IrOpcode::kCheckClosure:
+      result = LowerCheckClosure(node, frame_state);
+      break;
     case IrOpcode::kCheckMaps:
       LowerCheckMaps(node, frame_state);
       break;
@@ -692,6 +695,9 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kCheckSymbol:
       result = LowerCheckSymbol(node, frame_state);
       break;
+    case IrOpcode::kCheckBigInt:
+      result = LowerCheckBigInt(node, frame_state);
+      break;
     case IrOpcode::kCheckString:
       result = LowerCheckString(node, frame_state);
       break;
@@ -897,6 +903,12 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kStringSubstring:
       result = LowerStringSubstring(node);
       break;
+    case IrOpcode::kBigIntAsIntN64:
+      result = LowerBigIntAsN64(node, true);
+      break;
+    case IrOpcode::kBigIntAsUintN64:
+      result = LowerBigIntAsN64(node, false);
+      break;
     case IrOpcode::kStringEqual:
       result = LowerStringEqual(node);
       break;
@@ -993,6 +1005,21 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kFindOrderedHashMapEntryForInt32Key:
       result = LowerFindOrderedHashMapEntryForInt32Key(node);
       break;
+    case IrOpcode::kFindOrderedHashMapEntryForStringKey:
+      result = LowerFindOrderedHashMapEntryForStringKey(node);
+      break;
+    case IrOpcode::kFindOrderedHashSetEntry:
+      result = LowerFindOrderedHashSetEntry(node);
+      break;
+    case IrOpcode::kFindOrderedHashSetEntryForInt32Key:
+      result = LowerFindOrderedHashSetEntryForInt32Key(node);
+      break;
+    case IrOpcode::kFindOrderedHashSetEntryForStringKey:
+      result = LowerFindOrderedHashSetEntryForStringKey(node);
+      break;
+    case IrOpcode::kFindEphemeronHashTableEntry:
+      result = LowerFindEphemeronHashTableEntry(node);
+      break;
     case IrOpcode::kTransitionAndStoreNumberElement:
       LowerTransitionAndStoreNumberElement(node);
       break;
@@ -1448,6 +1475,30 @@ Node* EffectControlLinearizer::LowerPoisonIndex(Node* node) {
   return index;
 }
 
+Node* EffectControlLinearizer::LowerCheckClosure(Node* node,
+                                                 Node* frame_state) {
+  Handle<FeedbackCell> feedback_cell = FeedbackCellOf(node->op());
+  Node* value = node->InputAt(0);
+
+  // Check that {value} is actually a JSFunction.
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* check_instance_type =
+      __ Word32Equal(value_instance_type, __ Int32Constant(JS_FUNCTION_TYPE));
+  __ DeoptimizeIfNot(DeoptimizeReason::kWrongCallTarget, VectorSlotPair(),
+                     check_instance_type, frame_state);
+
+  // Check that the {value}s feedback vector cell matches the one
+  // we recorded before.
+  Node* value_cell =
+      __ LoadField(AccessBuilder::ForJSFunctionFeedbackCell(), value);
+  Node* check_cell = __ WordEqual(value_cell, __ HeapConstant(feedback_cell));
+  __ DeoptimizeIfNot(DeoptimizeReason::kWrongFeedbackCell, VectorSlotPair(),
+                     check_cell, frame_state);
+  return value;
+}
+
 void EffectControlLinearizer::LowerCheckMaps(Node* node, Node* frame_state) {
   CheckMapsParameters const& p = CheckMapsParametersOf(node->op());
   Node* value = node->InputAt(0);
@@ -1644,6 +1695,22 @@ Node* EffectControlLinearizer::LowerCheckSymbol(Node* node, Node* frame_state) {
   return value;
 }
 
+Node* EffectControlLinearizer::LowerCheckBigInt(Node* node, Node* frame_state) {
+  Node* value = node->InputAt(0);
+  const CheckParameters& params = CheckParametersOf(node->op());
+
+  Node* check0 = ObjectIsSmi(value);
+  __ DeoptimizeIf(DeoptimizeReason::kSmi, params.feedback(), check0,
+                  frame_state);
+
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* check1 =
+      __ WordEqual(value_map, __ HeapConstant(factory()->bigint_map()));
+  __ DeoptimizeIfNot(DeoptimizeReason::kNotABigInt, params.feedback(), check1,
+                     frame_state);
+  return value;
+}
+
 Node* EffectControlLinearizer::LowerCheckString(Node* node, Node* frame_state) {
   Node* value = node->InputAt(0);
   const CheckParameters& params = CheckParametersOf(node->op());
@@ -3676,6 +3743,144 @@ Node* EffectControlLinearizer::LowerStringSubstring(Node* node) {
                  start, end, __ NoContextConstant());
 }
 
+// Computes BigInt.asIntN(64, value) or BigInt.asUintN(64, value) on the
+// least significant digit of {value}, and only allocates a new BigInt if
+// the result differs from {value}.
+Node* EffectControlLinearizer::LowerBigIntAsN64(Node* node, bool is_signed) {
+  if (machine()->Is32()) return LowerBigIntAsN64On32Bit(node, is_signed);
+  Node* value = node->InputAt(0);
+
+  auto if_negative = __ MakeLabel();
+  auto if_bits = __ MakeLabel(MachineType::PointerRepresentation());
+  auto if_result_negative = __ MakeLabel();
+  auto if_allocate = __ MakeLabel(MachineRepresentation::kWord32,
+                                  MachineType::PointerRepresentation());
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedPointer);
+
+  // Zero is the same in every width.
+  Node* bitfield = __ LoadField(AccessBuilder::ForBigIntBitfield(), value);
+  __ GotoIf(__ Word32Equal(bitfield, __ Int32Constant(0)), &done, value);
+
+  // Compute the 64 bit two's complement representation of {value}.
+  Node* digit =
+      __ LoadField(AccessBuilder::ForBigIntLeastSignificantDigit64(), value);
+  Node* sign =
+      __ Word32And(bitfield, __ Int32Constant(BigInt::SignBits::kMask));
+  __ GotoIfNot(__ Word32Equal(sign, __ Int32Constant(0)), &if_negative);
+  __ Goto(&if_bits, digit);
+  __ Bind(&if_negative);
+  __ Goto(&if_bits, __ IntSub(__ IntPtrConstant(0), digit));
+  __ Bind(&if_bits);
+  Node* bits = if_bits.PhiAt(0);
+
+  // Single digit {value}s whose sign matches the sign of the result are
+  // returned unchanged.
+  STATIC_ASSERT(BigInt::SignBits::kShift == 0);
+  Node* result_sign = is_signed ? __ IntLessThan(bits, __ IntPtrConstant(0))
+                                : __ Int32Constant(0);
+  Node* single_digit = __ Word32Or(
+      result_sign, __ Int32Constant(BigInt::LengthBits::encode(1)));
+  __ GotoIf(__ Word32Equal(bitfield, single_digit), &done, value);
+
+  if (is_signed) {
+    __ GotoIfNot(__ Word32Equal(result_sign, __ Int32Constant(0)),
+                 &if_result_negative);
+  }
+  __ Goto(&if_allocate, result_sign, bits);
+  if (is_signed) {
+    __ Bind(&if_result_negative);
+    __ Goto(&if_allocate, result_sign, __ IntSub(__ IntPtrConstant(0), bits));
+  }
+
+  __ Bind(&if_allocate);
+  __ Goto(&done, AllocateBigInt(if_allocate.PhiAt(0), if_allocate.PhiAt(1)));
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
+// Like LowerBigIntAsN64, but on 32 bit architectures, where the 64 bit two's
+// complement representation of {value} is computed from its two least
+// significant 32 bit digits.
+Node* EffectControlLinearizer::LowerBigIntAsN64On32Bit(Node* node,
+                                                       bool is_signed) {
+  DCHECK(machine()->Is32());
+  Node* value = node->InputAt(0);
+
+  auto if_high = __ MakeLabel(MachineRepresentation::kWord32);
+  auto if_negative = __ MakeLabel();
+  auto if_bits = __ MakeLabel(MachineRepresentation::kWord32,
+                              MachineRepresentation::kWord32);
+  auto if_result_negative = __ MakeLabel();
+  auto if_allocate = __ MakeLabel(MachineRepresentation::kWord32,
+                                  MachineRepresentation::kWord32,
+                                  MachineRepresentation::kWord32);
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedPointer);
+
+  // Zero is the same in every width.
+  Node* bitfield = __ LoadField(AccessBuilder::ForBigIntBitfield(), value);
+  __ GotoIf(__ Word32Equal(bitfield, __ Int32Constant(0)), &done, value);
+
+  // Load the two least significant digits of {value}.
+  Node* length =
+      __ Word32And(bitfield, __ Int32Constant(BigInt::LengthBits::kMask));
+  Node* low = __ LoadField(AccessBuilder::ForBigIntDigit32(0), value);
+  __ GotoIf(__ Uint32LessThan(
+                length, __ Int32Constant(BigInt::LengthBits::encode(2))),
+            &if_high, __ Int32Constant(0));
+  __ Goto(&if_high, __ LoadField(AccessBuilder::ForBigIntDigit32(1), value));
+  __ Bind(&if_high);
+  Node* high = if_high.PhiAt(0);
+
+  // Compute the 64 bit two's complement representation of {value}. The high
+  // word of -x is ~high, plus the carry out of the low word if that is zero.
+  Node* sign =
+      __ Word32And(bitfield, __ Int32Constant(BigInt::SignBits::kMask));
+  __ GotoIfNot(__ Word32Equal(sign, __ Int32Constant(0)), &if_negative);
+  __ Goto(&if_bits, low, high);
+  __ Bind(&if_negative);
+  __ Goto(&if_bits, __ Int32Sub(__ Int32Constant(0), low),
+          __ Int32Add(__ Word32Xor(high, __ Int32Constant(-1)),
+                      __ Word32Equal(low, __ Int32Constant(0))));
+  __ Bind(&if_bits);
+  Node* bits_low = if_bits.PhiAt(0);
+  Node* bits_high = if_bits.PhiAt(1);
+
+  // {value}s with at most two digits whose sign matches the sign of the
+  // result are returned unchanged.
+  STATIC_ASSERT(BigInt::SignBits::kShift == 0);
+  Node* result_sign = is_signed
+                          ? __ Int32LessThan(bits_high, __ Int32Constant(0))
+                          : __ Int32Constant(0);
+  Node* one_digit = __ Word32Or(
+      result_sign, __ Int32Constant(BigInt::LengthBits::encode(1)));
+  Node* two_digits = __ Word32Or(
+      result_sign, __ Int32Constant(BigInt::LengthBits::encode(2)));
+  __ GotoIf(__ Word32Equal(bitfield, one_digit), &done, value);
+  __ GotoIf(__ Word32Equal(bitfield, two_digits), &done, value);
+
+  if (is_signed) {
+    __ GotoIfNot(__ Word32Equal(result_sign, __ Int32Constant(0)),
+                 &if_result_negative);
+  }
+  __ Goto(&if_allocate, result_sign, bits_low, bits_high);
+  if (is_signed) {
+    __ Bind(&if_result_negative);
+    __ Goto(&if_allocate, result_sign,
+            __ Int32Sub(__ Int32Constant(0), bits_low),
+            __ Int32Add(__ Word32Xor(bits_high, __ Int32Constant(-1)),
+                        __ Word32Equal(bits_low, __ Int32Constant(0))));
+  }
+
+  __ Bind(&if_allocate);
+  __ Goto(&done, AllocateBigIntWithTwoDigits(if_allocate.PhiAt(0),
+                                             if_allocate.PhiAt(1),
+                                             if_allocate.PhiAt(2)));
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* EffectControlLinearizer::LowerStringEqual(Node* node) {
   return LowerStringComparison(
       Builtins::CallableFor(isolate(), Builtins::kStringEqual), node);
@@ -3840,6 +4045,82 @@ Node* EffectControlLinearizer::AllocateHeapNumberWithValue(Node* value) {
   return result;
 }
 
+// Allocates a BigInt with the given {sign} bit and the single {digit}, or a
+// BigInt without digits if {digit} is zero.
+Node* EffectControlLinearizer::AllocateBigInt(Node* sign, Node* digit) {
+  auto if_zero = __ MakeLabel();
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedPointer);
+  Node* map = __ HeapConstant(factory()->bigint_map());
+  bool has_padding =
+      BigInt::kHeaderSize > static_cast<int>(BigInt::kOptionalPaddingOffset);
+
+  __ GotoIf(__ WordEqual(digit, __ IntPtrConstant(0)), &if_zero);
+  {
+    Node* result =
+        __ Allocate(NOT_TENURED, __ Int32Constant(BigInt::SizeFor(1)));
+    __ StoreField(AccessBuilder::ForMap(), result, map);
+    __ StoreField(
+        AccessBuilder::ForBigIntBitfield(), result,
+        __ Word32Or(sign, __ Int32Constant(BigInt::LengthBits::encode(1))));
+    if (has_padding) {
+      __ StoreField(AccessBuilder::ForBigIntOptionalPadding(), result,
+                    __ Int32Constant(0));
+    }
+    __ StoreField(machine()->Is64()
+                      ? AccessBuilder::ForBigIntLeastSignificantDigit64()
+                      : AccessBuilder::ForBigIntDigit32(0),
+                  result, digit);
+    __ Goto(&done, result);
+  }
+
+  __ Bind(&if_zero);
+  {
+    Node* result =
+        __ Allocate(NOT_TENURED, __ Int32Constant(BigInt::SizeFor(0)));
+    __ StoreField(AccessBuilder::ForMap(), result, map);
+    __ StoreField(AccessBuilder::ForBigIntBitfield(), result,
+                  __ Int32Constant(0));
+    if (has_padding) {
+      __ StoreField(AccessBuilder::ForBigIntOptionalPadding(), result,
+                    __ Int32Constant(0));
+    }
+    __ Goto(&done, result);
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
+// Allocates a BigInt with the given {sign} bit and the 32 bit digits {low}
+// and {high}, leaving out the digits that are zero at the top.
+Node* EffectControlLinearizer::AllocateBigIntWithTwoDigits(Node* sign,
+                                                           Node* low,
+                                                           Node* high) {
+  DCHECK(machine()->Is32());
+  auto if_single_digit = __ MakeLabel();
+  auto done = __ MakeLabel(MachineRepresentation::kTaggedPointer);
+
+  __ GotoIf(__ Word32Equal(high, __ Int32Constant(0)), &if_single_digit);
+  {
+    Node* result =
+        __ Allocate(NOT_TENURED, __ Int32Constant(BigInt::SizeFor(2)));
+    __ StoreField(AccessBuilder::ForMap(), result,
+                  __ HeapConstant(factory()->bigint_map()));
+    __ StoreField(
+        AccessBuilder::ForBigIntBitfield(), result,
+        __ Word32Or(sign, __ Int32Constant(BigInt::LengthBits::encode(2))));
+    __ StoreField(AccessBuilder::ForBigIntDigit32(0), result, low);
+    __ StoreField(AccessBuilder::ForBigIntDigit32(1), result, high);
+    __ Goto(&done, result);
+  }
+
+  __ Bind(&if_single_digit);
+  __ Goto(&done, AllocateBigInt(sign, low));
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* EffectControlLinearizer::ChangeIntPtrToSmi(Node* value) {
   // Do shift on 32bit values if Smis are stored in the lower word.
   if (machine()->Is64() && SmiValuesAre31Bits()) {
@@ -5205,12 +5486,29 @@ Maybe<Node*> EffectControlLinearizer::LowerFloat64RoundTruncate(Node* node) {
 }
 
 Node* EffectControlLinearizer::LowerFindOrderedHashMapEntry(Node* node) {
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashMapEntry);
+  return BuildFindOrderedHashTableEntry(node, callable);
+}
+
+Node* EffectControlLinearizer::LowerFindOrderedHashSetEntry(Node* node) {
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashSetEntry);
+  return BuildFindOrderedHashTableEntry(node, callable);
+}
+
+Node* EffectControlLinearizer::LowerFindEphemeronHashTableEntry(Node* node) {
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kWeakMapLookupHashIndex);
+  return BuildFindOrderedHashTableEntry(node, callable);
+}
+
+Node* EffectControlLinearizer::BuildFindOrderedHashTableEntry(
+    Node* node, Callable const& callable) {
   Node* table = NodeProperties::GetValueInput(node, 0);
   Node* key = NodeProperties::GetValueInput(node, 1);
 
   {
-    Callable const callable =
-        Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashMapEntry);
     Operator::Properties const properties = node->op()->properties();
     CallDescriptor::Flags const flags = CallDescriptor::kNoFlags;
     auto call_descriptor = Linkage::GetStubCallDescriptor(
@@ -5234,7 +5532,8 @@ Node* EffectControlLinearizer::ComputeUnseededHash(Node* value) {
   return value;
 }
 
-Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
+template <typename CollectionType>
+Node* EffectControlLinearizer::BuildFindOrderedHashTableEntryForInt32Key(
     Node* node) {
   Node* table = NodeProperties::GetValueInput(node, 0);
   Node* key = NodeProperties::GetValueInput(node, 1);
@@ -5248,7 +5547,7 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   Node* first_entry = ChangeSmiToIntPtr(__ Load(
       MachineType::TaggedSigned(), table,
       __ IntAdd(__ WordShl(hash, __ IntPtrConstant(kTaggedSizeLog2)),
-                __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                __ IntPtrConstant(CollectionType::HashTableStartOffset() -
                                   kHeapObjectTag))));
 
   auto loop = __ MakeLoopLabel(MachineType::PointerRepresentation());
@@ -5258,16 +5557,16 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
   {
     Node* entry = loop.PhiAt(0);
     Node* check =
-        __ WordEqual(entry, __ IntPtrConstant(OrderedHashMap::kNotFound));
+        __ WordEqual(entry, __ IntPtrConstant(CollectionType::kNotFound));
     __ GotoIf(check, &done, entry);
     entry = __ IntAdd(
-        __ IntMul(entry, __ IntPtrConstant(OrderedHashMap::kEntrySize)),
+        __ IntMul(entry, __ IntPtrConstant(CollectionType::kEntrySize)),
         number_of_buckets);
 
     Node* candidate_key = __ Load(
         MachineType::AnyTagged(), table,
         __ IntAdd(__ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
-                  __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() -
+                  __ IntPtrConstant(CollectionType::HashTableStartOffset() -
                                     kHeapObjectTag)));
 
     auto if_match = __ MakeLabel();
@@ -5296,17 +5595,127 @@ Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
           MachineType::TaggedSigned(), table,
           __ IntAdd(
               __ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
-              __ IntPtrConstant(OrderedHashMap::HashTableStartOffset() +
-                                OrderedHashMap::kChainOffset * kTaggedSize -
+              __ IntPtrConstant(CollectionType::HashTableStartOffset() +
+                                CollectionType::kChainOffset * kTaggedSize -
+                                kHeapObjectTag))));
+      __ Goto(&loop, next_entry);
+    }
+  }
+
+  __ Bind(&done);
+  return done.PhiAt(0);
+}
+
+Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForInt32Key(
+    Node* node) {
+  return BuildFindOrderedHashTableEntryForInt32Key<OrderedHashMap>(node);
+}
+
+Node* EffectControlLinearizer::LowerFindOrderedHashSetEntryForInt32Key(
+    Node* node) {
+  return BuildFindOrderedHashTableEntryForInt32Key<OrderedHashSet>(node);
+}
+
+template <typename CollectionType>
+Node* EffectControlLinearizer::BuildFindOrderedHashTableEntryForStringKey(
+    Node* node, Callable const& callable) {
+  Node* table = NodeProperties::GetValueInput(node, 0);
+  Node* key = NodeProperties::GetValueInput(node, 1);
+
+  // Internalized strings always have their hash computed.
+  Node* hash = ChangeUint32ToUintPtr(
+      __ Word32Shr(__ LoadField(AccessBuilder::ForNameHashField(), key),
+                   __ Int32Constant(Name::kHashShift)));
+
+  Node* number_of_buckets = ChangeSmiToIntPtr(__ LoadField(
+      AccessBuilder::ForOrderedHashMapOrSetNumberOfBuckets(), table));
+  hash = __ WordAnd(hash, __ IntSub(number_of_buckets, __ IntPtrConstant(1)));
+  Node* first_entry = ChangeSmiToIntPtr(__ Load(
+      MachineType::TaggedSigned(), table,
+      __ IntAdd(__ WordShl(hash, __ IntPtrConstant(kTaggedSizeLog2)),
+                __ IntPtrConstant(CollectionType::HashTableStartOffset() -
+                                  kHeapObjectTag))));
+
+  auto loop = __ MakeLoopLabel(MachineType::PointerRepresentation());
+  auto if_slow = __ MakeDeferredLabel();
+  auto done = __ MakeLabel(MachineType::PointerRepresentation());
+  __ Goto(&loop, first_entry);
+  __ Bind(&loop);
+  {
+    Node* entry = loop.PhiAt(0);
+    Node* check =
+        __ WordEqual(entry, __ IntPtrConstant(CollectionType::kNotFound));
+    __ GotoIf(check, &done, entry);
+    entry = __ IntAdd(
+        __ IntMul(entry, __ IntPtrConstant(CollectionType::kEntrySize)),
+        number_of_buckets);
+
+    Node* candidate_key = __ Load(
+        MachineType::AnyTagged(), table,
+        __ IntAdd(__ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
+                  __ IntPtrConstant(CollectionType::HashTableStartOffset() -
+                                    kHeapObjectTag)));
+
+    auto if_match = __ MakeLabel();
+    auto if_notmatch = __ MakeLabel();
+    auto if_notidentical = __ MakeLabel();
+    __ Branch(__ WordEqual(candidate_key, key), &if_match, &if_notidentical);
+
+    // A string that is not internalized can still be equal to {key}, so
+    // leave comparing its contents to the builtin.
+    __ Bind(&if_notidentical);
+    __ GotoIf(ObjectIsSmi(candidate_key), &if_notmatch);
+    Node* candidate_instance_type = __ LoadField(
+        AccessBuilder::ForMapInstanceType(),
+        __ LoadField(AccessBuilder::ForMap(), candidate_key));
+    __ Branch(
+        __ Word32Equal(
+            __ Word32And(candidate_instance_type,
+                         __ Int32Constant(kIsNotStringMask |
+                                          kIsNotInternalizedMask)),
+            __ Int32Constant(kStringTag | kNotInternalizedTag)),
+        &if_slow, &if_notmatch);
+
+    __ Bind(&if_match);
+    __ Goto(&done, entry);
+
+    __ Bind(&if_notmatch);
+    {
+      Node* next_entry = ChangeSmiToIntPtr(__ Load(
+          MachineType::TaggedSigned(), table,
+          __ IntAdd(
+              __ WordShl(entry, __ IntPtrConstant(kTaggedSizeLog2)),
+              __ IntPtrConstant(CollectionType::HashTableStartOffset() +
+                                CollectionType::kChainOffset * kTaggedSize -
                                 kHeapObjectTag))));
       __ Goto(&loop, next_entry);
     }
   }
 
+  __ Bind(&if_slow);
+  __ Goto(&done,
+          ChangeSmiToIntPtr(BuildFindOrderedHashTableEntry(node, callable)));
+
   __ Bind(&done);
   return done.PhiAt(0);
 }
 
+Node* EffectControlLinearizer::LowerFindOrderedHashMapEntryForStringKey(
+    Node* node) {
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashMapEntry);
+  return BuildFindOrderedHashTableEntryForStringKey<OrderedHashMap>(node,
+                                                                    callable);
+}
+
+Node* EffectControlLinearizer::LowerFindOrderedHashSetEntryForStringKey(
+    Node* node) {
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kFindOrderedHashSetEntry);
+  return BuildFindOrderedHashTableEntryForStringKey<OrderedHashSet>(node,
+                                                                    callable);
+}
+
 Node* EffectControlLinearizer::LowerDateNow(Node* node) {
   Operator::Properties properties = Operator::kNoDeopt | Operator::kNoThrow;
   Runtime::FunctionId id = Runtime::kDateCurrentTime;
@@ -62,6 +62,8 @@ class V8_EXPORT_PRIVATE EffectControlLinearizer {
   Node* LowerChangeTaggedToInt64(Node* node);
   Node* LowerChangeTaggedToTaggedSigned(Node* node);
   Node* LowerPoisonIndex(Node* node);
+  Node* LowerCheckBigInt(Node* node, Node* frame_state);
+  Node* LowerCheckClosure(Node* node, Node* frame_state);
   Node* LowerCheckInternalizedString(Node* node, Node* frame_state);
   void LowerCheckMaps(Node* node, Node* frame_state);
   Node* LowerCompareMaps(Node* node);
@@ -145,6 +147,8 @@ class V8_EXPORT_PRIVATE EffectControlLinearizer {
   Node* LowerStringFromSingleCodePoint(Node* node);
   Node* LowerStringIndexOf(Node* node);
   Node* LowerStringSubstring(Node* node);
+  Node* LowerBigIntAsN64(Node* node, bool is_signed);
+  Node* LowerBigIntAsN64On32Bit(Node* node, bool is_signed);
   Node* LowerStringLength(Node* node);
   Node* LowerStringEqual(Node* node);
   Node* LowerStringLessThan(Node* node);
@@ -172,6 +176,11 @@ class V8_EXPORT_PRIVATE EffectControlLinearizer {
   void LowerStoreSignedSmallElement(Node* node);
   Node* LowerFindOrderedHashMapEntry(Node* node);
   Node* LowerFindOrderedHashMapEntryForInt32Key(Node* node);
+  Node* LowerFindOrderedHashMapEntryForStringKey(Node* node);
+  Node* LowerFindOrderedHashSetEntry(Node* node);
+  Node* LowerFindOrderedHashSetEntryForInt32Key(Node* node);
+  Node* LowerFindOrderedHashSetEntryForStringKey(Node* node);
+  Node* LowerFindEphemeronHashTableEntry(Node* node);
   void LowerTransitionAndStoreElement(Node* node);
   void LowerTransitionAndStoreNumberElement(Node* node);
   void LowerTransitionAndStoreNonNumberElement(Node* node);
@@ -186,6 +195,8 @@ class V8_EXPORT_PRIVATE EffectControlLinearizer {
   Maybe<Node*> LowerFloat64RoundTruncate(Node* node);
 
   Node* AllocateHeapNumberWithValue(Node* node);
+  Node* AllocateBigInt(Node* sign, Node* digit);
+  Node* AllocateBigIntWithTwoDigits(Node* sign, Node* low, Node* high);
   Node* BuildCheckedFloat64ToInt32(CheckForMinusZeroMode mode,
                                    const VectorSlotPair& feedback, Node* value,
                                    Node* frame_state);
@@ -201,6 +212,12 @@ class V8_EXPORT_PRIVATE EffectControlLinearizer {
   Node* BuildFloat64RoundTruncate(Node* input);
   Node* BuildUint32Mod(Node* lhs, Node* rhs);
   Node* ComputeUnseededHash(Node* value);
+  Node* BuildFindOrderedHashTableEntry(Node* node, Callable const& callable);
+  template <typename CollectionType>
+  Node* BuildFindOrderedHashTableEntryForInt32Key(Node* node);
+  template <typename CollectionType>
+  Node* BuildFindOrderedHashTableEntryForStringKey(Node* node,
+                                                   Callable const& callable);
   Node* LowerStringComparison(Callable const& callable, Node* node);
   Node* IsElementsKindGreaterThan(Node* kind, ElementsKind reference_kind);
 
@@ -520,6 +520,32 @@ Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   return Just(OffsetOfElementAt(ElementAccessOf(op), index));
 }
 
+// Arrays with up to this many elements are scalar replaced even if their
+// elements are loaded with a non-constant index.
+const int kMaxElementsForSelect = 8;
+
+// Collects the current values of the first {length} elements of {vobject}
+// into {values}. Returns false if any of the elements is not tracked or
+// might not match the element type of {access}. The values are nullptr if
+// the fixed-point has not been reached yet.
+bool GetElementValues(const VirtualObject* vobject, ElementAccess const& access,
+                      int length, EscapeAnalysisTracker::Scope* current,
+                      Node** values) {
+  DCHECK_LE(length, kMaxElementsForSelect);
+  for (int i = 0; i < length; ++i) {
+    Variable var;
+    if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+        !current->Get(var).To(&values[i])) {
+      return false;
+    }
+    if (values[i] != nullptr &&
+        !NodeProperties::GetType(values[i]).Is(access.type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Node* LowerCompareMapsWithoutLoad(Node* checked_map,
                                   ZoneHandleSet<Map> const& checked_against,
                                   JSGraph* jsgraph) {
@@ -592,6 +618,9 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         current->Set(var, value);
         current->MarkForDeletion();
       } else {
+        // Unlike LoadElement below, a store with a non-constant {index} is
+        // not turned into Selects, since that would create new nodes on
+        // every visit and never reach a fixed-point. The {object} escapes.
         current->SetEscaped(value);
         current->SetEscaped(object);
       }
@@ -629,52 +658,52 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
+        Node* values[kMaxElementsForSelect];
         if (length == 1 &&
-            vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
-            current->Get(var).To(&value) &&
-            (value == nullptr ||
-             NodeProperties::GetType(value).Is(access.type))) {
+            GetElementValues(vobject, access, length, current, values)) {
           // The {object} has no elements, and we know that the LoadElement
           // {index} must be within bounds, thus it must always yield this
           // one element of {object}.
-          current->SetReplacement(value);
+          current->SetReplacement(values[0]);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
-            current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
+        } else if (length >= 2 && length <= kMaxElementsForSelect &&
+                   GetElementValues(vobject, access, length, current,
+                                    values)) {
+          bool has_all_values = true;
+          for (int i = 0; i < length; ++i) {
+            if (values[i] == nullptr) has_all_values = false;
+          }
+          if (!has_all_values) {
             // If the variables have no values, we have
             // not reached the fixed-point yet.
             break;
           }
+          // The {object} has only a few elements, and the LoadElement
+          // {index} must be within bounds, so it must return one of them.
+          // We can turn the LoadElement into a chain of Select operations
+          // comparing the {index} against each element index instead (still
+          // allowing the {object} to be scalar replaced). We must however
+          // mark the elements of the {object} itself as escaping.
+          Node* select = values[length - 1];
+          for (int i = length - 2; i >= 0; --i) {
+            Node* element_index = jsgraph->Constant(i);
+            // The typer is gone at this point, so type new constants here.
+            if (!NodeProperties::IsTyped(element_index)) {
+              NodeProperties::SetType(
+                  element_index,
+                  Type::NewConstant(i, jsgraph->graph()->zone()));
+            }
+            Node* check = jsgraph->graph()->NewNode(
+                jsgraph->simplified()->NumberEqual(), index, element_index);
+            NodeProperties::SetType(check, Type::Boolean());
+            select = jsgraph->graph()->NewNode(
+                jsgraph->common()->Select(access.machine_type.representation()),
+                check, values[i], select);
+            NodeProperties::SetType(select, access.type);
+          }
+          current->SetReplacement(select);
+          for (int i = 0; i < length; ++i) current->SetEscaped(values[i]);
+          break;
         }
       }
       current->SetEscaped(object);
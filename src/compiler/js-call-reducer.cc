@@ -267,10 +267,25 @@ Reduction JSCallReducer::ReduceObjectConstructor(Node* node) {
   return NoChange();
 }
 
+namespace {
+
+// Returns the feedback of the call {p} to Function.prototype.apply,
+// Function.prototype.call or Reflect.apply for the call they forward to. The
+// interpreter records the forwarded target in the same feedback slot.
+VectorSlotPair ForwardedCallFeedback(CallParameters const& p) {
+  if (p.feedback_content() != CallFeedbackContent::kTarget) {
+    return VectorSlotPair();
+  }
+  return p.feedback();
+}
+
+}  // namespace
+
 // ES6 section 19.2.3.1 Function.prototype.apply ( thisArg, argArray )
 Reduction JSCallReducer::ReduceFunctionPrototypeApply(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
   CallParameters const& p = CallParametersOf(node->op());
+  VectorSlotPair const feedback = ForwardedCallFeedback(p);
   size_t arity = p.arity();
   DCHECK_LE(2u, arity);
   ConvertReceiverMode convert_mode = ConvertReceiverMode::kAny;
@@ -303,8 +318,10 @@ Reduction JSCallReducer::ReduceFunctionPrototypeApply(Node* node) {
       while (arity-- > 3) node->RemoveInput(3);
 
       // Morph the {node} to a {JSCallWithArrayLike}.
-      NodeProperties::ChangeOp(node,
-                               javascript()->CallWithArrayLike(p.frequency()));
+      NodeProperties::ChangeOp(
+          node, javascript()->CallWithArrayLike(
+                    p.frequency(), feedback,
+                    CallFeedbackContent::kForwardedTarget));
       Reduction const reduction = ReduceJSCallWithArrayLike(node);
       return reduction.Changed() ? reduction : Changed(node);
     } else {
@@ -331,8 +348,10 @@ Reduction JSCallReducer::ReduceFunctionPrototypeApply(Node* node) {
       Node* effect0 = effect;
       Node* control0 = control;
       Node* value0 = effect0 = control0 = graph()->NewNode(
-          javascript()->CallWithArrayLike(p.frequency()), target, this_argument,
-          arguments_list, context, frame_state, effect0, control0);
+          javascript()->CallWithArrayLike(
+              p.frequency(), feedback, CallFeedbackContent::kForwardedTarget),
+          target, this_argument, arguments_list, context, frame_state, effect0,
+          control0);
 
       // Lower to {JSCall} if {arguments_list} is either null or undefined.
       Node* effect1 = effect;
@@ -377,8 +396,9 @@ Reduction JSCallReducer::ReduceFunctionPrototypeApply(Node* node) {
   }
   // Change {node} to the new {JSCall} operator.
   NodeProperties::ChangeOp(
-      node,
-      javascript()->Call(arity, p.frequency(), VectorSlotPair(), convert_mode));
+      node, javascript()->Call(arity, p.frequency(), feedback, convert_mode,
+                               SpeculationMode::kDisallowSpeculation,
+                               CallFeedbackContent::kForwardedTarget));
   // Try to further reduce the JSCall {node}.
   Reduction const reduction = ReduceJSCall(node);
   return reduction.Changed() ? reduction : Changed(node);
@@ -531,8 +551,10 @@ Reduction JSCallReducer::ReduceFunctionPrototypeCall(Node* node) {
     --arity;
   }
   NodeProperties::ChangeOp(
-      node,
-      javascript()->Call(arity, p.frequency(), VectorSlotPair(), convert_mode));
+      node, javascript()->Call(arity, p.frequency(), ForwardedCallFeedback(p),
+                               convert_mode,
+                               SpeculationMode::kDisallowSpeculation,
+                               CallFeedbackContent::kForwardedTarget));
   // Try to further reduce the JSCall {node}.
   Reduction const reduction = ReduceJSCall(node);
   return reduction.Changed() ? reduction : Changed(node);
@@ -770,8 +792,10 @@ Reduction JSCallReducer::ReduceReflectApply(Node* node) {
   while (arity-- > 3) {
     node->RemoveInput(arity);
   }
-  NodeProperties::ChangeOp(node,
-                           javascript()->CallWithArrayLike(p.frequency()));
+  NodeProperties::ChangeOp(
+      node, javascript()->CallWithArrayLike(
+                p.frequency(), ForwardedCallFeedback(p),
+                CallFeedbackContent::kForwardedTarget));
   Reduction const reduction = ReduceJSCallWithArrayLike(node);
   return reduction.Changed() ? reduction : Changed(node);
 }
@@ -2980,7 +3004,7 @@ bool IsSafeArgumentsElements(Node* node) {
 
 Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
     Node* node, int arity, CallFrequency const& frequency,
-    VectorSlotPair const& feedback) {
+    VectorSlotPair const& feedback, CallFeedbackContent feedback_content) {
   DCHECK(node->opcode() == IrOpcode::kJSCallWithArrayLike ||
          node->opcode() == IrOpcode::kJSCallWithSpread ||
          node->opcode() == IrOpcode::kJSConstructWithArrayLike ||
@@ -3130,7 +3154,10 @@ Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
   if (node->opcode() == IrOpcode::kJSCallWithArrayLike ||
       node->opcode() == IrOpcode::kJSCallWithSpread) {
     NodeProperties::ChangeOp(
-        node, javascript()->Call(arity + 1, frequency, feedback));
+        node, javascript()->Call(arity + 1, frequency, feedback,
+                                 ConvertReceiverMode::kAny,
+                                 SpeculationMode::kDisallowSpeculation,
+                                 feedback_content));
     Reduction const reduction = ReduceJSCall(node);
     return reduction.Changed() ? reduction : Changed(node);
   } else {
@@ -3195,7 +3222,7 @@ namespace {
 
 bool ShouldUseCallICFeedback(Node* node) {
   HeapObjectMatcher m(node);
-  if (m.HasValue() || m.IsJSCreateClosure()) {
+  if (m.HasValue() || m.IsCheckClosure() || m.IsJSCreateClosure()) {
     // Don't use CallIC feedback when we know the function
     // being called, i.e. either know the closure itself or
     // at least the SharedFunctionInfo.
@@ -3340,6 +3367,14 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
     return NoChange();
   }
 
+  // The call feedback describes either the target of the call itself or, for
+  // calls to Function.prototype.apply, Function.prototype.call and
+  // Reflect.apply, the function they forward to; only use it for the call it
+  // describes.
+  if (nexus.GetCallFeedbackContent() != p.feedback_content()) {
+    return NoChange();
+  }
+
   base::Optional<HeapObjectRef> feedback =
       GetHeapObjectFeedback(broker(), nexus);
   if (feedback.has_value() && ShouldUseCallICFeedback(target) &&
@@ -3360,6 +3395,29 @@ Reduction JSCallReducer::ReduceJSCall(Node* node) {
     // Try to further reduce the JSCall {node}.
     Reduction const reduction = ReduceJSCall(node);
     return reduction.Changed() ? reduction : Changed(node);
+  } else if (feedback.has_value() && ShouldUseCallICFeedback(target) &&
+             feedback->IsFeedbackCell()) {
+    // The call site saw several closures created by the same closure
+    // instantiation site, which all share the same FeedbackCell.
+    FeedbackCellRef feedback_cell = feedback->AsFeedbackCell();
+    if (feedback_cell.value().IsFeedbackVector()) {
+      // Check that {target} is a closure with the given {feedback_cell},
+      // which uniquely identifies a given function inside a native context.
+      FeedbackVectorRef feedback_vector =
+          feedback_cell.value().AsFeedbackVector();
+      Node* target_closure = effect =
+          graph()->NewNode(simplified()->CheckClosure(feedback_cell.object()),
+                           target, effect, control);
+
+      // Specialize the JSCall node to the {target_closure}.
+      NodeProperties::ReplaceValueInput(node, target_closure, 0);
+      NodeProperties::ReplaceEffectInput(node, effect);
+
+      // Try to further reduce the JSCall {node}.
+      Reduction const reduction =
+          ReduceJSCall(node, feedback_vector.shared_function_info());
+      return reduction.Changed() ? reduction : Changed(node);
+    }
   }
 
   return NoChange();
@@ -3612,6 +3670,10 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceNumberIsNaN(node);
     case Builtins::kNumberParseInt:
       return ReduceNumberParseInt(node);
+    case Builtins::kBigIntAsIntN:
+      return ReduceBigIntAsN(node, Builtins::kBigIntAsIntN);
+    case Builtins::kBigIntAsUintN:
+      return ReduceBigIntAsN(node, Builtins::kBigIntAsUintN);
     case Builtins::kGlobalIsFinite:
       return ReduceGlobalIsFinite(node);
     case Builtins::kGlobalIsNaN:
@@ -3620,12 +3682,32 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceMapPrototypeGet(node);
     case Builtins::kMapPrototypeHas:
       return ReduceMapPrototypeHas(node);
+    case Builtins::kSetPrototypeHas:
+      return ReduceSetPrototypeHas(node);
+    case Builtins::kWeakMapGet:
+      return ReduceWeakMapPrototypeGet(node);
+    case Builtins::kWeakMapHas:
+      return ReduceWeakMapPrototypeHas(node);
+    case Builtins::kWeakSetHas:
+      return ReduceWeakSetPrototypeHas(node);
     case Builtins::kRegExpPrototypeTest:
       return ReduceRegExpPrototypeTest(node);
     case Builtins::kReturnReceiver:
       return ReduceReturnReceiver(node);
     case Builtins::kStringPrototypeIndexOf:
-      return ReduceStringPrototypeIndexOf(node);
+      return ReduceStringPrototypeIndexOfIncludes(SearchVariant::kIndexOf,
+                                                  node);
+    case Builtins::kStringPrototypeIncludes:
+      return ReduceStringPrototypeIndexOfIncludes(SearchVariant::kIncludes,
+                                                  node);
+    case Builtins::kStringPrototypeStartsWith:
+      return ReduceStringPrototypeStartsOrEndsWith(StringEnd::kStart, node);
+    case Builtins::kStringPrototypeEndsWith:
+      return ReduceStringPrototypeStartsOrEndsWith(StringEnd::kEnd, node);
+    case Builtins::kStringPrototypeSplit:
+      return ReduceStringPrototypeSplit(node);
+    case Builtins::kStringPrototypeTrim:
+      return ReduceStringPrototypeTrim(node);
     case Builtins::kStringPrototypeCharAt:
       return ReduceStringPrototypeCharAt(node);
     case Builtins::kStringPrototypeCharCodeAt:
@@ -3721,10 +3803,9 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
 
 Reduction JSCallReducer::ReduceJSCallWithArrayLike(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCallWithArrayLike, node->opcode());
-  CallFrequency frequency = CallFrequencyOf(node->op());
-  VectorSlotPair feedback;
-  return ReduceCallOrConstructWithArrayLikeOrSpread(node, 2, frequency,
-                                                    feedback);
+  CallParameters const& p = CallParametersOf(node->op());
+  return ReduceCallOrConstructWithArrayLikeOrSpread(
+      node, 2, p.frequency(), p.feedback(), p.feedback_content());
 }
 
 Reduction JSCallReducer::ReduceJSCallWithSpread(Node* node) {
@@ -3970,7 +4051,9 @@ Reduction JSCallReducer::ReduceJSConstruct(Node* node) {
 }
 
 // ES #sec-string.prototype.indexof
-Reduction JSCallReducer::ReduceStringPrototypeIndexOf(Node* node) {
+// ES #sec-string.prototype.includes
+Reduction JSCallReducer::ReduceStringPrototypeIndexOfIncludes(
+    SearchVariant search_variant, Node* node) {
   DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
   CallParameters const& p = CallParametersOf(node->op());
   if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
@@ -3996,18 +4079,210 @@ Reduction JSCallReducer::ReduceStringPrototypeIndexOf(Node* node) {
           simplified()->CheckSmi(p.feedback()), position, effect, control);
     }
 
-    NodeProperties::ReplaceEffectInput(node, effect);
-    RelaxEffectsAndControls(node);
-    node->ReplaceInput(0, new_receiver);
-    node->ReplaceInput(1, new_search_string);
-    node->ReplaceInput(2, new_position);
-    node->TrimInputCount(3);
-    NodeProperties::ChangeOp(node, simplified()->StringIndexOf());
-    return Changed(node);
+    Node* value =
+        graph()->NewNode(simplified()->StringIndexOf(), new_receiver,
+                         new_search_string, new_position);
+    if (search_variant == SearchVariant::kIncludes) {
+      value = graph()->NewNode(simplified()->NumberEqual(), value,
+                               jsgraph()->MinusOneConstant());
+      value = graph()->NewNode(simplified()->BooleanNot(), value);
+    }
+
+    ReplaceWithValue(node, value, effect, control);
+    return Replace(value);
   }
   return NoChange();
 }
 
+namespace {
+
+// Constant search strings up to this length are matched by startsWith and
+// endsWith with individual character comparisons.
+const int kMaxInlineMatchSequence = 3;
+
+}  // namespace
+
+// ES #sec-string.prototype.startswith
+// ES #sec-string.prototype.endswith
+Reduction JSCallReducer::ReduceStringPrototypeStartsOrEndsWith(
+    StringEnd string_end, Node* node) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  // We only optimize if we have target, receiver and search string, but
+  // no explicit position.
+  if (node->op()->ValueInputCount() != 3) return NoChange();
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* search_string = NodeProperties::GetValueInput(node, 2);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Match a constant {search_string} before it's hidden behind the
+  // CheckString below.
+  HeapObjectMatcher m(search_string);
+
+  // Ensure that both the {receiver} and the {search_string} are Strings;
+  // the latter also rules out the RegExp check of the specification.
+  receiver = effect = graph()->NewNode(simplified()->CheckString(p.feedback()),
+                                       receiver, effect, control);
+  search_string = effect =
+      graph()->NewNode(simplified()->CheckString(p.feedback()), search_string,
+                       effect, control);
+
+  Node* receiver_length =
+      graph()->NewNode(simplified()->StringLength(), receiver);
+  Node* search_length =
+      graph()->NewNode(simplified()->StringLength(), search_string);
+
+  // The {search_string} can only match if it fits into the {receiver}.
+  Node* check = graph()->NewNode(simplified()->NumberLessThanOrEqual(),
+                                 search_length, receiver_length);
+  Node* branch = graph()->NewNode(common()->Branch(), check, control);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = effect;
+  Node* vfalse = jsgraph()->FalseConstant();
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = effect;
+  Node* vtrue;
+  {
+    Node* start = string_end == StringEnd::kStart
+                      ? jsgraph()->ZeroConstant()
+                      : graph()->NewNode(simplified()->NumberSubtract(),
+                                         receiver_length, search_length);
+
+    if (m.HasValue() && m.Ref(broker()).IsString() &&
+        m.Ref(broker()).AsString().length() <= kMaxInlineMatchSequence) {
+      // Compare short constant {search_string}s character by character,
+      // which avoids materializing the substring of the {receiver}.
+      StringRef search = m.Ref(broker()).AsString();
+      vtrue = jsgraph()->TrueConstant();
+      for (int i = search.length() - 1; i >= 0; --i) {
+        Node* index = graph()->NewNode(simplified()->NumberAdd(), start,
+                                       jsgraph()->Constant(i));
+        Node* masked_index =
+            graph()->NewNode(simplified()->PoisonIndex(), index);
+        Node* char_code = etrue =
+            graph()->NewNode(simplified()->StringCharCodeAt(), receiver,
+                             masked_index, etrue, if_true);
+        Node* equal =
+            graph()->NewNode(simplified()->NumberEqual(), char_code,
+                             jsgraph()->Constant(search.GetChar(i).value()));
+        vtrue = graph()->NewNode(
+            common()->Select(MachineRepresentation::kTagged), equal, vtrue,
+            jsgraph()->FalseConstant());
+      }
+    } else {
+      Node* end = string_end == StringEnd::kStart ? search_length
+                                                  : receiver_length;
+      Node* substring = etrue =
+          graph()->NewNode(simplified()->StringSubstring(), receiver, start,
+                           end, etrue, if_true);
+      vtrue = graph()->NewNode(simplified()->StringEqual(), substring,
+                               search_string);
+    }
+  }
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+  Node* value = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), vtrue, vfalse, control);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
+// ES #sec-string.prototype.split
+Reduction JSCallReducer::ReduceStringPrototypeSplit(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  // We only optimize if we have target, receiver and separator, but no
+  // explicit limit.
+  if (node->op()->ValueInputCount() != 3) return NoChange();
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* separator = NodeProperties::GetValueInput(node, 2);
+  Node* context = NodeProperties::GetContextInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // String.prototype.split defers to {separator}[@@split] if present, so
+  // make sure that String separators don't find a @@split method on their
+  // prototype chain.
+  PropertyAccessInfo access_info;
+  AccessInfoFactory access_info_factory(
+      broker(), dependencies(), native_context().object(), graph()->zone());
+  if (!access_info_factory.ComputePropertyAccessInfo(
+          factory()->string_map(), factory()->split_symbol(),
+          AccessMode::kLoad, &access_info) ||
+      !access_info.IsNotFound()) {
+    return NoChange();
+  }
+  Handle<JSObject> holder;
+  if (access_info.holder().ToHandle(&holder)) {
+    dependencies()->DependOnStablePrototypeChains(
+        broker(), access_info.receiver_maps(), JSObjectRef(broker(), holder));
+  }
+
+  receiver = effect = graph()->NewNode(simplified()->CheckString(p.feedback()),
+                                       receiver, effect, control);
+  separator = effect = graph()->NewNode(
+      simplified()->CheckString(p.feedback()), separator, effect, control);
+
+  // Splitting a String at a String cannot run any user code, so the call
+  // to the stub doesn't need to be treated like an arbitrary JavaScript
+  // call by the rest of the pipeline.
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kStringSplit);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(), CallDescriptor::kNoFlags,
+      Operator::kEliminatable);
+  Node* value = effect = graph()->NewNode(
+      common()->Call(call_descriptor), jsgraph()->HeapConstant(callable.code()),
+      receiver, separator, context, effect, control);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
+// ES #sec-string.prototype.trim
+Reduction JSCallReducer::ReduceStringPrototypeTrim(Node* node) {
+  DCHECK_EQ(IrOpcode::kJSCall, node->opcode());
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* context = NodeProperties::GetContextInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  receiver = effect = graph()->NewNode(simplified()->CheckString(p.feedback()),
+                                       receiver, effect, control);
+
+  Callable const callable =
+      Builtins::CallableFor(isolate(), Builtins::kStringTrimWhitespace);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(), CallDescriptor::kNoFlags,
+      Operator::kEliminatable);
+  Node* value = effect = graph()->NewNode(
+      common()->Call(call_descriptor), jsgraph()->HeapConstant(callable.code()),
+      receiver, context, effect, control);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 // ES #sec-string.prototype.substring
 Reduction JSCallReducer::ReduceStringPrototypeSubstring(Node* node) {
   if (node->op()->ValueInputCount() < 3) return NoChange();
@@ -6282,6 +6557,27 @@ Reduction JSCallReducer::ReduceMapPrototypeGet(Node* node) {
 }
 
 Reduction JSCallReducer::ReduceMapPrototypeHas(Node* node) {
+  return ReduceCollectionPrototypeHas(node, JS_MAP_TYPE,
+                                      simplified()->FindOrderedHashMapEntry());
+}
+
+Reduction JSCallReducer::ReduceSetPrototypeHas(Node* node) {
+  return ReduceCollectionPrototypeHas(node, JS_SET_TYPE,
+                                      simplified()->FindOrderedHashSetEntry());
+}
+
+Reduction JSCallReducer::ReduceWeakMapPrototypeHas(Node* node) {
+  return ReduceCollectionPrototypeHas(
+      node, JS_WEAK_MAP_TYPE, simplified()->FindEphemeronHashTableEntry());
+}
+
+Reduction JSCallReducer::ReduceWeakSetPrototypeHas(Node* node) {
+  return ReduceCollectionPrototypeHas(
+      node, JS_WEAK_SET_TYPE, simplified()->FindEphemeronHashTableEntry());
+}
+
+Reduction JSCallReducer::ReduceCollectionPrototypeHas(
+    Node* node, InstanceType instance_type, const Operator* find_entry) {
   // We only optimize if we have target, receiver and key parameters.
   if (node->op()->ValueInputCount() != 3) return NoChange();
   Node* receiver = NodeProperties::GetValueInput(node, 1);
@@ -6290,15 +6586,15 @@ Reduction JSCallReducer::ReduceMapPrototypeHas(Node* node) {
   Node* key = NodeProperties::GetValueInput(node, 2);
 
   if (!NodeProperties::HasInstanceTypeWitness(broker(), receiver, effect,
-                                              JS_MAP_TYPE))
+                                              instance_type))
     return NoChange();
 
   Node* table = effect = graph()->NewNode(
       simplified()->LoadField(AccessBuilder::ForJSCollectionTable()), receiver,
       effect, control);
 
-  Node* index = effect = graph()->NewNode(
-      simplified()->FindOrderedHashMapEntry(), table, key, effect, control);
+  Node* index = effect =
+      graph()->NewNode(find_entry, table, key, effect, control);
 
   Node* value = graph()->NewNode(simplified()->NumberEqual(), index,
                                  jsgraph()->MinusOneConstant());
@@ -6308,6 +6604,55 @@ Reduction JSCallReducer::ReduceMapPrototypeHas(Node* node) {
   return Replace(value);
 }
 
+Reduction JSCallReducer::ReduceWeakMapPrototypeGet(Node* node) {
+  // We only optimize if we have target, receiver and key parameters.
+  if (node->op()->ValueInputCount() != 3) return NoChange();
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* key = NodeProperties::GetValueInput(node, 2);
+
+  if (!NodeProperties::HasInstanceTypeWitness(broker(), receiver, effect,
+                                              JS_WEAK_MAP_TYPE))
+    return NoChange();
+
+  Node* table = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSCollectionTable()), receiver,
+      effect, control);
+
+  // The EphemeronHashTable lookup yields the index of the value slot of the
+  // entry for {key} (or -1 if {key} is not present), so the value can be
+  // loaded straight from the table.
+  Node* index = effect =
+      graph()->NewNode(simplified()->FindEphemeronHashTableEntry(), table, key,
+                       effect, control);
+
+  Node* check = graph()->NewNode(simplified()->NumberEqual(), index,
+                                 jsgraph()->MinusOneConstant());
+
+  Node* branch = graph()->NewNode(common()->Branch(), check, control);
+
+  // Key not found.
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = effect;
+  Node* vtrue = jsgraph()->UndefinedConstant();
+
+  // Key found.
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = effect;
+  Node* vfalse = efalse = graph()->NewNode(
+      simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()), table,
+      index, efalse, if_false);
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  Node* value = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, 2), vtrue, vfalse, control);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 namespace {
 
 InstanceType InstanceTypeForCollectionKind(CollectionKind kind) {
@@ -6982,6 +7327,35 @@ Reduction JSCallReducer::ReduceNumberParseInt(Node* node) {
   return Changed(node);
 }
 
+// ES #sec-bigint.asintn
+// ES #sec-bigint.asuintn
+Reduction JSCallReducer::ReduceBigIntAsN(Node* node, Builtins::Name builtin) {
+  DCHECK(builtin == Builtins::kBigIntAsIntN ||
+         builtin == Builtins::kBigIntAsUintN);
+  CallParameters const& p = CallParametersOf(node->op());
+  if (p.speculation_mode() == SpeculationMode::kDisallowSpeculation) {
+    return NoChange();
+  }
+  if (node->op()->ValueInputCount() < 4) return NoChange();
+
+  // Only the 64 bit wide variants are lowered.
+  NumberMatcher bits(NodeProperties::GetValueInput(node, 2));
+  if (!bits.Is(64)) return NoChange();
+
+  Node* value = NodeProperties::GetValueInput(node, 3);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  value = effect = graph()->NewNode(simplified()->CheckBigInt(p.feedback()),
+                                    value, effect, control);
+  value = graph()->NewNode(builtin == Builtins::kBigIntAsIntN
+                               ? simplified()->BigIntAsIntN64()
+                               : simplified()->BigIntAsUintN64(),
+                           value);
+  ReplaceWithValue(node, value, effect);
+  return Replace(value);
+}
+
 Reduction JSCallReducer::ReduceRegExpPrototypeTest(Node* node) {
   if (FLAG_force_slow_path) return NoChange();
   if (node->op()->ValueInputCount() < 3) return NoChange();
@@ -103,7 +103,8 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
 
   Reduction ReduceCallOrConstructWithArrayLikeOrSpread(
       Node* node, int arity, CallFrequency const& frequency,
-      VectorSlotPair const& feedback);
+      VectorSlotPair const& feedback,
+      CallFeedbackContent feedback_content = CallFeedbackContent::kTarget);
   Reduction ReduceJSConstruct(Node* node);
   Reduction ReduceJSConstructWithArrayLike(Node* node);
   Reduction ReduceJSConstructWithSpread(Node* node);
@@ -113,7 +114,13 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceJSCallWithSpread(Node* node);
   Reduction ReduceRegExpPrototypeTest(Node* node);
   Reduction ReduceReturnReceiver(Node* node);
-  Reduction ReduceStringPrototypeIndexOf(Node* node);
+  Reduction ReduceStringPrototypeIndexOfIncludes(SearchVariant search_variant,
+                                                 Node* node);
+  enum class StringEnd { kStart, kEnd };
+  Reduction ReduceStringPrototypeStartsOrEndsWith(StringEnd string_end,
+                                                  Node* node);
+  Reduction ReduceStringPrototypeSplit(Node* node);
+  Reduction ReduceStringPrototypeTrim(Node* node);
   Reduction ReduceStringPrototypeSubstring(Node* node);
   Reduction ReduceStringPrototypeSlice(Node* node);
   Reduction ReduceStringPrototypeSubstr(Node* node);
@@ -163,6 +170,13 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
 
   Reduction ReduceMapPrototypeHas(Node* node);
   Reduction ReduceMapPrototypeGet(Node* node);
+  Reduction ReduceSetPrototypeHas(Node* node);
+  Reduction ReduceWeakMapPrototypeGet(Node* node);
+  Reduction ReduceWeakMapPrototypeHas(Node* node);
+  Reduction ReduceWeakSetPrototypeHas(Node* node);
+  Reduction ReduceCollectionPrototypeHas(Node* node,
+                                         InstanceType instance_type,
+                                         const Operator* find_entry);
   Reduction ReduceCollectionIteration(Node* node,
                                       CollectionKind collection_kind,
                                       IterationKind iteration_kind);
@@ -188,6 +202,8 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
 
   Reduction ReduceNumberConstructor(Node* node);
 
+  Reduction ReduceBigIntAsN(Node* node, Builtins::Name builtin);
+
   // Returns the updated {to} node, and updates control and effect along the
   // way.
   Node* DoFilterPostCallbackWork(ElementsKind kind, Node** control,
@@ -5,6 +5,7 @@
 #include "src/compiler/js-context-specialization.h"
 
 #include "src/compiler/common-operator.h"
+#include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/js-operator.h"
 #include "src/compiler/linkage.h"
@@ -149,7 +150,12 @@ Reduction JSContextSpecialization::ReduceJSLoadContext(Node* node) {
     concrete = concrete.previous();
   }
 
-  if (!access.immutable()) {
+  // Let bindings of script contexts that were not reassigned so far can be
+  // treated like immutable slots, guarded by a code dependency.
+  bool const script_context_const_slot =
+      !access.immutable() && FLAG_script_context_const_tracking &&
+      concrete.IsConstScriptContextSlot(static_cast<int>(access.index()));
+  if (!access.immutable() && !script_context_const_slot) {
     // We found the requested context object but since the context slot is
     // mutable we can only partially reduce the load.
     return SimplifyJSLoadContext(node, jsgraph()->Constant(concrete), depth);
@@ -176,6 +182,11 @@ Reduction JSContextSpecialization::ReduceJSLoadContext(Node* node) {
     return SimplifyJSLoadContext(node, jsgraph()->Constant(concrete), depth);
   }
 
+  if (script_context_const_slot) {
+    dependencies()->DependOnScriptContextSlot(
+        concrete, static_cast<int>(access.index()));
+  }
+
   // Success. The context load can be replaced with the constant.
   // TODO(titzer): record the specialization for sharing code across
   // multiple contexts that have the same value in the corresponding context
@@ -13,6 +13,7 @@ namespace internal {
 namespace compiler {
 
 // Forward declarations.
+class CompilationDependencies;
 class JSGraph;
 class JSOperatorBuilder;
 
@@ -32,16 +33,21 @@ struct OuterContext {
 //
 // The context can be the incoming function context or any outer context
 // thereof, as indicated by {outer}'s {distance}.
+//
+// Loads of let bindings from a script context are constant-folded as long as
+// the binding was not reassigned, recording that assumption in {dependencies}.
 class JSContextSpecialization final : public AdvancedReducer {
  public:
   JSContextSpecialization(Editor* editor, JSGraph* jsgraph,
                           JSHeapBroker* broker, Maybe<OuterContext> outer,
-                          MaybeHandle<JSFunction> closure)
+                          MaybeHandle<JSFunction> closure,
+                          CompilationDependencies* dependencies)
       : AdvancedReducer(editor),
         jsgraph_(jsgraph),
         outer_(outer),
         closure_(closure),
-        broker_(broker) {}
+        broker_(broker),
+        dependencies_(dependencies) {}
 
   const char* reducer_name() const override {
     return "JSContextSpecialization";
@@ -64,11 +70,13 @@ class JSContextSpecialization final : public AdvancedReducer {
   Maybe<OuterContext> outer() const { return outer_; }
   MaybeHandle<JSFunction> closure() const { return closure_; }
   JSHeapBroker* broker() const { return broker_; }
+  CompilationDependencies* dependencies() const { return dependencies_; }
 
   JSGraph* const jsgraph_;
   Maybe<OuterContext> outer_;
   MaybeHandle<JSFunction> closure_;
   JSHeapBroker* const broker_;
+  CompilationDependencies* const dependencies_;
 
   DISALLOW_COPY_AND_ASSIGN(JSContextSpecialization);
 };
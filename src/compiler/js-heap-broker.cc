@@ -406,14 +406,26 @@ class ContextData : public HeapObjectData {
     return previous_;
   }
 
+  bool IsConstScriptContextSlot(int index) const {
+    CHECK(serialized_);
+    if (index < Context::MIN_CONTEXT_SLOTS) return false;
+    size_t slot = static_cast<size_t>(index - Context::MIN_CONTEXT_SLOTS);
+    return slot < const_script_context_slots_.size() &&
+           const_script_context_slots_[slot];
+  }
+
  private:
   bool serialized_ = false;
   ContextData* previous_ = nullptr;
+  // For script contexts, whether each slot from MIN_CONTEXT_SLOTS on holds
+  // a let binding that was not reassigned so far.
+  ZoneVector<bool> const_script_context_slots_;
 };
 
 ContextData::ContextData(JSHeapBroker* broker, ObjectData** storage,
                          Handle<Context> object)
-    : HeapObjectData(broker, storage, object) {}
+    : HeapObjectData(broker, storage, object),
+      const_script_context_slots_(broker->zone()) {}
 
 void ContextData::Serialize(JSHeapBroker* broker) {
   if (serialized_) return;
@@ -428,6 +440,15 @@ void ContextData::Serialize(JSHeapBroker* broker) {
     previous_ = broker->GetOrCreateData(context->previous())->AsContext();
     previous_->Serialize(broker);
   }
+
+  DCHECK(const_script_context_slots_.empty());
+  if (context->IsScriptContext()) {
+    // The last slot of a script context holds its side table.
+    for (int i = Context::MIN_CONTEXT_SLOTS; i < context->length() - 1; ++i) {
+      const_script_context_slots_.push_back(
+          context->IsConstScriptContextSlot(i));
+    }
+  }
 }
 
 class NativeContextData : public ContextData {
@@ -469,6 +490,7 @@ class StringData : public NameData {
   base::Optional<double> to_number() const { return to_number_; }
   bool is_external_string() const { return is_external_string_; }
   bool is_seq_string() const { return is_seq_string_; }
+  base::Optional<uint16_t> GetChar(int index) const;
 
  private:
   int const length_;
@@ -476,8 +498,10 @@ class StringData : public NameData {
   base::Optional<double> to_number_;
   bool const is_external_string_;
   bool const is_seq_string_;
+  ZoneVector<uint16_t> chars_;
 
   static constexpr int kMaxLengthForDoubleConversion = 23;
+  static constexpr int kMaxLengthForChars = 8;
 };
 
 class SymbolData : public NameData {
@@ -492,11 +516,20 @@ StringData::StringData(JSHeapBroker* broker, ObjectData** storage,
       length_(object->length()),
       first_char_(length_ > 0 ? object->Get(0) : 0),
       is_external_string_(object->IsExternalString()),
-      is_seq_string_(object->IsSeqString()) {
+      is_seq_string_(object->IsSeqString()),
+      chars_(broker->zone()) {
   int flags = ALLOW_HEX | ALLOW_OCTAL | ALLOW_BINARY;
   if (length_ <= kMaxLengthForDoubleConversion) {
     to_number_ = StringToDouble(broker->isolate(), object, flags);
   }
+  if (length_ <= kMaxLengthForChars) {
+    for (int i = 0; i < length_; i++) chars_.push_back(object->Get(i));
+  }
+}
+
+base::Optional<uint16_t> StringData::GetChar(int index) const {
+  if (index >= static_cast<int>(chars_.size())) return base::nullopt;
+  return chars_[index];
 }
 
 class InternalizedStringData : public StringData {
@@ -919,6 +952,22 @@ class DescriptorArrayData : public HeapObjectData {
   ZoneVector<PropertyDescriptor> contents_;
 };
 
+class FeedbackCellData : public HeapObjectData {
+ public:
+  FeedbackCellData(JSHeapBroker* broker, ObjectData** storage,
+                   Handle<FeedbackCell> object);
+
+  HeapObjectData* value() const { return value_; }
+
+ private:
+  HeapObjectData* const value_;
+};
+
+FeedbackCellData::FeedbackCellData(JSHeapBroker* broker, ObjectData** storage,
+                                   Handle<FeedbackCell> object)
+    : HeapObjectData(broker, storage, object),
+      value_(broker->GetOrCreateData(object->value())->AsHeapObject()) {}
+
 class FeedbackVectorData : public HeapObjectData {
  public:
   const ZoneVector<ObjectData*>& feedback() { return feedback_; }
@@ -926,9 +975,14 @@ class FeedbackVectorData : public HeapObjectData {
   FeedbackVectorData(JSHeapBroker* broker, ObjectData** storage,
                      Handle<FeedbackVector> object);
 
+  SharedFunctionInfoData* shared_function_info() const {
+    return shared_function_info_;
+  }
+
   void SerializeSlots(JSHeapBroker* broker);
 
  private:
+  SharedFunctionInfoData* const shared_function_info_;
   bool serialized_ = false;
   ZoneVector<ObjectData*> feedback_;
 };
@@ -936,7 +990,11 @@ class FeedbackVectorData : public HeapObjectData {
 FeedbackVectorData::FeedbackVectorData(JSHeapBroker* broker,
                                        ObjectData** storage,
                                        Handle<FeedbackVector> object)
-    : HeapObjectData(broker, storage, object), feedback_(broker->zone()) {}
+    : HeapObjectData(broker, storage, object),
+      shared_function_info_(
+          broker->GetOrCreateData(object->shared_function_info())
+              ->AsSharedFunctionInfo()),
+      feedback_(broker->zone()) {}
 
 void FeedbackVectorData::SerializeSlots(JSHeapBroker* broker) {
   if (serialized_) return;
@@ -1565,6 +1623,14 @@ ObjectRef ContextRef::get(int index) const {
   return ObjectRef(broker(), value);
 }
 
+bool ContextRef::IsConstScriptContextSlot(int index) const {
+  if (broker()->mode() == JSHeapBroker::kDisabled) {
+    AllowHandleDereference handle_dereference;
+    return object()->IsConstScriptContextSlot(index);
+  }
+  return data()->AsContext()->IsConstScriptContextSlot(index);
+}
+
 JSHeapBroker::JSHeapBroker(Isolate* isolate, Zone* broker_zone)
     : isolate_(isolate),
       broker_zone_(broker_zone),
@@ -2139,6 +2205,16 @@ uint16_t StringRef::GetFirstChar() {
   return data()->AsString()->first_char();
 }
 
+base::Optional<uint16_t> StringRef::GetChar(int index) {
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, length());
+  if (broker()->mode() == JSHeapBroker::kDisabled) {
+    AllowHandleDereference allow_handle_dereference;
+    return object()->Get(index);
+  }
+  return data()->AsString()->GetChar(index);
+}
+
 base::Optional<double> StringRef::ToNumber() {
   if (broker()->mode() == JSHeapBroker::kDisabled) {
     AllowHandleDereference allow_handle_dereference;
@@ -2236,6 +2312,10 @@ BIMODAL_ACCESSOR_C(BytecodeArray, int, register_count)
 
 BIMODAL_ACCESSOR(Cell, Object, value)
 
+BIMODAL_ACCESSOR(FeedbackCell, HeapObject, value)
+
+BIMODAL_ACCESSOR(FeedbackVector, SharedFunctionInfo, shared_function_info)
+
 BIMODAL_ACCESSOR(HeapObject, Map, map)
 
 BIMODAL_ACCESSOR(JSArray, Object, length)
@@ -74,6 +74,7 @@ enum class OddballType : uint8_t {
   V(Cell)                          \
   V(Code)                          \
   V(DescriptorArray)               \
+  V(FeedbackCell)                  \
   V(FeedbackVector)                \
   V(FixedArrayBase)                \
   V(HeapNumber)                    \
@@ -286,6 +287,10 @@ class ContextRef : public HeapObjectRef {
   void Serialize();
   ContextRef previous() const;
   ObjectRef get(int index) const;
+
+  // Whether the let binding at {index} of this script context was never
+  // reassigned after its initialization.
+  bool IsConstScriptContextSlot(int index) const;
 };
 
 #define BROKER_COMPULSORY_NATIVE_CONTEXT_FIELDS(V)                    \
@@ -377,11 +382,20 @@ class DescriptorArrayRef : public HeapObjectRef {
   Handle<DescriptorArray> object() const;
 };
 
+class FeedbackCellRef : public HeapObjectRef {
+ public:
+  using HeapObjectRef::HeapObjectRef;
+  Handle<FeedbackCell> object() const;
+
+  HeapObjectRef value() const;
+};
+
 class FeedbackVectorRef : public HeapObjectRef {
  public:
   using HeapObjectRef::HeapObjectRef;
   Handle<FeedbackVector> object() const;
 
+  SharedFunctionInfoRef shared_function_info() const;
   ObjectRef get(FeedbackSlot slot) const;
 
   void SerializeSlots();
@@ -550,6 +564,9 @@ class StringRef : public NameRef {
 
   int length() const;
   uint16_t GetFirstChar();
+  // Returns the character at {index}. When the broker is enabled, only the
+  // characters of short strings are serialized.
+  base::Optional<uint16_t> GetChar(int index);
   base::Optional<double> ToNumber();
   bool IsSeqString() const;
   bool IsExternalString() const;
@@ -57,6 +57,19 @@ int CollectFunctions(Node* node, Handle<JSFunction>* functions,
     }
     return 1;
   }
+  if (m.IsCheckClosure()) {
+    // Closures that share a feedback cell also share their feedback vector,
+    // which identifies their SharedFunctionInfo.
+    Handle<FeedbackCell> cell = FeedbackCellOf(m.op());
+    if (!cell->value()->IsFeedbackVector()) return 0;
+    functions[0] = Handle<JSFunction>::null();
+    shared = handle(
+        FeedbackVector::cast(cell->value())->shared_function_info(), isolate);
+    if (shared->HasBytecodeArray()) {
+      bytecode[0] = handle(shared->GetBytecodeArray(), isolate);
+    }
+    return 1;
+  }
   return 0;
 }
 
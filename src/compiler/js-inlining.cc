@@ -6,6 +6,7 @@
 
 #include "src/ast/ast.h"
 #include "src/compiler.h"
+#include "src/compiler/access-builder.h"
 #include "src/compiler/all-nodes.h"
 #include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/common-operator.h"
@@ -327,6 +328,18 @@ bool JSInliner::DetermineCallTarget(
     return true;
   }
 
+  // This reducer can also handle calls where the target is known to be a
+  // closure with a given feedback cell, as follows:
+  //  - JSCall(CheckClosure[feedback_cell](target), receiver, args...)
+  if (match.IsCheckClosure()) {
+    Handle<FeedbackCell> cell = FeedbackCellOf(match.op());
+    if (!cell->value()->IsFeedbackVector()) return false;
+
+    shared_info_out = handle(
+        FeedbackVector::cast(cell->value())->shared_function_info(), isolate());
+    return true;
+  }
+
   return false;
 }
 
@@ -366,6 +379,23 @@ void JSInliner::DetermineCallContext(
     return;
   }
 
+  if (match.IsCheckClosure()) {
+    Handle<FeedbackCell> cell = FeedbackCellOf(match.op());
+    DCHECK(cell->value()->IsFeedbackVector());
+
+    // The inlinee uses the context of the closure, which we load after the
+    // check that it is a closure with the expected feedback cell.
+    Node* effect = NodeProperties::GetEffectInput(node);
+    Node* control = NodeProperties::GetControlInput(node);
+    context_out = effect = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSFunctionContext()),
+        match.node(), effect, control);
+    NodeProperties::ReplaceEffectInput(node, effect);
+    feedback_vector_out =
+        handle(FeedbackVector::cast(cell->value()), isolate());
+    return;
+  }
+
   // Must succeed.
   UNREACHABLE();
 }
@@ -1028,6 +1028,13 @@ Reduction JSNativeContextSpecialization::ReduceJSStoreGlobal(Node* node) {
         result->immutable) {
       return NoChange();
     }
+    // Reassigning a let binding that optimized code may have constant-folded
+    // has to go through the IC, which deoptimizes that code.
+    result->context.Serialize();  // TODO(neis): Remove later.
+    if (FLAG_script_context_const_tracking &&
+        result->context.IsConstScriptContextSlot(result->index)) {
+      return NoChange();
+    }
     Node* context = jsgraph()->Constant(result->context);
     effect = graph()->NewNode(javascript()->StoreContext(0, result->index),
                               value, context, effect, control);
@@ -23,8 +23,7 @@ std::ostream& operator<<(std::ostream& os, CallFrequency f) {
 }
 
 CallFrequency CallFrequencyOf(Operator const* op) {
-  DCHECK(op->opcode() == IrOpcode::kJSCallWithArrayLike ||
-         op->opcode() == IrOpcode::kJSConstructWithArrayLike);
+  DCHECK_EQ(IrOpcode::kJSConstructWithArrayLike, op->opcode());
   return OpParameter<CallFrequency>(op);
 }
 
@@ -71,6 +70,7 @@ std::ostream& operator<<(std::ostream& os, CallParameters const& p) {
 
 const CallParameters& CallParametersOf(const Operator* op) {
   DCHECK(op->opcode() == IrOpcode::kJSCall ||
+         op->opcode() == IrOpcode::kJSCallWithArrayLike ||
          op->opcode() == IrOpcode::kJSCallWithSpread);
   return OpParameter<CallParameters>(op);
 }
@@ -832,11 +832,12 @@ const Operator* JSOperatorBuilder::Call(size_t arity,
                                         CallFrequency const& frequency,
                                         VectorSlotPair const& feedback,
                                         ConvertReceiverMode convert_mode,
-                                        SpeculationMode speculation_mode) {
+                                        SpeculationMode speculation_mode,
+                                        CallFeedbackContent feedback_content) {
   DCHECK_IMPLIES(speculation_mode == SpeculationMode::kAllowSpeculation,
                  feedback.IsValid());
   CallParameters parameters(arity, frequency, feedback, convert_mode,
-                            speculation_mode);
+                            speculation_mode, feedback_content);
   return new (zone()) Operator1<CallParameters>(   // --
       IrOpcode::kJSCall, Operator::kNoProperties,  // opcode
       "JSCall",                                    // name
@@ -844,12 +845,17 @@ const Operator* JSOperatorBuilder::Call(size_t arity,
       parameters);                                 // parameter
 }
 
-const Operator* JSOperatorBuilder::CallWithArrayLike(CallFrequency frequency) {
-  return new (zone()) Operator1<CallFrequency>(                 // --
+const Operator* JSOperatorBuilder::CallWithArrayLike(
+    CallFrequency const& frequency, VectorSlotPair const& feedback,
+    CallFeedbackContent feedback_content) {
+  CallParameters parameters(3, frequency, feedback, ConvertReceiverMode::kAny,
+                            SpeculationMode::kDisallowSpeculation,
+                            feedback_content);
+  return new (zone()) Operator1<CallParameters>(                // --
       IrOpcode::kJSCallWithArrayLike, Operator::kNoProperties,  // opcode
       "JSCallWithArrayLike",                                    // name
       3, 1, 1, 1, 1, 2,                                         // counts
-      frequency);                                               // parameter
+      parameters);                                              // parameter
 }
 
 const Operator* JSOperatorBuilder::CallWithSpread(
@@ -159,16 +159,20 @@ CallForwardVarargsParameters const& CallForwardVarargsParametersOf(
     Operator const*) V8_WARN_UNUSED_RESULT;
 
 // Defines the arity and the call flags for a JavaScript function call. This is
-// used as a parameter by JSCall and JSCallWithSpread operators.
+// used as a parameter by JSCall, JSCallWithArrayLike and JSCallWithSpread
+// operators. The {feedback_content} tells which content of the {feedback}
+// describes the target of the call.
 class CallParameters final {
  public:
-  CallParameters(size_t arity, CallFrequency const& frequency,
-                 VectorSlotPair const& feedback,
-                 ConvertReceiverMode convert_mode,
-                 SpeculationMode speculation_mode)
+  CallParameters(
+      size_t arity, CallFrequency const& frequency,
+      VectorSlotPair const& feedback, ConvertReceiverMode convert_mode,
+      SpeculationMode speculation_mode,
+      CallFeedbackContent feedback_content = CallFeedbackContent::kTarget)
       : bit_field_(ArityField::encode(arity) |
                    SpeculationModeField::encode(speculation_mode) |
-                   ConvertReceiverModeField::encode(convert_mode)),
+                   ConvertReceiverModeField::encode(convert_mode) |
+                   CallFeedbackContentField::encode(feedback_content)),
         frequency_(frequency),
         feedback_(feedback) {}
 
@@ -183,6 +187,10 @@ class CallParameters final {
     return SpeculationModeField::decode(bit_field_);
   }
 
+  CallFeedbackContent feedback_content() const {
+    return CallFeedbackContentField::decode(bit_field_);
+  }
+
   bool operator==(CallParameters const& that) const {
     return this->bit_field_ == that.bit_field_ &&
            this->frequency_ == that.frequency_ &&
@@ -198,6 +206,7 @@ class CallParameters final {
   typedef BitField<size_t, 0, 28> ArityField;
   typedef BitField<SpeculationMode, 28, 1> SpeculationModeField;
   typedef BitField<ConvertReceiverMode, 29, 2> ConvertReceiverModeField;
+  typedef BitField<CallFeedbackContent, 31, 1> CallFeedbackContentField;
 
   uint32_t const bit_field_;
   CallFrequency const frequency_;
@@ -755,8 +764,12 @@ class V8_EXPORT_PRIVATE JSOperatorBuilder final
       size_t arity, CallFrequency const& frequency = CallFrequency(),
       VectorSlotPair const& feedback = VectorSlotPair(),
       ConvertReceiverMode convert_mode = ConvertReceiverMode::kAny,
-      SpeculationMode speculation_mode = SpeculationMode::kDisallowSpeculation);
-  const Operator* CallWithArrayLike(CallFrequency frequency);
+      SpeculationMode speculation_mode = SpeculationMode::kDisallowSpeculation,
+      CallFeedbackContent feedback_content = CallFeedbackContent::kTarget);
+  const Operator* CallWithArrayLike(
+      CallFrequency const& frequency,
+      VectorSlotPair const& feedback = VectorSlotPair(),
+      CallFeedbackContent feedback_content = CallFeedbackContent::kTarget);
   const Operator* CallWithSpread(
       uint32_t arity, CallFrequency const& frequency = CallFrequency(),
       VectorSlotPair const& feedback = VectorSlotPair(),
@@ -0,0 +1,428 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+
+#include <cmath>
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/conversions-inl.h"
+#include "src/flags.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+LoopVectorizationAnalysis::LoopVectorizationAnalysis(Graph* graph,
+                                                     LoopTree* loop_tree,
+                                                     Zone* zone)
+    : graph_(graph), loop_tree_(loop_tree), candidates_(zone) {}
+
+void LoopVectorizationAnalysis::Run() {
+  AnalyzeLoops(loop_tree_->outer_loops());
+  TRACE("Found %zu vectorizable loop(s) in graph with %zu nodes\n",
+        candidates_.size(), graph_->NodeCount());
+}
+
+void LoopVectorizationAnalysis::AnalyzeLoops(
+    const ZoneVector<LoopTree::Loop*>& loops) {
+  for (LoopTree::Loop* loop : loops) {
+    if (!loop->children().empty()) {
+      AnalyzeLoops(loop->children());
+      continue;
+    }
+    Candidate candidate;
+    Verdict verdict = Analyze(loop, &candidate);
+    TRACE("Loop #%d (header #%d, %zu body nodes): %s\n",
+          loop_tree_->LoopNum(loop), candidate.loop_node->id(),
+          loop->BodySize(), VerdictToString(verdict));
+    if (verdict != Verdict::kVectorizable) continue;
+    TRACE(
+        "  induction variable #%d, %d lanes, %d load(s), %d store(s), "
+        "%d reduction(s)%s\n",
+        candidate.induction_phi->id(), candidate.lanes, candidate.loads,
+        candidate.stores, candidate.reductions,
+        candidate.needs_alias_check ? ", needs alias check" : "");
+    candidates_.push_back(candidate);
+  }
+}
+
+// static
+int LoopVectorizationAnalysis::LanesFor(ExternalArrayType type) {
+  switch (type) {
+    case kExternalInt8Array:
+    case kExternalUint8Array:
+      return 16;
+    case kExternalInt16Array:
+    case kExternalUint16Array:
+      return 8;
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+    case kExternalFloat32Array:
+      return 4;
+    case kExternalFloat64Array:
+    case kExternalUint8ClampedArray:
+    case kExternalBigInt64Array:
+    case kExternalBigUint64Array:
+      // There are no F64x2 / I64x2 machine operators, and clamping stores
+      // have no lane-wise equivalent.
+      return 0;
+  }
+  UNREACHABLE();
+}
+
+bool LoopVectorizationAnalysis::IsInductionPhi(Node* phi,
+                                               Node* loop_node) const {
+  if (phi->opcode() != IrOpcode::kPhi) return false;
+  if (PhiRepresentationOf(phi->op()) != MachineRepresentation::kWord32) {
+    return false;
+  }
+  if (NodeProperties::GetControlInput(phi) != loop_node) return false;
+  Node* const arith = phi->InputAt(1);
+  switch (arith->opcode()) {
+    case IrOpcode::kInt32Add: {
+      Int32BinopMatcher m(arith);
+      return m.left().node() == phi && m.right().Is(1);
+    }
+    case IrOpcode::kCheckedInt32Add: {
+      Int32Matcher m(arith->InputAt(1));
+      return arith->InputAt(0) == phi && m.Is(1);
+    }
+    default:
+      return false;
+  }
+}
+
+bool LoopVectorizationAnalysis::IsIntegerAddReduction(
+    Node* phi, LoopTree::Loop* loop) const {
+  if (phi->opcode() != IrOpcode::kPhi) return false;
+  if (PhiRepresentationOf(phi->op()) != MachineRepresentation::kWord32) {
+    return false;
+  }
+  Node* const loop_node = loop_tree_->GetLoopControl(loop);
+  if (NodeProperties::GetControlInput(phi) != loop_node) return false;
+  // Only wrapping additions can be reassociated; {CheckedInt32Add} would
+  // have to deoptimize on exactly the same iteration as the scalar loop.
+  Node* const arith = phi->InputAt(1);
+  if (arith->opcode() != IrOpcode::kInt32Add) return false;
+  Int32BinopMatcher m(arith);
+  if (m.left().node() != phi && m.right().node() != phi) return false;
+  // The partial sums must not be observable inside the loop.
+  for (Node* use : phi->uses()) {
+    if (use == arith) continue;
+    if (use->opcode() == IrOpcode::kFrameState ||
+        use->opcode() == IrOpcode::kStateValues ||
+        use->opcode() == IrOpcode::kTypedStateValues) {
+      continue;
+    }
+    if (loop_tree_->Contains(loop, use)) return false;
+  }
+  return true;
+}
+
+bool LoopVectorizationAnalysis::IsLoopInvariant(Node* node,
+                                                LoopTree::Loop* loop) const {
+  return !loop_tree_->Contains(loop, node);
+}
+
+bool LoopVectorizationAnalysis::HasFloat32Inputs(Node* node) const {
+  for (Node* input : node->inputs()) {
+    if (input->opcode() == IrOpcode::kChangeFloat32ToFloat64) continue;
+    Float64Matcher m(input);
+    if (!m.HasValue()) return false;
+    double const value = m.Value();
+    if (!std::isnan(value) && DoubleToFloat32(value) != value) return false;
+  }
+  return true;
+}
+
+bool LoopVectorizationAnalysis::IsLoopBoundCheck(Node* branch,
+                                                 Node* induction_phi,
+                                                 LoopTree::Loop* loop) const {
+  // The condition must compare the induction variable, or its value for the
+  // next iteration, against a loop invariant upper bound.
+  Node* const cond = NodeProperties::GetValueInput(branch, 0);
+  switch (cond->opcode()) {
+    case IrOpcode::kInt32LessThan:
+    case IrOpcode::kInt32LessThanOrEqual:
+    case IrOpcode::kUint32LessThan:
+    case IrOpcode::kUint32LessThanOrEqual:
+      break;
+    default:
+      return false;
+  }
+  Node* const lhs = NodeProperties::GetValueInput(cond, 0);
+  Node* const rhs = NodeProperties::GetValueInput(cond, 1);
+  if (lhs != induction_phi && lhs != induction_phi->InputAt(1)) return false;
+  if (!IsLoopInvariant(rhs, loop)) return false;
+  // The loop must be continued on the true projection, i.e. it runs while
+  // the induction variable is below the bound.
+  Node* const loop_node = loop_tree_->GetLoopControl(loop);
+  for (Node* control = NodeProperties::GetControlInput(loop_node, 1);
+       control != loop_node;
+       control = NodeProperties::GetControlInput(control)) {
+    if (control->op()->ControlInputCount() != 1) return false;
+    if (NodeProperties::GetControlInput(control) == branch) {
+      return control->opcode() == IrOpcode::kIfTrue;
+    }
+  }
+  return false;
+}
+
+LoopVectorizationAnalysis::Verdict
+LoopVectorizationAnalysis::AnalyzeElementAccess(Node* node,
+                                                Node* induction_phi,
+                                                LoopTree::Loop* loop,
+                                                Candidate* candidate) {
+  ExternalArrayType const type = ExternalArrayTypeOf(node->op());
+  int const lanes = LanesFor(type);
+  if (lanes == 0) return Verdict::kUnsupportedElementType;
+  if (candidate->lanes == 0) {
+    candidate->element_type = type;
+    candidate->lanes = lanes;
+  } else if (candidate->element_type != type) {
+    return Verdict::kMixedElementTypes;
+  }
+  // The {buffer}, {base} and {external} inputs must be loop invariant, so
+  // that consecutive iterations access consecutive memory locations.
+  for (int i = 0; i < 3; ++i) {
+    if (!IsLoopInvariant(NodeProperties::GetValueInput(node, i), loop)) {
+      return Verdict::kVariantBackingStore;
+    }
+  }
+  Node* index = NodeProperties::GetValueInput(node, 3);
+  if (index->opcode() == IrOpcode::kCheckedUint32Bounds) {
+    index = NodeProperties::GetValueInput(index, 0);
+  }
+  if (index != induction_phi) return Verdict::kNonInductionIndex;
+  return Verdict::kVectorizable;
+}
+
+LoopVectorizationAnalysis::Verdict LoopVectorizationAnalysis::Analyze(
+    LoopTree::Loop* loop, Candidate* candidate) {
+  Node* const loop_node = loop_tree_->GetLoopControl(loop);
+  candidate->loop = loop;
+  candidate->loop_node = loop_node;
+  candidate->induction_phi = nullptr;
+  candidate->element_type = kExternalInt8Array;
+  candidate->lanes = 0;
+  candidate->loads = 0;
+  candidate->stores = 0;
+  candidate->reductions = 0;
+  candidate->needs_alias_check = false;
+
+  if (loop->TotalSize() > kMaxBodySize) return Verdict::kTooLarge;
+  if (loop_node->InputCount() != 2) return Verdict::kMultipleBlocks;
+
+  // Find the induction variable first; all element accesses are checked
+  // against it below.
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    if (IsInductionPhi(node, loop_node)) {
+      candidate->induction_phi = node;
+      break;
+    }
+  }
+  if (candidate->induction_phi == nullptr) {
+    for (Node* node : loop_tree_->HeaderNodes(loop)) {
+      if (node->opcode() == IrOpcode::kPhi &&
+          PhiRepresentationOf(node->op()) == MachineRepresentation::kWord32 &&
+          (node->InputAt(1)->opcode() == IrOpcode::kInt32Add ||
+           node->InputAt(1)->opcode() == IrOpcode::kCheckedInt32Add)) {
+        return Verdict::kNonUnitStride;
+      }
+    }
+    return Verdict::kNoInductionVariable;
+  }
+
+  Node* first_access = nullptr;
+  bool distinct_buffers = false;
+  int branches = 0;
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    switch (node->opcode()) {
+      // Control structure of a single-block loop.
+      case IrOpcode::kLoop:
+      case IrOpcode::kEffectPhi:
+      case IrOpcode::kIfTrue:
+      case IrOpcode::kIfFalse:
+      case IrOpcode::kLoopExit:
+      case IrOpcode::kLoopExitValue:
+      case IrOpcode::kLoopExitEffect:
+        break;
+      case IrOpcode::kBranch:
+        if (++branches > 1) return Verdict::kMultipleBlocks;
+        if (!IsLoopBoundCheck(node, candidate->induction_phi, loop)) {
+          return Verdict::kUnsupportedLoopCondition;
+        }
+        break;
+      case IrOpcode::kMerge:
+      case IrOpcode::kSwitch:
+        return Verdict::kMultipleBlocks;
+
+      case IrOpcode::kPhi:
+        if (node == candidate->induction_phi) break;
+        if (!IsIntegerAddReduction(node, loop)) {
+          return Verdict::kUnsupportedReduction;
+        }
+        candidate->reductions++;
+        break;
+
+      // Deoptimization support; the vector loop keeps one checkpoint and one
+      // stack check per vector iteration and falls back to the scalar
+      // epilogue for the remaining iterations.
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kFrameState:
+      case IrOpcode::kStateValues:
+      case IrOpcode::kTypedStateValues:
+      case IrOpcode::kJSStackCheck:
+      case IrOpcode::kTypeGuard:
+        break;
+
+      case IrOpcode::kCheckedInt32Add:
+        if (node != candidate->induction_phi->InputAt(1)) {
+          return Verdict::kUnsupportedOperation;
+        }
+        break;
+      case IrOpcode::kCheckedUint32Bounds:
+        if (NodeProperties::GetValueInput(node, 0) !=
+                candidate->induction_phi ||
+            !IsLoopInvariant(NodeProperties::GetValueInput(node, 1), loop)) {
+          return Verdict::kNonInductionIndex;
+        }
+        break;
+      case IrOpcode::kLoadField:
+        if (!IsLoopInvariant(NodeProperties::GetValueInput(node, 0), loop)) {
+          return Verdict::kUnsupportedOperation;
+        }
+        break;
+
+      case IrOpcode::kLoadTypedElement:
+      case IrOpcode::kStoreTypedElement: {
+        Verdict verdict = AnalyzeElementAccess(node, candidate->induction_phi,
+                                               loop, candidate);
+        if (verdict != Verdict::kVectorizable) return verdict;
+        // Accesses with the same {buffer}, {base} and {external} inputs go
+        // to the same typed array.
+        if (first_access == nullptr) first_access = node;
+        for (int i = 0; i < 3; ++i) {
+          distinct_buffers |= NodeProperties::GetValueInput(node, i) !=
+                              NodeProperties::GetValueInput(first_access, i);
+        }
+        if (node->opcode() == IrOpcode::kLoadTypedElement) {
+          candidate->loads++;
+        } else {
+          candidate->stores++;
+        }
+        break;
+      }
+
+      // Pure operations with a lane-wise SIMD equivalent.
+      case IrOpcode::kInt32Add:
+      case IrOpcode::kInt32Sub:
+      case IrOpcode::kInt32Mul:
+      case IrOpcode::kWord32And:
+      case IrOpcode::kWord32Or:
+      case IrOpcode::kWord32Xor:
+      case IrOpcode::kInt32LessThan:
+      case IrOpcode::kInt32LessThanOrEqual:
+      case IrOpcode::kUint32LessThan:
+      case IrOpcode::kUint32LessThanOrEqual:
+      case IrOpcode::kWord32Equal:
+      case IrOpcode::kFloat32Add:
+      case IrOpcode::kFloat32Sub:
+      case IrOpcode::kFloat32Mul:
+      case IrOpcode::kFloat32Div:
+      case IrOpcode::kFloat32Abs:
+      case IrOpcode::kFloat32Neg:
+      case IrOpcode::kChangeFloat32ToFloat64:
+      case IrOpcode::kTruncateFloat64ToFloat32:
+        break;
+      // Float32 arithmetic is performed on float64 values in JavaScript, but
+      // rounding the float64 result of an addition, subtraction,
+      // multiplication or division of two float32 values back to float32
+      // yields the same value as the float32 operation. That does not hold
+      // for other float64 inputs, such as the unrounded result of another
+      // operation.
+      case IrOpcode::kFloat64Add:
+      case IrOpcode::kFloat64Sub:
+      case IrOpcode::kFloat64Mul:
+      case IrOpcode::kFloat64Div:
+      case IrOpcode::kFloat64Abs:
+      case IrOpcode::kFloat64Neg:
+        if (!HasFloat32Inputs(node)) return Verdict::kFloat64Operands;
+        break;
+      case IrOpcode::kWord32Shl:
+      case IrOpcode::kWord32Shr:
+      case IrOpcode::kWord32Sar: {
+        // SIMD shifts only take an immediate shift amount.
+        Int32BinopMatcher m(node);
+        if (!m.right().HasValue()) return Verdict::kUnsupportedOperation;
+        break;
+      }
+
+      default:
+        TRACE("  unsupported node #%d:%s\n", node->id(),
+              node->op()->mnemonic());
+        return Verdict::kUnsupportedOperation;
+    }
+  }
+
+  if (branches == 0) return Verdict::kUnsupportedLoopCondition;
+  if (candidate->loads + candidate->stores == 0) {
+    return Verdict::kNoTypedArrayAccess;
+  }
+  candidate->needs_alias_check = candidate->stores > 0 && distinct_buffers;
+  return Verdict::kVectorizable;
+}
+
+// static
+const char* LoopVectorizationAnalysis::VerdictToString(Verdict verdict) {
+  switch (verdict) {
+    case Verdict::kVectorizable:
+      return "vectorizable";
+    case Verdict::kTooLarge:
+      return "loop too large";
+    case Verdict::kMultipleBlocks:
+      return "loop body has multiple blocks";
+    case Verdict::kNoInductionVariable:
+      return "no induction variable";
+    case Verdict::kNonUnitStride:
+      return "induction variable has non-unit stride";
+    case Verdict::kNoTypedArrayAccess:
+      return "no typed array access";
+    case Verdict::kMixedElementTypes:
+      return "mixed element types";
+    case Verdict::kUnsupportedElementType:
+      return "unsupported element type";
+    case Verdict::kNonInductionIndex:
+      return "element index is not the induction variable";
+    case Verdict::kVariantBackingStore:
+      return "backing store is not loop invariant";
+    case Verdict::kUnsupportedReduction:
+      return "unsupported loop-carried value";
+    case Verdict::kUnsupportedOperation:
+      return "unsupported operation";
+    case Verdict::kFloat64Operands:
+      return "float64 operation on values that are not float32";
+    case Verdict::kUnsupportedLoopCondition:
+      return "loop condition is not an upper bound check on the induction "
+             "variable";
+  }
+  UNREACHABLE();
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
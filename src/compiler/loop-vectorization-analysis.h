@@ -0,0 +1,108 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+#define V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
+
+#include "src/compiler/loop-analysis.h"
+#include "src/globals.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class Graph;
+class Node;
+
+// Identifies canonical counted loops over typed arrays that could be executed
+// with the 128-bit SIMD machine operators (F32x4, I32x4, I16x8, I8x16), i.e.
+// innermost single-block loops of the form
+//
+//   for (let i = init; i < bound; ++i) out[i] = f(a[i], b[i], ...);
+//
+// where every element access uses the induction variable as its index, all
+// accessed typed arrays share the same element type and the body only
+// contains operations that have a lane-wise SIMD equivalent. Reductions are
+// only accepted for integer addition, since reassociating floating point
+// additions would change the observable result.
+//
+// The analysis runs on the graph right after simplified lowering, where the
+// representations of all values are known and typed array accesses are still
+// visible as {LoadTypedElement} / {StoreTypedElement}.
+//
+// This is a diagnostic analysis only: the candidates are reported with
+// --trace-turbo-loop, but no loop is rewritten to use SIMD operators yet.
+class V8_EXPORT_PRIVATE LoopVectorizationAnalysis {
+ public:
+  enum class Verdict {
+    kVectorizable,
+    kTooLarge,
+    kMultipleBlocks,
+    kNoInductionVariable,
+    kNonUnitStride,
+    kNoTypedArrayAccess,
+    kMixedElementTypes,
+    kUnsupportedElementType,
+    kNonInductionIndex,
+    kVariantBackingStore,
+    kUnsupportedReduction,
+    kUnsupportedOperation,
+    kFloat64Operands,
+    kUnsupportedLoopCondition,
+  };
+
+  struct Candidate {
+    LoopTree::Loop* loop;
+    Node* loop_node;
+    Node* induction_phi;
+    ExternalArrayType element_type;
+    int lanes;
+    int loads;
+    int stores;
+    int reductions;
+    // True if the loop both loads and stores elements through typed arrays
+    // with different buffer, base or external pointer, which may be views
+    // onto overlapping regions of the same ArrayBuffer; a transformation must
+    // guard the vector loop with a runtime check that the accessed ranges do
+    // not overlap.
+    bool needs_alias_check;
+  };
+
+  LoopVectorizationAnalysis(Graph* graph, LoopTree* loop_tree, Zone* zone);
+
+  void Run();
+
+  const ZoneVector<Candidate>& candidates() const { return candidates_; }
+
+  // Returns the number of SIMD lanes for the given {type}, or 0 if typed
+  // arrays with that element type cannot be vectorized.
+  static int LanesFor(ExternalArrayType type);
+
+  static const size_t kMaxBodySize = 256;
+
+ private:
+  Verdict Analyze(LoopTree::Loop* loop, Candidate* candidate);
+  Verdict AnalyzeElementAccess(Node* node, Node* induction_phi,
+                               LoopTree::Loop* loop, Candidate* candidate);
+  bool IsInductionPhi(Node* phi, Node* loop_node) const;
+  bool IsIntegerAddReduction(Node* phi, LoopTree::Loop* loop) const;
+  bool IsLoopBoundCheck(Node* branch, Node* induction_phi,
+                        LoopTree::Loop* loop) const;
+  bool IsLoopInvariant(Node* node, LoopTree::Loop* loop) const;
+  bool HasFloat32Inputs(Node* node) const;
+  void AnalyzeLoops(const ZoneVector<LoopTree::Loop*>& loops);
+
+  static const char* VerdictToString(Verdict verdict);
+
+  Graph* const graph_;
+  LoopTree* const loop_tree_;
+  ZoneVector<Candidate> candidates_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZATION_ANALYSIS_H_
@@ -245,6 +245,12 @@ struct OpEqualTo<Handle<ScopeInfo>> : public Handle<ScopeInfo>::equal_to {};
 template <>
 struct OpHash<Handle<ScopeInfo>> : public Handle<ScopeInfo>::hash {};
 
+template <>
+struct OpEqualTo<Handle<FeedbackCell>>
+    : public Handle<FeedbackCell>::equal_to {};
+template <>
+struct OpHash<Handle<FeedbackCell>> : public Handle<FeedbackCell>::hash {};
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -54,6 +54,7 @@
 #include "src/compiler/loop-analysis.h"
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/loop-vectorization-analysis.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
@@ -76,6 +77,7 @@
 #include "src/compiler/verifier.h"
 #include "src/compiler/wasm-compiler.h"
 #include "src/compiler/zone-stats.h"
+#include "src/counters.h"
 #include "src/disassembler.h"
 #include "src/isolate-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -540,6 +542,10 @@ class PipelineImpl final {
   // Step E. Install any code dependencies.
   bool CommitDependencies(Handle<Code> code);
 
+  // Returns false and aborts the optimization if the compilation uses more
+  // zone memory than --turbo-max-zone-size.
+  bool CheckZoneBudget();
+
   void VerifyGeneratedCodeIsIdempotent();
   void RunPrintAndVerify(const char* phase, bool untyped = false);
   bool SelectInstructionsAndAssemble(CallDescriptor* call_descriptor);
@@ -773,7 +779,13 @@ class PipelineRunScope {
             phase_name == nullptr ? nullptr : data->pipeline_statistics(),
             phase_name),
         zone_scope_(data->zone_stats(), ZONE_NAME),
-        origin_scope_(data->node_origins(), phase_name) {}
+        origin_scope_(data->node_origins(), phase_name),
+        zone_stats_(data->zone_stats()),
+        phase_name_(phase_name) {}
+
+  ~PipelineRunScope() {
+    if (phase_name_ != nullptr) zone_stats_->RecordPhase(phase_name_);
+  }
 
   Zone* zone() { return zone_scope_.zone(); }
 
@@ -781,6 +793,8 @@ class PipelineRunScope {
   PhaseScope phase_scope_;
   ZoneStats::Scope zone_scope_;
   NodeOriginTable::PhaseScope origin_scope_;
+  ZoneStats* const zone_stats_;
+  const char* const phase_name_;
 };
 
 PipelineStatistics* CreatePipelineStatistics(Handle<Script> script,
@@ -925,6 +939,10 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
     compilation_info()->MarkAsAllocationFoldingEnabled();
   }
 
+  if (FLAG_turbo_fast_register_allocation) {
+    compilation_info()->MarkAsFastRegisterAllocation();
+  }
+
   if (compilation_info()->closure()->raw_feedback_cell()->map() ==
       ReadOnlyRoots(isolate).one_closure_cell_map()) {
     compilation_info()->MarkAsFunctionContextSpecializing();
@@ -938,6 +956,10 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
 
   if (!pipeline_.CreateGraph()) {
     if (isolate->has_pending_exception()) return FAILED;  // Stack overflowed.
+    if (compilation_info()->bailout_reason() ==
+        BailoutReason::kZoneBudgetExceeded) {
+      return RetryOptimization(BailoutReason::kZoneBudgetExceeded);
+    }
     return AbortOptimization(BailoutReason::kGraphBuildingFailed);
   }
 
@@ -959,6 +981,18 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl() {
 
 PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
     Isolate* isolate) {
+  isolate->counters()->turbofan_optimize_peak_zone_bytes()->AddSample(
+      static_cast<int>(zone_stats_.GetMaxAllocatedBytes()));
+  if (FLAG_trace_turbo_zone_peak) {
+    StdoutStream{} << "[peak zone memory for "
+                   << compilation_info()->GetDebugName().get() << ": "
+                   << zone_stats_.GetMaxAllocatedBytes() << " bytes, "
+                   << zone_stats_.peak_phase_bytes() << " bytes in phase "
+                   << (zone_stats_.peak_phase_name() != nullptr
+                           ? zone_stats_.peak_phase_name()
+                           : "<none>")
+                   << "]" << std::endl;
+  }
   MaybeHandle<Code> maybe_code = pipeline_.FinalizeCode();
   Handle<Code> code;
   if (!maybe_code.ToHandle(&code)) {
@@ -1031,11 +1065,12 @@ struct GraphBuilderPhase {
 
 namespace {
 
-Maybe<OuterContext> GetModuleContext(Handle<JSFunction> closure) {
+Maybe<OuterContext> GetModuleOrScriptContext(Handle<JSFunction> closure) {
   Context current = closure->context();
   size_t distance = 0;
   while (!current->IsNativeContext()) {
-    if (current->IsModuleContext()) {
+    if (current->IsModuleContext() ||
+        (FLAG_script_context_const_tracking && current->IsScriptContext())) {
       return Just(
           OuterContext(handle(current, current->GetIsolate()), distance));
     }
@@ -1051,7 +1086,7 @@ Maybe<OuterContext> ChooseSpecializationContext(
     DCHECK(info->has_context());
     return Just(OuterContext(handle(info->context(), isolate), 0));
   }
-  return GetModuleContext(info->closure());
+  return GetModuleOrScriptContext(info->closure());
 }
 
 }  // anonymous namespace
@@ -1080,7 +1115,8 @@ struct InliningPhase {
         ChooseSpecializationContext(isolate, data->info()),
         data->info()->is_function_context_specializing()
             ? data->info()->closure()
-            : MaybeHandle<JSFunction>());
+            : MaybeHandle<JSFunction>(),
+        data->dependencies());
     JSNativeContextSpecialization::Flags flags =
         JSNativeContextSpecialization::kNoFlags;
     if (data->info()->is_accessor_inlining_enabled()) {
@@ -1265,6 +1301,17 @@ struct SimplifiedLoweringPhase {
   }
 };
 
+struct LoopVectorizationAnalysisPhase {
+  static const char* phase_name() { return "loop vectorization analysis"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(data->jsgraph()->graph(), temp_zone);
+    LoopVectorizationAnalysis analysis(data->graph(), loop_tree, temp_zone);
+    analysis.Run();
+  }
+};
+
 struct LoopPeelingPhase {
   static const char* phase_name() { return "loop peeling"; }
 
@@ -1964,7 +2011,7 @@ bool PipelineImpl::CreateGraph() {
 
   data->EndPhaseKind();
 
-  return true;
+  return CheckZoneBudget();
 }
 
 bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
@@ -2010,6 +2057,10 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<SimplifiedLoweringPhase>();
   RunPrintAndVerify(SimplifiedLoweringPhase::phase_name(), true);
 
+  if (FLAG_turbo_loop_vectorization_analysis) {
+    Run<LoopVectorizationAnalysisPhase>();
+  }
+
   // From now on it is invalid to look at types on the nodes, because the types
   // on the nodes might not make sense after representation selection due to the
   // way we handle truncations; if we'd want to look at types afterwards we'd
@@ -2061,11 +2112,29 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     data->node_origins()->RemoveDecorator();
   }
 
+  // Scheduling, instruction selection and register allocation need memory
+  // proportional to the size of the graph, so give up before them if the
+  // graph already got too big.
+  if (!CheckZoneBudget()) {
+    data->EndPhaseKind();
+    return false;
+  }
+
   ComputeScheduledGraph();
 
   return SelectInstructions(linkage);
 }
 
+bool PipelineImpl::CheckZoneBudget() {
+  if (FLAG_turbo_max_zone_size == 0) return true;
+  size_t zone_size = data_->zone_stats()->GetCurrentAllocatedBytes();
+  if (zone_size <= FLAG_turbo_max_zone_size * MB) return true;
+  // The graph may be smaller next time, e.g. with different feedback, so
+  // don't disable optimization of the function for good.
+  info()->RetryOptimization(BailoutReason::kZoneBudgetExceeded);
+  return false;
+}
+
 MaybeHandle<Code> Pipeline::GenerateCodeForCodeStub(
     Isolate* isolate, CallDescriptor* call_descriptor, Graph* graph,
     SourcePositionTable* source_positions, Code::Kind kind,
@@ -2588,7 +2657,11 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   data->DeleteGraphZone();
 
-  data->BeginPhaseKind("register allocation");
+  // Report fast allocations separately, so that --turbo-stats shows how much
+  // compile time the fast mode saves.
+  data->BeginPhaseKind(info()->is_fast_register_allocation()
+                           ? "fast register allocation"
+                           : "register allocation");
 
   bool run_verifier = FLAG_turbo_verify_allocation;
 
@@ -2832,10 +2905,15 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   data->InitializeRegisterAllocationData(config, call_descriptor);
   if (info()->is_osr()) data->osr_helper()->SetupFrame(data->frame());
 
+  // The fast mode skips the phases that only improve the quality of the
+  // allocation: bundles (register hints and shared spill slots for phis),
+  // splintering of deferred code and gap move optimization.
+  const bool fast = info()->is_fast_register_allocation();
+
   Run<MeetRegisterConstraintsPhase>();
   Run<ResolvePhisPhase>();
   Run<BuildLiveRangesPhase>();
-  Run<BuildBundlesPhase>();
+  if (!fast) Run<BuildBundlesPhase>();
 
   TraceSequence(info(), data, "before register allocation");
   if (verifier != nullptr) {
@@ -2850,7 +2928,8 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                        data->register_allocation_data());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  const bool preprocess_ranges = FLAG_turbo_preprocess_ranges && !fast;
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
     if (info()->trace_turbo_json_enabled() &&
         !data->MayHaveUnverifiableGraph()) {
@@ -2866,7 +2945,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -2886,7 +2965,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<ConnectRangesPhase>();
 
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !fast) {
     Run<OptimizeMovesPhase>();
   }
 
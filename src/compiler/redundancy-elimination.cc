@@ -19,7 +19,9 @@ RedundancyElimination::~RedundancyElimination() = default;
 Reduction RedundancyElimination::Reduce(Node* node) {
   if (node_checks_.Get(node)) return NoChange();
   switch (node->opcode()) {
+    case IrOpcode::kCheckBigInt:
     case IrOpcode::kCheckBounds:
+    case IrOpcode::kCheckClosure:
     case IrOpcode::kCheckEqualsInternalizedString:
     case IrOpcode::kCheckEqualsSymbol:
     case IrOpcode::kCheckFloat64Hole:
@@ -143,6 +145,7 @@ bool CheckSubsumes(Node const* a, Node const* b) {
       return false;
     } else {
       switch (a->opcode()) {
+        case IrOpcode::kCheckBigInt:
         case IrOpcode::kCheckBounds:
         case IrOpcode::kCheckSmi:
         case IrOpcode::kCheckString:
@@ -174,6 +177,11 @@ bool CheckSubsumes(Node const* a, Node const* b) {
           }
           break;
         }
+        case IrOpcode::kCheckClosure:
+          if (!FeedbackCellOf(a->op()).equals(FeedbackCellOf(b->op()))) {
+            return false;
+          }
+          break;
         case IrOpcode::kCheckedTaggedToFloat64:
         case IrOpcode::kCheckedTruncateTaggedToWord32: {
           CheckTaggedInputParameters const& ap =
@@ -228,6 +228,11 @@ void SerializerForBackgroundCompilation::TraverseBytecode() {
     break;
       SUPPORTED_BYTECODE_LIST(DEFINE_BYTECODE_CASE)
 #undef DEFINE_BYTECODE_CASE
+#define DEFINE_SHORT_STAR_CASE(name, ...) case interpreter::Bytecode::k##name:
+      SHORT_STAR_BYTECODE_LIST(DEFINE_SHORT_STAR_CASE)
+#undef DEFINE_SHORT_STAR_CASE
+        VisitStar(&iterator);
+        break;
       default: {
         environment()->ClearEphemeralHints();
         break;
@@ -298,7 +303,7 @@ void SerializerForBackgroundCompilation::VisitLdar(
 
 void SerializerForBackgroundCompilation::VisitStar(
     BytecodeArrayIterator* iterator) {
-  interpreter::Register reg = iterator->GetRegisterOperand(0);
+  interpreter::Register reg = iterator->GetStarTargetRegister();
   environment()->register_hints(reg).Clear();
   environment()->register_hints(reg).Add(environment()->accumulator_hints());
 }
@@ -479,22 +484,52 @@ base::Optional<HeapObjectRef> GetHeapObjectFeedback(
   if (!nexus.GetFeedback()->GetHeapObject(&object)) return base::nullopt;
   return HeapObjectRef(broker, handle(object, broker->isolate()));
 }
+
+// Calls to Function.prototype.apply, Function.prototype.call and Reflect.apply
+// record the function they forward to instead of the callee.
+bool IsForwardedTargetFeedback(Handle<FeedbackVector> feedback_vector,
+                               FeedbackSlot slot) {
+  if (slot.IsInvalid()) return false;
+  FeedbackNexus nexus(feedback_vector, slot);
+  return IsCallICKind(nexus.kind()) &&
+         nexus.GetCallFeedbackContent() ==
+             CallFeedbackContent::kForwardedTarget;
+}
 }  // namespace
 
 void SerializerForBackgroundCompilation::ProcessCallOrConstruct(
     Hints callee, base::Optional<Hints> new_target,
     const HintsVector& arguments, FeedbackSlot slot, bool with_spread) {
   // Incorporate feedback into hints.
-  base::Optional<HeapObjectRef> feedback = GetHeapObjectFeedback(
-      broker(), environment()->function().feedback_vector, slot);
+  Handle<FeedbackVector> feedback_vector =
+      environment()->function().feedback_vector;
+  base::Optional<HeapObjectRef> feedback =
+      GetHeapObjectFeedback(broker(), feedback_vector, slot);
+  // Call feedback that describes the forwarded target goes into
+  // {forwarded_targets} rather than the callee hints.
+  Hints forwarded_targets(zone());
+  Hints& targets = !new_target.has_value() &&
+                           IsForwardedTargetFeedback(feedback_vector, slot)
+                       ? forwarded_targets
+                       : callee;
   if (feedback.has_value() && feedback->map().is_callable()) {
     if (new_target.has_value()) {
       // Construct; feedback is new_target, which often is also the callee.
       new_target->AddConstant(feedback->object());
       callee.AddConstant(feedback->object());
     } else {
-      // Call; feedback is callee.
-      callee.AddConstant(feedback->object());
+      // Call; feedback is callee or forwarded target.
+      targets.AddConstant(feedback->object());
+    }
+  } else if (feedback.has_value() && feedback->IsFeedbackCell() &&
+             !new_target.has_value()) {
+    // Call; feedback is the cell shared by the closures seen as callee or
+    // forwarded target.
+    ObjectRef cell_value = feedback->AsFeedbackCell().value();
+    if (cell_value.IsFeedbackVector()) {
+      FeedbackVectorRef vector = cell_value.AsFeedbackVector();
+      targets.AddFunctionBlueprint(
+          {vector.shared_function_info().object(), vector.object()});
     }
   }
 
@@ -516,6 +551,34 @@ void SerializerForBackgroundCompilation::ProcessCallOrConstruct(
     environment()->accumulator_hints().Add(RunChildSerializer(
         CompilationSubject(hint), new_target, arguments, with_spread));
   }
+
+  for (auto hint : forwarded_targets.constants()) {
+    if (!hint->IsJSFunction()) continue;
+
+    Handle<JSFunction> function = Handle<JSFunction>::cast(hint);
+    if (!function->shared()->IsInlineable() || !function->has_feedback_vector())
+      continue;
+
+    ProcessForwardedTarget({function, broker()->isolate()});
+  }
+
+  for (auto hint : forwarded_targets.function_blueprints()) {
+    if (!hint.shared->IsInlineable()) continue;
+    ProcessForwardedTarget(CompilationSubject(hint));
+  }
+}
+
+void SerializerForBackgroundCompilation::ProcessForwardedTarget(
+    CompilationSubject function) {
+  // The receiver and arguments that Function.prototype.apply,
+  // Function.prototype.call or Reflect.apply pass on are not known here, so
+  // we have no information about any of the parameters.
+  HintsVector arguments(zone());
+  arguments.resize(
+      function.blueprint().shared->GetBytecodeArray()->parameter_count(),
+      Hints(zone()));
+  environment()->accumulator_hints().Add(
+      RunChildSerializer(function, base::nullopt, arguments, false));
 }
 
 void SerializerForBackgroundCompilation::ProcessCallVarArgs(
@@ -2651,8 +2651,23 @@ class RepresentationSelector {
                   MachineRepresentation::kTaggedPointer);
         return;
       }
+      case IrOpcode::kBigIntAsIntN64:
+      case IrOpcode::kBigIntAsUintN64: {
+        VisitUnop(node, UseInfo::AnyTagged(),
+                  MachineRepresentation::kTaggedPointer);
+        return;
+      }
+      case IrOpcode::kCheckBigInt: {
+        VisitCheck(node, Type::BigInt(), lowering);
+        return;
+      }
       case IrOpcode::kCheckBounds:
         return VisitCheckBounds(node, lowering);
+      case IrOpcode::kCheckClosure: {
+        VisitUnop(node, UseInfo::CheckedHeapObjectAsTaggedPointer(),
+                  MachineRepresentation::kTaggedPointer);
+        return;
+      }
       case IrOpcode::kPoisonIndex: {
         VisitUnop(node, UseInfo::TruncatingWord32(),
                   MachineRepresentation::kWord32);
@@ -3340,12 +3355,48 @@ class RepresentationSelector {
                 node,
                 lowering->simplified()->FindOrderedHashMapEntryForInt32Key());
           }
+        } else if (key_type.Is(Type::InternalizedString())) {
+          VisitBinop(node, UseInfo::AnyTagged(),
+                     MachineType::PointerRepresentation());
+          if (lower()) {
+            NodeProperties::ChangeOp(
+                node,
+                lowering->simplified()->FindOrderedHashMapEntryForStringKey());
+          }
         } else {
           VisitBinop(node, UseInfo::AnyTagged(),
                      MachineRepresentation::kTaggedSigned);
         }
         return;
       }
+      case IrOpcode::kFindOrderedHashSetEntry: {
+        Type const key_type = TypeOf(node->InputAt(1));
+        if (key_type.Is(Type::Signed32OrMinusZero())) {
+          VisitBinop(node, UseInfo::AnyTagged(), UseInfo::TruncatingWord32(),
+                     MachineType::PointerRepresentation());
+          if (lower()) {
+            NodeProperties::ChangeOp(
+                node,
+                lowering->simplified()->FindOrderedHashSetEntryForInt32Key());
+          }
+        } else if (key_type.Is(Type::InternalizedString())) {
+          VisitBinop(node, UseInfo::AnyTagged(),
+                     MachineType::PointerRepresentation());
+          if (lower()) {
+            NodeProperties::ChangeOp(
+                node,
+                lowering->simplified()->FindOrderedHashSetEntryForStringKey());
+          }
+        } else {
+          VisitBinop(node, UseInfo::AnyTagged(),
+                     MachineRepresentation::kTaggedSigned);
+        }
+        return;
+      }
+      case IrOpcode::kFindEphemeronHashTableEntry:
+        VisitBinop(node, UseInfo::AnyTagged(),
+                   MachineRepresentation::kTaggedSigned);
+        return;
 
       // Operators with all inputs tagged and no or tagged output have uniform
       // handling.
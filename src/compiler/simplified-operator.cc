@@ -290,6 +290,11 @@ MapsParameterInfo const& MapGuardMapsOf(Operator const* op) {
   return OpParameter<MapsParameterInfo>(op);
 }
 
+Handle<FeedbackCell> FeedbackCellOf(Operator const* op) {
+  DCHECK_EQ(IrOpcode::kCheckClosure, op->opcode());
+  return OpParameter<Handle<FeedbackCell>>(op);
+}
+
 size_t hash_value(CheckTaggedInputMode mode) {
   return static_cast<size_t>(mode);
 }
@@ -714,6 +719,8 @@ bool operator==(CheckMinusZeroParameters const& lhs,
   V(StringConcat, Operator::kNoProperties, 3, 0)                 \
   V(StringToNumber, Operator::kNoProperties, 1, 0)               \
   V(StringFromSingleCharCode, Operator::kNoProperties, 1, 0)     \
+  V(BigIntAsIntN64, Operator::kNoProperties, 1, 0)               \
+  V(BigIntAsUintN64, Operator::kNoProperties, 1, 0)              \
   V(StringIndexOf, Operator::kNoProperties, 3, 0)                \
   V(StringLength, Operator::kNoProperties, 1, 0)                 \
   V(StringToLowerCaseIntl, Operator::kNoProperties, 1, 0)        \
@@ -802,6 +809,7 @@ bool operator==(CheckMinusZeroParameters const& lhs,
   V(CheckedUint32Mod, 2, 1)
 
 #define CHECKED_WITH_FEEDBACK_OP_LIST(V) \
+  V(CheckBigInt, 1, 1)                   \
   V(CheckBounds, 2, 1)                   \
   V(CheckNumber, 1, 1)                   \
   V(CheckSmi, 1, 1)                      \
@@ -922,6 +930,48 @@ struct SimplifiedOperatorGlobalCache final {
   FindOrderedHashMapEntryForInt32KeyOperator
       kFindOrderedHashMapEntryForInt32Key;
 
+  struct FindOrderedHashMapEntryForStringKeyOperator final : public Operator {
+    FindOrderedHashMapEntryForStringKeyOperator()
+        : Operator(IrOpcode::kFindOrderedHashMapEntryForStringKey,
+                   Operator::kEliminatable,
+                   "FindOrderedHashMapEntryForStringKey", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashMapEntryForStringKeyOperator
+      kFindOrderedHashMapEntryForStringKey;
+
+  struct FindOrderedHashSetEntryOperator final : public Operator {
+    FindOrderedHashSetEntryOperator()
+        : Operator(IrOpcode::kFindOrderedHashSetEntry, Operator::kEliminatable,
+                   "FindOrderedHashSetEntry", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashSetEntryOperator kFindOrderedHashSetEntry;
+
+  struct FindOrderedHashSetEntryForInt32KeyOperator final : public Operator {
+    FindOrderedHashSetEntryForInt32KeyOperator()
+        : Operator(IrOpcode::kFindOrderedHashSetEntryForInt32Key,
+                   Operator::kEliminatable,
+                   "FindOrderedHashSetEntryForInt32Key", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashSetEntryForInt32KeyOperator
+      kFindOrderedHashSetEntryForInt32Key;
+
+  struct FindOrderedHashSetEntryForStringKeyOperator final : public Operator {
+    FindOrderedHashSetEntryForStringKeyOperator()
+        : Operator(IrOpcode::kFindOrderedHashSetEntryForStringKey,
+                   Operator::kEliminatable,
+                   "FindOrderedHashSetEntryForStringKey", 2, 1, 1, 1, 1, 0) {}
+  };
+  FindOrderedHashSetEntryForStringKeyOperator
+      kFindOrderedHashSetEntryForStringKey;
+
+  struct FindEphemeronHashTableEntryOperator final : public Operator {
+    FindEphemeronHashTableEntryOperator()
+        : Operator(IrOpcode::kFindEphemeronHashTableEntry,
+                   Operator::kEliminatable, "FindEphemeronHashTableEntry", 2,
+                   1, 1, 1, 1, 0) {}
+  };
+  FindEphemeronHashTableEntryOperator kFindEphemeronHashTableEntry;
+
   struct ArgumentsFrameOperator final : public Operator {
     ArgumentsFrameOperator()
         : Operator(IrOpcode::kArgumentsFrame, Operator::kPure, "ArgumentsFrame",
@@ -1167,6 +1217,11 @@ CHECKED_OP_LIST(GET_FROM_CACHE)
 GET_FROM_CACHE(ArgumentsFrame)
 GET_FROM_CACHE(FindOrderedHashMapEntry)
 GET_FROM_CACHE(FindOrderedHashMapEntryForInt32Key)
+GET_FROM_CACHE(FindOrderedHashMapEntryForStringKey)
+GET_FROM_CACHE(FindOrderedHashSetEntry)
+GET_FROM_CACHE(FindOrderedHashSetEntryForInt32Key)
+GET_FROM_CACHE(FindOrderedHashSetEntryForStringKey)
+GET_FROM_CACHE(FindEphemeronHashTableEntry)
 GET_FROM_CACHE(LoadFieldByIndex)
 #undef GET_FROM_CACHE
 
@@ -1338,6 +1393,16 @@ const Operator* SimplifiedOperatorBuilder::CheckedTruncateTaggedToWord32(
       1, 1, 1, 1, 1, 0, CheckTaggedInputParameters(mode, feedback));
 }
 
+const Operator* SimplifiedOperatorBuilder::CheckClosure(
+    const Handle<FeedbackCell>& feedback_cell) {
+  return new (zone()) Operator1<Handle<FeedbackCell>>(  // --
+      IrOpcode::kCheckClosure,                           // opcode
+      Operator::kNoThrow | Operator::kNoWrite,           // flags
+      "CheckClosure",                                    // name
+      1, 1, 1, 1, 1, 0,                                  // counts
+      feedback_cell);                                    // parameter
+}
+
 const Operator* SimplifiedOperatorBuilder::CheckMaps(
     CheckMapsFlags flags, ZoneHandleSet<Map> maps,
     const VectorSlotPair& feedback) {
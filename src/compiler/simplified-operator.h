@@ -353,6 +353,9 @@ CheckMapsParameters const& CheckMapsParametersOf(Operator const*)
 
 MapsParameterInfo const& MapGuardMapsOf(Operator const*) V8_WARN_UNUSED_RESULT;
 
+// The FeedbackCell parameter for a CheckClosure operator.
+Handle<FeedbackCell> FeedbackCellOf(Operator const*) V8_WARN_UNUSED_RESULT;
+
 // Parameters for CompareMaps operator.
 MapsParameterInfo const& CompareMapsParametersOf(Operator const*)
     V8_WARN_UNUSED_RESULT;
@@ -630,8 +633,17 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
   const Operator* StringToUpperCaseIntl();
   const Operator* StringSubstring();
 
+  const Operator* BigIntAsIntN64();
+  const Operator* BigIntAsUintN64();
+
   const Operator* FindOrderedHashMapEntry();
   const Operator* FindOrderedHashMapEntryForInt32Key();
+  const Operator* FindOrderedHashMapEntryForStringKey();
+  const Operator* FindOrderedHashSetEntry();
+  const Operator* FindOrderedHashSetEntryForInt32Key();
+  const Operator* FindOrderedHashSetEntryForStringKey();
+  // Returns the index of the value of {key} in an EphemeronHashTable, or -1.
+  const Operator* FindEphemeronHashTableEntry();
 
   const Operator* SpeculativeToNumber(NumberOperationHint hint,
                                       const VectorSlotPair& feedback);
@@ -666,7 +678,9 @@ class V8_EXPORT_PRIVATE SimplifiedOperatorBuilder final
   const Operator* CompareMaps(ZoneHandleSet<Map>);
   const Operator* MapGuard(ZoneHandleSet<Map> maps);
 
+  const Operator* CheckBigInt(const VectorSlotPair& feedback);
   const Operator* CheckBounds(const VectorSlotPair& feedback);
+  const Operator* CheckClosure(const Handle<FeedbackCell>& feedback_cell);
   const Operator* CheckEqualsInternalizedString();
   const Operator* CheckEqualsSymbol();
   const Operator* CheckFloat64Hole(CheckFloat64HoleMode, VectorSlotPair const&);
@@ -2037,15 +2037,29 @@ Type Typer::Visitor::TypeStringLength(Node* node) {
 
 Type Typer::Visitor::TypeStringSubstring(Node* node) { return Type::String(); }
 
+Type Typer::Visitor::TypeBigIntAsIntN64(Node* node) { return Type::BigInt(); }
+
+Type Typer::Visitor::TypeBigIntAsUintN64(Node* node) { return Type::BigInt(); }
+
 Type Typer::Visitor::TypePoisonIndex(Node* node) {
   return Type::Union(Operand(node, 0), typer_->cache_->kSingletonZero, zone());
 }
 
+Type Typer::Visitor::TypeCheckBigInt(Node* node) {
+  Type arg = Operand(node, 0);
+  return Type::Intersect(arg, Type::BigInt(), zone());
+}
+
 Type Typer::Visitor::TypeCheckBounds(Node* node) {
   return typer_->operation_typer_.CheckBounds(Operand(node, 0),
                                               Operand(node, 1));
 }
 
+Type Typer::Visitor::TypeCheckClosure(Node* node) {
+  Type arg = Operand(node, 0);
+  return Type::Intersect(arg, Type::Function(), zone());
+}
+
 Type Typer::Visitor::TypeCheckHeapObject(Node* node) {
   Type type = Operand(node, 0);
   return type;
@@ -2300,6 +2314,26 @@ Type Typer::Visitor::TypeFindOrderedHashMapEntryForInt32Key(Node* node) {
   return Type::Range(-1.0, FixedArray::kMaxLength, zone());
 }
 
+Type Typer::Visitor::TypeFindOrderedHashMapEntryForStringKey(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
+Type Typer::Visitor::TypeFindOrderedHashSetEntry(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
+Type Typer::Visitor::TypeFindOrderedHashSetEntryForInt32Key(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
+Type Typer::Visitor::TypeFindOrderedHashSetEntryForStringKey(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
+Type Typer::Visitor::TypeFindEphemeronHashTableEntry(Node* node) {
+  return Type::Range(-1.0, FixedArray::kMaxLength, zone());
+}
+
 Type Typer::Visitor::TypeRuntimeAbort(Node* node) { UNREACHABLE(); }
 
 // Heap constants.
@@ -63,7 +63,11 @@ void ZoneStats::StatsScope::ZoneReturned(Zone* zone) {
 }
 
 ZoneStats::ZoneStats(AccountingAllocator* allocator)
-    : max_allocated_bytes_(0), total_deleted_bytes_(0), allocator_(allocator) {}
+    : max_allocated_bytes_(0),
+      total_deleted_bytes_(0),
+      peak_phase_name_(nullptr),
+      peak_phase_bytes_(0),
+      allocator_(allocator) {}
 
 ZoneStats::~ZoneStats() {
   DCHECK(zones_.empty());
@@ -86,6 +90,15 @@ size_t ZoneStats::GetTotalAllocatedBytes() const {
   return total_deleted_bytes_ + GetCurrentAllocatedBytes();
 }
 
+void ZoneStats::RecordPhase(const char* phase_name) {
+  size_t current_total = GetCurrentAllocatedBytes();
+  max_allocated_bytes_ = std::max(max_allocated_bytes_, current_total);
+  if (current_total > peak_phase_bytes_) {
+    peak_phase_name_ = phase_name;
+    peak_phase_bytes_ = current_total;
+  }
+}
+
 Zone* ZoneStats::NewEmptyZone(const char* zone_name) {
   Zone* zone = new Zone(allocator_, zone_name);
   zones_.push_back(zone);
@@ -70,6 +70,16 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   size_t GetTotalAllocatedBytes() const;
   size_t GetCurrentAllocatedBytes() const;
 
+  // Records the zone memory in use at the end of the pipeline phase
+  // {phase_name}, before its temporary zone is returned. Since zones only
+  // grow, this is the peak zone memory of the phase.
+  void RecordPhase(const char* phase_name);
+
+  // The pipeline phase with the highest zone memory usage recorded so far,
+  // and that usage.
+  const char* peak_phase_name() const { return peak_phase_name_; }
+  size_t peak_phase_bytes() const { return peak_phase_bytes_; }
+
  private:
   Zone* NewEmptyZone(const char* zone_name);
   void ReturnZone(Zone* zone);
@@ -82,6 +92,8 @@ class V8_EXPORT_PRIVATE ZoneStats final {
   Stats stats_;
   size_t max_allocated_bytes_;
   size_t total_deleted_bytes_;
+  const char* peak_phase_name_;
+  size_t peak_phase_bytes_;
   AccountingAllocator* allocator_;
 
   DISALLOW_COPY_AND_ASSIGN(ZoneStats);
@@ -137,6 +137,27 @@ bool Context::IsScriptContext() const {
   return map()->instance_type() == SCRIPT_CONTEXT_TYPE;
 }
 
+// static
+int Context::ScriptContextSideTableIndex(int slot_index) {
+  DCHECK_LE(MIN_CONTEXT_SLOTS, slot_index);
+  return kScriptContextSideTableHeaderSize + slot_index - MIN_CONTEXT_SLOTS;
+}
+
+FixedArray Context::script_context_side_table() const {
+  DCHECK(IsScriptContext());
+  return FixedArray::cast(get(length() - 1));
+}
+
+bool Context::IsConstScriptContextSlot(int slot_index) const {
+  DCHECK_LE(0, slot_index);
+  DCHECK_LT(slot_index, length());
+  if (!IsScriptContext()) return false;
+  // The header slots are not let bindings and have no side table entry.
+  if (slot_index < MIN_CONTEXT_SLOTS) return false;
+  return script_context_side_table()->get(ScriptContextSideTableIndex(
+             slot_index)) == Smi::FromInt(kConstScriptContextSlot);
+}
+
 bool Context::HasSameSecurityTokenAs(Context that) const {
   return this->native_context()->security_token() ==
          that->native_context()->security_token();
@@ -126,6 +126,23 @@ Context Context::script_context() {
   return current;
 }
 
+// static
+void Context::StoreScriptContextSlot(Isolate* isolate, Handle<Context> context,
+                                     int slot_index, Handle<Object> value) {
+  DCHECK(context->IsScriptContext());
+  FixedArray side_table = context->script_context_side_table();
+  int side_table_index = ScriptContextSideTableIndex(slot_index);
+  if (side_table->get(side_table_index) ==
+      Smi::FromInt(kConstScriptContextSlot)) {
+    side_table->set(side_table_index, Smi::FromInt(kMutableScriptContextSlot));
+    PropertyCell cell = PropertyCell::cast(
+        side_table->get(kScriptContextSideTableCellIndex));
+    cell->dependent_code()->DeoptimizeDependentCodeGroup(
+        isolate, DependentCode::kPropertyCellChangedGroup);
+  }
+  context->set(slot_index, *value);
+}
+
 JSGlobalProxy Context::global_proxy() {
   return native_context()->global_proxy_object();
 }
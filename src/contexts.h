@@ -208,6 +208,7 @@ enum ContextLookupFlags {
   V(OBJECT_FUNCTION_INDEX, JSFunction, object_function)                        \
   V(OBJECT_FUNCTION_PROTOTYPE_MAP_INDEX, Map, object_function_prototype_map)   \
   V(OPAQUE_REFERENCE_FUNCTION_INDEX, JSFunction, opaque_reference_function)    \
+  V(OSR_CODE_CACHE_INDEX, WeakFixedArray, osr_code_cache)                      \
   V(PROXY_CALLABLE_MAP_INDEX, Map, proxy_callable_map)                         \
   V(PROXY_CONSTRUCTOR_MAP_INDEX, Map, proxy_constructor_map)                   \
   V(PROXY_FUNCTION_INDEX, JSFunction, proxy_function)                          \
@@ -593,6 +594,30 @@ class Context : public HeapObject {
 
   inline bool HasSameSecurityTokenAs(Context that) const;
 
+  // Script contexts have one slot beyond their locals, holding a side table
+  // that tracks which of their let bindings were assigned to after their
+  // declaration, even with the value they already hold. Optimized code may embed the value of the others as
+  // constants, depending on the PropertyCell at the start of the side table;
+  // its dependent code is deoptimized when one of them is written to. The
+  // side table has a Smi ScriptContextSlotState per context local after the
+  // cell.
+  enum ScriptContextSlotState {
+    kConstScriptContextSlot,
+    kMutableScriptContextSlot
+  };
+  static const int kScriptContextSideTableCellIndex = 0;
+  static const int kScriptContextSideTableHeaderSize = 1;
+
+  static inline int ScriptContextSideTableIndex(int slot_index);
+  inline FixedArray script_context_side_table() const;
+  inline bool IsConstScriptContextSlot(int slot_index) const;
+
+  // Stores {value} into the let binding at {slot_index} of the script context
+  // {context}, which is initialized already, and marks the binding as mutable
+  // in the side table.
+  static void StoreScriptContextSlot(Isolate* isolate, Handle<Context> context,
+                                     int slot_index, Handle<Object> value);
+
   // The native context also stores a list of all optimized code and a
   // list of all deoptimized code, which are needed by the deoptimizer.
   void AddOptimizedCode(Code code);
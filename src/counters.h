@@ -880,6 +880,7 @@ class RuntimeCallTimer final {
   V(CompileBackgroundRewriteReturnResult)      \
   V(CompileBackgroundScopeAnalysis)            \
   V(CompileBackgroundScript)                   \
+  V(CompileBackgroundValidateCodeCache)        \
   V(CompileDeserialize)                        \
   V(CompileEnqueueOnDispatcher)                \
   V(CompileEval)                               \
@@ -1220,6 +1221,8 @@ class RuntimeCallTimerScope {
      V8.AsmWasmTranslationPeakMemoryBytes, 1, GB, 51)                          \
   HR(wasm_compile_function_peak_memory_bytes,                                  \
      V8.WasmCompileFunctionPeakMemoryBytes, 1, GB, 51)                         \
+  HR(turbofan_optimize_peak_zone_bytes, V8.TurboFanOptimizePeakZoneBytes, 1,   \
+     GB, 51)                                                                   \
   HR(asm_module_size_bytes, V8.AsmModuleSizeBytes, 1, GB, 51)                  \
   HR(asm_wasm_translation_throughput, V8.AsmWasmTranslationThroughput, 1, 100, \
      20)                                                                       \
@@ -1325,6 +1328,9 @@ class RuntimeCallTimerScope {
      V8.CompileScriptMicroSeconds.BackgroundThread, 1000000, MICROSECOND)      \
   HT(compile_function_on_background,                                           \
      V8.CompileFunctionMicroSeconds.BackgroundThread, 1000000, MICROSECOND)    \
+  HT(compile_validate_code_cache_on_background,                                \
+     V8.CompileValidateCodeCacheMicroSeconds.BackgroundThread, 1000000,        \
+     MICROSECOND)                                                              \
   HT(gc_parallel_task_latency, V8.GC.ParallelTaskLatencyMicroSeconds, 1000000, \
      MICROSECOND)
 
@@ -1371,6 +1377,10 @@ class RuntimeCallTimerScope {
   SC(inlined_copied_elements, V8.InlinedCopiedElements)             \
   SC(compilation_cache_hits, V8.CompilationCacheHits)               \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)           \
+  SC(compilation_cache_eval_hits, V8.CompilationCacheEvalHits)      \
+  SC(compilation_cache_eval_misses, V8.CompilationCacheEvalMisses)  \
+  SC(compilation_cache_eval_evictions,                              \
+     V8.CompilationCacheEvalEvictions)                              \
   /* Amount of evaled source code. */                               \
   SC(total_eval_size, V8.TotalEvalSize)                             \
   /* Amount of loaded source code. */                               \
@@ -1381,6 +1391,21 @@ class RuntimeCallTimerScope {
   SC(total_preparse_skipped, V8.TotalPreparseSkipped)               \
   /* Amount of compiled source code. */                             \
   SC(total_compile_size, V8.TotalCompileSize)                       \
+  /* Number of functions whose bytecode was flushed. */             \
+  SC(bytecode_flushes, V8.BytecodeFlushes)                          \
+  /* Number of functions compiled again after a bytecode flush. */  \
+  SC(bytecode_recompiles, V8.BytecodeRecompiles)                    \
+  /* Flushed functions that got their kept preparse data back. */   \
+  SC(kept_preparse_data_hits, V8.KeptPreparseDataHits)              \
+  /* Number and size of the feedback vectors allocated. */          \
+  SC(feedback_vectors_allocated, V8.FeedbackVectorsAllocated)       \
+  SC(feedback_vector_bytes, V8.FeedbackVectorBytes)                 \
+  /* Scripts found in, missing from and rejected by the */          \
+  /* --code-cache-dir, and files written to it. */                  \
+  SC(code_cache_directory_hits, V8.CodeCacheDirectoryHits)          \
+  SC(code_cache_directory_misses, V8.CodeCacheDirectoryMisses)      \
+  SC(code_cache_directory_rejects, V8.CodeCacheDirectoryRejects)    \
+  SC(code_cache_directory_writes, V8.CodeCacheDirectoryWrites)      \
   /* Amount of source code compiled with the full codegen. */       \
   SC(total_full_codegen_source_size, V8.TotalFullCodegenSourceSize) \
   /* Number of contexts created from scratch. */                    \
@@ -1461,6 +1486,8 @@ class RuntimeCallTimerScope {
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
   /* Total code size (including metadata) of baseline code or bytecode. */     \
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
+  /* Bytes of bytecode saved by --ignition-short-star. */                      \
+  SC(short_star_bytes_saved, V8.ShortStarBytesSaved)                           \
   /* Total count of functions compiled using the baseline compiler. */         \
   SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
 
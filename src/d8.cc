@@ -406,13 +406,16 @@ class DummySourceStream : public v8::ScriptCompiler::ExternalSourceStream {
 
 class BackgroundCompileThread : public base::Thread {
  public:
-  BackgroundCompileThread(Isolate* isolate, Local<String> source)
+  BackgroundCompileThread(Isolate* isolate, Local<String> source,
+                          bool is_module = false)
       : base::Thread(GetThreadOptions("BackgroundCompileThread")),
         source_(source),
         streamed_source_(new DummySourceStream(source, isolate),
                          v8::ScriptCompiler::StreamedSource::UTF8),
-        task_(v8::ScriptCompiler::StartStreamingScript(isolate,
-                                                       &streamed_source_)) {}
+        task_(is_module ? v8::ScriptCompiler::StartStreamingModule(
+                              isolate, &streamed_source_)
+                        : v8::ScriptCompiler::StartStreamingScript(
+                              isolate, &streamed_source_)) {}
 
   void Run() override { task_->Run(); }
 
@@ -426,6 +429,22 @@ class BackgroundCompileThread : public base::Thread {
   std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task_;
 };
 
+namespace {
+
+// Compiles {source} on a background thread through the streaming API, the way
+// an embedder compiles a script while it arrives from the network.
+MaybeLocal<Script> CompileStreamed(Local<Context> context, Local<String> source,
+                                   const ScriptOrigin& origin) {
+  BackgroundCompileThread background_compile_thread(context->GetIsolate(),
+                                                    source);
+  background_compile_thread.Start();
+  background_compile_thread.Join();
+  return ScriptCompiler::Compile(
+      context, background_compile_thread.streamed_source(), source, origin);
+}
+
+}  // namespace
+
 ScriptCompiler::CachedData* Shell::LookupCodeCache(Isolate* isolate,
                                                    Local<Value> source) {
   base::MutexGuard lock_guard(cached_code_mutex_.Pointer());
@@ -509,6 +528,8 @@ bool Shell::ExecuteString(Isolate* isolate, Local<String> source,
       background_compile_thread.Join();
       maybe_script = v8::ScriptCompiler::Compile(
           context, background_compile_thread.streamed_source(), source, origin);
+    } else if (options.streaming_compile) {
+      maybe_script = CompileStreamed(context, source, origin);
     } else {
       ScriptCompiler::Source script_source(source, origin);
       maybe_script = ScriptCompiler::Compile(context, &script_source,
@@ -706,10 +727,23 @@ MaybeLocal<Module> Shell::FetchModuleTree(Local<Context> context,
           .ToLocalChecked(),
       Local<Integer>(), Local<Integer>(), Local<Boolean>(), Local<Integer>(),
       Local<Value>(), Local<Boolean>(), Local<Boolean>(), True(isolate));
-  ScriptCompiler::Source source(source_text, origin);
   Local<Module> module;
-  if (!ScriptCompiler::CompileModule(isolate, &source).ToLocal(&module)) {
-    return MaybeLocal<Module>();
+  if (options.streaming_compile) {
+    BackgroundCompileThread background_compile_thread(isolate, source_text,
+                                                      true);
+    background_compile_thread.Start();
+    background_compile_thread.Join();
+    if (!ScriptCompiler::CompileModule(
+             context, background_compile_thread.streamed_source(),
+             source_text, origin)
+             .ToLocal(&module)) {
+      return MaybeLocal<Module>();
+    }
+  } else {
+    ScriptCompiler::Source source(source_text, origin);
+    if (!ScriptCompiler::CompileModule(isolate, &source).ToLocal(&module)) {
+      return MaybeLocal<Module>();
+    }
   }
 
   ModuleEmbedderData* d = GetModuleDataFromContext(context);
@@ -1130,14 +1164,24 @@ void Shell::RealmEval(const v8::FunctionCallbackInfo<v8::Value>& args) {
     Throw(args.GetIsolate(), "Invalid argument");
     return;
   }
-  ScriptCompiler::Source script_source(
-      args[1]->ToString(isolate->GetCurrentContext()).ToLocalChecked());
+  Local<String> source =
+      args[1]->ToString(isolate->GetCurrentContext()).ToLocalChecked();
+  Local<Context> realm = Local<Context>::New(isolate, data->realms_[index]);
   Local<UnboundScript> script;
-  if (!ScriptCompiler::CompileUnboundScript(isolate, &script_source)
-           .ToLocal(&script)) {
-    return;
+  if (options.streaming_compile) {
+    Local<Script> bound_script;
+    if (!CompileStreamed(realm, source, ScriptOrigin(Undefined(isolate)))
+             .ToLocal(&bound_script)) {
+      return;
+    }
+    script = bound_script->GetUnboundScript();
+  } else {
+    ScriptCompiler::Source script_source(source);
+    if (!ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+             .ToLocal(&script)) {
+      return;
+    }
   }
-  Local<Context> realm = Local<Context>::New(isolate, data->realms_[index]);
   realm->Enter();
   int previous_index = data->realm_current_;
   data->realm_current_ = data->realm_switch_ = index;
@@ -2170,6 +2214,30 @@ static char* ReadChars(const char* name, int* size_out) {
   return chars;
 }
 
+static void LoadTypeFeedbackCache(Isolate* isolate, const char* name) {
+  int size = 0;
+  char* chars = ReadChars(name, &size);
+  if (chars == nullptr) return;  // Not produced yet.
+  ScriptCompiler::CachedData cached_data(
+      reinterpret_cast<const uint8_t*>(chars), size);
+  if (!ScriptCompiler::ConsumeTypeFeedbackCache(isolate, &cached_data)) {
+    fprintf(stderr, "Ignoring stale type feedback cache '%s'.\n", name);
+  }
+  delete[] chars;
+}
+
+static void StoreTypeFeedbackCache(Isolate* isolate, const char* name) {
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateTypeFeedbackCache(isolate));
+  FILE* file = FOpen(name, "wb");
+  if (file == nullptr) {
+    fprintf(stderr, "Cannot write type feedback cache '%s'.\n", name);
+    return;
+  }
+  fwrite(cached_data->data, 1, cached_data->length, file);
+  fclose(file);
+}
+
 
 struct DataAndPersistent {
   uint8_t* data;
@@ -2771,6 +2839,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
                strcmp(argv[i], "--no-stress-background-compile") == 0) {
       options.stress_background_compile = false;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--streaming-compile") == 0) {
+      options.streaming_compile = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--noalways-opt") == 0 ||
                strcmp(argv[i], "--no-always-opt") == 0) {
       // No support for stressing if we can't use --always-opt.
@@ -2849,6 +2920,9 @@ bool Shell::SetOptions(int argc, char* argv[]) {
         return false;
       }
       argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--type-feedback-cache=", 22) == 0) {
+      options.type_feedback_cache = argv[i] + 22;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--enable-tracing") == 0) {
       options.trace_enabled = true;
       argv[i] = nullptr;
@@ -3436,6 +3510,10 @@ int Shell::Main(int argc, char* argv[]) {
       tracing_controller->StartTracing(trace_config);
     }
 
+    if (options.type_feedback_cache != nullptr) {
+      LoadTypeFeedbackCache(isolate, options.type_feedback_cache);
+    }
+
     if (options.stress_opt || options.stress_deopt) {
       Testing::SetStressRunType(options.stress_opt
                                 ? Testing::kStressTypeOpt
@@ -3509,6 +3587,10 @@ int Shell::Main(int argc, char* argv[]) {
       WriteIgnitionDispatchCountersFile(isolate);
     }
 
+    if (options.type_feedback_cache != nullptr) {
+      StoreTypeFeedbackCache(isolate, options.type_feedback_cache);
+    }
+
     // Shut down contexts and collect garbage.
     cached_code_map_.clear();
     evaluation_context_.Reset();
@@ -341,6 +341,7 @@ class ShellOptions {
         num_isolates(1),
         compile_options(v8::ScriptCompiler::kNoCompileOptions),
         stress_background_compile(false),
+        streaming_compile(false),
         code_cache_options(CodeCacheOptions::kNoProduceCache),
         isolate_sources(nullptr),
         icu_data_file(nullptr),
@@ -373,6 +374,7 @@ class ShellOptions {
   int num_isolates;
   v8::ScriptCompiler::CompileOptions compile_options;
   bool stress_background_compile;
+  bool streaming_compile;
   CodeCacheOptions code_cache_options;
   SourceGroup* isolate_sources;
   const char* icu_data_file;
@@ -388,6 +390,7 @@ class ShellOptions {
   bool quiet_load = false;
   int thread_pool_size = 0;
   bool stress_delay_tasks = false;
+  const char* type_feedback_cache = nullptr;
   std::vector<const char*> arguments;
   bool include_arguments = true;
 };
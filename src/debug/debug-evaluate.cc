@@ -945,6 +945,7 @@ static bool TransitivelyCalledBuiltinHasNoSideEffect(Builtins::Name caller,
     case Builtins::kExtractFastJSArray:
     case Builtins::kFastNewObject:
     case Builtins::kFindOrderedHashMapEntry:
+    case Builtins::kFindOrderedHashSetEntry:
     case Builtins::kFlatMapIntoArray:
     case Builtins::kFlattenIntoArray:
     case Builtins::kGetProperty:
@@ -482,6 +482,19 @@ int GetDebuggingId(v8::Local<v8::Function> function);
 bool SetFunctionBreakpoint(v8::Local<v8::Function> function,
                            v8::Local<v8::String> condition, BreakpointId* id);
 
+struct DeoptHistoryEntry {
+  int bytecode_offset;
+  const char* reason;
+  const char* kind;
+  int count;
+};
+
+// Returns where and why optimized code for {function} deoptimized, one entry
+// per bytecode offset, reason and kind. Deopts inside inlined code are
+// attributed to the inlined function.
+std::vector<DeoptHistoryEntry> GetDeoptHistory(
+    v8::Local<v8::Function> function);
+
 v8::Platform* GetCurrentPlatform();
 
 class PostponeInterruptsScope {
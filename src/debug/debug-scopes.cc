@@ -907,7 +907,8 @@ bool ScopeIterator::SetScriptVariableValue(Handle<String> variable_name,
                                  &lookup_result)) {
     Handle<Context> script_context = ScriptContextTable::GetContext(
         isolate_, script_contexts, lookup_result.context_index);
-    script_context->set(lookup_result.slot_index, *new_value);
+    Context::StoreScriptContextSlot(isolate_, script_context,
+                                    lookup_result.slot_index, new_value);
     return true;
   }
 
@@ -37,6 +37,7 @@ namespace internal {
   V(MinusZero, "minus zero")                                                   \
   V(NaN, "NaN")                                                                \
   V(NoCache, "no cache")                                                       \
+  V(NotABigInt, "not a BigInt")                                                \
   V(NotAHeapNumber, "not a heap number")                                       \
   V(NotAJavaScriptObject, "not a JavaScript object")                           \
   V(NotAJavaScriptObjectOrNullOrUndefined,                                     \
@@ -53,6 +54,7 @@ namespace internal {
   V(ValueMismatch, "value mismatch")                                           \
   V(WrongCallTarget, "wrong call target")                                      \
   V(WrongEnumIndices, "wrong enum indices")                                    \
+  V(WrongFeedbackCell, "wrong feedback cell")                                  \
   V(WrongInstanceType, "wrong instance type")                                  \
   V(WrongMap, "wrong map")                                                     \
   V(WrongName, "wrong name")                                                   \
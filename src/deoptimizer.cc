@@ -4,11 +4,13 @@
 
 #include "src/deoptimizer.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "src/accessors.h"
 #include "src/assembler-inl.h"
 #include "src/ast/prettyprinter.h"
+#include "src/base/functional.h"
 #include "src/callable.h"
 #include "src/counters.h"
 #include "src/disasm.h"
@@ -490,6 +492,20 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction function,
   compiled_code_ = FindOptimizedCode();
   DCHECK(!compiled_code_.is_null());
 
+  if (kSupportsFixedDeoptExitSize) {
+    DCHECK_EQ(kFixedExitSizeMarker, bailout_id_);
+    // Compute the bailout id from the return address, which points right
+    // after the exit that called the deoptimization entry.
+    DeoptimizationData deopt_data =
+        DeoptimizationData::cast(compiled_code_->deoptimization_data());
+    Address deopt_start = compiled_code_->raw_instruction_start() +
+                          deopt_data->DeoptExitStart()->value();
+    int offset = static_cast<int>(from_ - kDeoptExitSize - deopt_start);
+    DCHECK_LE(0, offset);
+    DCHECK_EQ(0, offset % kDeoptExitSize);
+    bailout_id_ = offset / kDeoptExitSize;
+  }
+
   DCHECK(function->IsJSFunction());
   trace_scope_ = FLAG_trace_deopt
                      ? new CodeTracer::Scope(isolate->GetCodeTracer())
@@ -1770,10 +1786,33 @@ void Deoptimizer::MaterializeHeapObjects() {
                                        " from deoptimization at ", from_);
   }
 
+  RecordDeoptInHistory();
+
   isolate_->materialized_object_store()->Remove(
       static_cast<Address>(stack_fp_));
 }
 
+void Deoptimizer::RecordDeoptInHistory() {
+  if (compiled_code_->kind() != Code::OPTIMIZED_FUNCTION) return;
+  // Attribute the deopt to the innermost interpreted frame, which is the
+  // (possibly inlined) function whose speculation failed.
+  auto& frames = translated_state_.frames();
+  for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+    if (it->kind() != TranslatedFrame::kInterpretedFunction) continue;
+    Handle<Object> function = it->begin()->GetValue();
+    if (!function->IsJSFunction() ||
+        !Handle<JSFunction>::cast(function)->has_feedback_vector()) {
+      return;
+    }
+    Handle<FeedbackVector> vector(
+        Handle<JSFunction>::cast(function)->feedback_vector(), isolate_);
+    DeoptInfo info = GetDeoptInfo(compiled_code_, from_);
+    FeedbackVector::RecordDeopt(isolate_, vector, it->node_id().ToInt(),
+                                info.deopt_reason, deopt_kind_);
+    return;
+  }
+}
+
 void Deoptimizer::QueueValueForMaterialization(
     Address output_address, Object obj,
     const TranslatedFrame::iterator& iterator) {
@@ -1885,33 +1924,75 @@ FrameDescription::FrameDescription(uint32_t frame_size, int parameter_count)
   }
 }
 
-void TranslationBuffer::Add(int32_t value) {
+namespace {
+
+uint32_t TranslationValueBits(int32_t value) {
   // This wouldn't handle kMinInt correctly if it ever encountered it.
   DCHECK_NE(value, kMinInt);
   // Encode the sign bit in the least significant bit.
   bool is_negative = (value < 0);
-  uint32_t bits = (static_cast<uint32_t>(is_negative ? -value : value) << 1) |
-                  static_cast<uint32_t>(is_negative);
+  return (static_cast<uint32_t>(is_negative ? -value : value) << 1) |
+         static_cast<uint32_t>(is_negative);
+}
+
+template <typename Vector>
+void EncodeTranslationValue(int32_t value, Vector* out) {
+  uint32_t bits = TranslationValueBits(value);
   // Encode the individual bytes using the least significant bit of
   // each byte to indicate whether or not more bytes follow.
   do {
     uint32_t next = bits >> 7;
-    contents_.push_back(((bits << 1) & 0xFF) | (next != 0));
+    out->push_back(((bits << 1) & 0xFF) | (next != 0));
     bits = next;
   } while (bits != 0);
 }
 
+int EncodedTranslationValueSize(int32_t value) {
+  int size = 1;
+  for (uint32_t bits = TranslationValueBits(value) >> 7; bits != 0;
+       bits >>= 7) {
+    size++;
+  }
+  return size;
+}
+
+}  // namespace
+
+void TranslationBuffer::Add(int32_t value) {
+  EncodeTranslationValue(value, &contents_);
+}
+
 TranslationIterator::TranslationIterator(ByteArray buffer, int index)
     : buffer_(buffer), index_(index) {
   DCHECK(index >= 0 && index < buffer->length());
 }
 
 int32_t TranslationIterator::Next() {
+  DCHECK(HasNext());
+  if (remaining_in_reference_ == 0 &&
+      buffer_->get(index_) == TranslationBuffer::kReferenceMarker) {
+    index_++;
+    int target = ReadValue();
+    int count = ReadValue();
+    DCHECK_LT(target, index_);
+    DCHECK_LT(0, count);
+    index_after_reference_ = index_;
+    index_ = target;
+    remaining_in_reference_ = count;
+  }
+  int32_t value = ReadValue();
+  if (remaining_in_reference_ > 0 && --remaining_in_reference_ == 0) {
+    index_ = index_after_reference_;
+  }
+  return value;
+}
+
+int32_t TranslationIterator::ReadValue() {
   // Run through the bytes until we reach one with a least significant
   // bit of zero (marks the end).
   uint32_t bits = 0;
   for (int i = 0; true; i += 7) {
-    DCHECK(HasNext());
+    DCHECK_LT(index_, buffer_->length());
     uint8_t next = buffer_->get(index_++);
     bits |= (next >> 1) << i;
     if ((next & 1) == 0) break;
@@ -1922,14 +2003,117 @@ int32_t TranslationIterator::Next() {
   return is_negative ? -result : result;
 }
 
-bool TranslationIterator::HasNext() const { return index_ < buffer_->length(); }
+bool TranslationIterator::HasNext() const {
+  return remaining_in_reference_ > 0 || index_ < buffer_->length();
+}
+
+int TranslationBuffer::Deduplicate(int index) {
+  DCHECK_LE(0, index);
+  DCHECK_LT(index, CurrentIndex());
+  auto begin = contents_.begin() + index;
+  int size = CurrentIndex() - index;
+  size_t hash = base::hash_range(begin, contents_.end());
+  auto it = translations_.find(hash);
+  if (it == translations_.end()) {
+    translations_.insert(std::make_pair(hash, std::make_pair(index, size)));
+    starts_.push_back(index);
+    return index;
+  }
+  int other_index = it->second.first;
+  if (it->second.second != size ||
+      !std::equal(begin, contents_.end(), contents_.begin() + other_index)) {
+    starts_.push_back(index);
+    return index;
+  }
+  contents_.resize(index);
+  return other_index;
+}
 
 Handle<ByteArray> TranslationBuffer::CreateByteArray(Factory* factory) {
-  Handle<ByteArray> result = factory->NewByteArray(CurrentIndex(), TENURED);
-  contents_.CopyTo(result->GetDataStartAddress());
+  DCHECK_IMPLIES(!starts_.empty(), starts_.front() == 0);
+  // An encoded value, at {index} in the buffer, and at {byte_array_index} in
+  // the byte array, either copied there or referenced.
+  struct Value {
+    int index;
+    int size;
+    int byte_array_index;
+  };
+  auto same_value = [this](const Value& a, const Value& b) {
+    return a.size == b.size &&
+           std::equal(contents_.begin() + a.index,
+                      contents_.begin() + a.index + a.size,
+                      contents_.begin() + b.index);
+  };
+
+  std::vector<uint8_t> bytes;
+  auto copy_value = [this, &bytes](Value* value) {
+    value->byte_array_index = static_cast<int>(bytes.size());
+    bytes.insert(bytes.end(), contents_.begin() + value->index,
+                 contents_.begin() + value->index + value->size);
+  };
+
+  std::vector<Value> previous;
+  byte_array_starts_.clear();
+  for (size_t i = 0; i < starts_.size(); i++) {
+    int end = i + 1 < starts_.size() ? starts_[i + 1] : CurrentIndex();
+    std::vector<Value> values;
+    for (int index = starts_[i]; index < end;) {
+      int size = 1;
+      while (contents_[index + size - 1] & 1) size++;
+      values.push_back({index, size, -1});
+      index += size;
+    }
+    byte_array_starts_.push_back(static_cast<int>(bytes.size()));
+
+    size_t common = 0;
+    while (common < values.size() && common < previous.size() &&
+           same_value(values[common], previous[common])) {
+      common++;
+    }
+    size_t first = 0;
+    while (first < common) {
+      // Find the values from {first} on that the previous translation has
+      // next to each other in the byte array, and reference them if that is
+      // shorter than copying them.
+      int target = previous[first].byte_array_index;
+      int size = 0;
+      size_t last = first;
+      while (last < common &&
+             previous[last].byte_array_index == target + size) {
+        size += values[last].size;
+        last++;
+      }
+      int count = static_cast<int>(last - first);
+      if (size > 1 + EncodedTranslationValueSize(target) +
+                     EncodedTranslationValueSize(count)) {
+        bytes.push_back(kReferenceMarker);
+        EncodeTranslationValue(target, &bytes);
+        EncodeTranslationValue(count, &bytes);
+        for (size_t j = first; j < last; j++) {
+          values[j].byte_array_index = previous[j].byte_array_index;
+        }
+      } else {
+        for (size_t j = first; j < last; j++) copy_value(&values[j]);
+      }
+      first = last;
+    }
+    for (size_t j = common; j < values.size(); j++) copy_value(&values[j]);
+    previous.swap(values);
+  }
+
+  Handle<ByteArray> result =
+      factory->NewByteArray(static_cast<int>(bytes.size()), TENURED);
+  std::copy(bytes.begin(), bytes.end(), result->GetDataStartAddress());
   return result;
 }
 
+int TranslationBuffer::IndexInByteArray(int index) const {
+  DCHECK_EQ(starts_.size(), byte_array_starts_.size());
+  auto it = std::lower_bound(starts_.begin(), starts_.end(), index);
+  DCHECK(it != starts_.end() && *it == index);
+  return byte_array_starts_[it - starts_.begin()];
+}
+
 void Translation::BeginBuiltinContinuationFrame(BailoutId bailout_id,
                                                 int literal_id,
                                                 unsigned height) {
@@ -23,6 +23,7 @@
 #include "src/register-arch.h"
 #include "src/source-position.h"
 #include "src/zone/zone-chunk-list.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -522,11 +523,22 @@ class Deoptimizer : public Malloced {
 
   static const int kMaxNumberOfEntries = 16384;
 
+  // Set to true when the architecture emits deoptimization exits of a fixed
+  // size, kDeoptExitSize bytes each, one per deoptimization id and in that
+  // order. The deoptimization entry then does not get the bailout id passed
+  // in a register but kFixedExitSizeMarker, and the id is computed from the
+  // return address into the exits instead.
+  static const bool kSupportsFixedDeoptExitSize;
+  static const int kDeoptExitSize;
+  static const unsigned kFixedExitSizeMarker = kMaxUInt32;
+
  private:
   friend class FrameWriter;
   void QueueValueForMaterialization(Address output_address, Object obj,
                                     const TranslatedFrame::iterator& iterator);
-
+  // Records the deopt in the deopt history of the feedback vector of the
+  // innermost deoptimized frame, see FeedbackVector::RecordDeopt.
+  void RecordDeoptInHistory();
 
   Deoptimizer(Isolate* isolate, JSFunction function, DeoptimizeKind kind,
               unsigned bailout_id, Address from, int fp_to_sp_delta);
@@ -867,15 +879,41 @@ class DeoptimizerData {
 
 class TranslationBuffer {
  public:
-  explicit TranslationBuffer(Zone* zone) : contents_(zone) {}
+  explicit TranslationBuffer(Zone* zone)
+      : contents_(zone),
+        translations_(zone),
+        starts_(zone),
+        byte_array_starts_(zone) {}
 
   int CurrentIndex() const { return static_cast<int>(contents_.size()); }
   void Add(int32_t value);
 
+  // Drops the translation from {index} to the end of the buffer if the buffer
+  // already holds an identical one, and returns the index of the translation
+  // to use. Many deopt points of a function, e.g. the checks for a single
+  // bytecode, share their translation.
+  int Deduplicate(int index);
+
+  // Creates the byte array holding all translations. The values a translation
+  // starts with that the previous translation starts with too, e.g. the
+  // frames of the functions an inlined call is nested in, are encoded as a
+  // reference to the earlier copy. Translations therefore move, and
+  // IndexInByteArray maps their indices in the buffer to the byte array.
   Handle<ByteArray> CreateByteArray(Factory* factory);
+  int IndexInByteArray(int index) const;
+
+  // Starts a reference, followed by the index of the first value and the
+  // number of values. Add never emits it, since it would encode -0.
+  static const uint8_t kReferenceMarker = 0x02;
 
  private:
-  ZoneChunkList<uint8_t> contents_;
+  ZoneVector<uint8_t> contents_;
+  // Maps the hash of each translation in the buffer to its index and size.
+  ZoneUnorderedMap<size_t, std::pair<int, int>> translations_;
+  // The index of each translation kept by Deduplicate, in the buffer and in
+  // the byte array.
+  ZoneVector<int> starts_;
+  ZoneVector<int> byte_array_starts_;
 };
 
 class TranslationIterator {
@@ -891,8 +929,14 @@ class TranslationIterator {
   }
 
  private:
+  int32_t ReadValue();
+
   ByteArray buffer_;
   int index_;
+  // While values are read from a reference, the number of values left in it
+  // and the index to continue at after it.
+  int remaining_in_reference_ = 0;
+  int index_after_reference_ = 0;
 };
 
 #define TRANSLATION_OPCODE_LIST(V)                     \
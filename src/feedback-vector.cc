@@ -3,12 +3,14 @@
 // found in the LICENSE file.
 
 #include "src/feedback-vector.h"
+#include "src/counters.h"
 #include "src/feedback-vector-inl.h"
 #include "src/ic/ic-inl.h"
 #include "src/objects.h"
 #include "src/objects/data-handler-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/map-inl.h"
+#include "src/snapshot/feedback-serializer.h"
 #include "src/objects/object-macros.h"
 
 namespace v8 {
@@ -210,6 +212,8 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
   const int slot_count = shared->feedback_metadata()->slot_count();
 
   Handle<FeedbackVector> vector = factory->NewFeedbackVector(shared, TENURED);
+  isolate->counters()->feedback_vectors_allocated()->Increment();
+  isolate->counters()->feedback_vector_bytes()->Increment(vector->Size());
 
   DCHECK_EQ(vector->length(), slot_count);
 
@@ -222,6 +226,7 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
   DCHECK_EQ(vector->invocation_count(), 0);
   DCHECK_EQ(vector->profiler_ticks(), 0);
   DCHECK_EQ(vector->deopt_count(), 0);
+  DCHECK_EQ(vector->deopt_history(), Smi::kZero);
 
   // Ensure we can skip the write barrier
   Handle<Object> uninitialized_sentinel = UninitializedSentinel(isolate);
@@ -286,6 +291,10 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
     i += entry_size;
   }
 
+  if (isolate->persisted_feedback() != nullptr) {
+    isolate->persisted_feedback()->Apply(*shared, *vector);
+  }
+
   Handle<FeedbackVector> result = Handle<FeedbackVector>::cast(vector);
   if (!isolate->is_best_effort_code_coverage() ||
       isolate->is_collecting_type_profile()) {
@@ -327,6 +336,61 @@ void FeedbackVector::SetOptimizationMarker(OptimizationMarker marker) {
   set_optimized_code_weak_or_smi(MaybeObject::FromSmi(Smi::FromEnum(marker)));
 }
 
+// static
+void FeedbackVector::RecordDeopt(Isolate* isolate,
+                                 Handle<FeedbackVector> vector,
+                                 int bytecode_offset, DeoptimizeReason reason,
+                                 DeoptimizeKind kind) {
+  Smi offset = Smi::FromInt(bytecode_offset);
+  Smi reason_smi = Smi::FromInt(static_cast<int>(reason));
+  Smi kind_smi = Smi::FromInt(static_cast<int>(kind));
+  int length = 0;
+  if (vector->deopt_history()->IsFixedArray()) {
+    FixedArray history = FixedArray::cast(vector->deopt_history());
+    for (int i = 0; i < history->length(); i += kDeoptHistoryEntrySize) {
+      if (history->get(i + kDeoptHistoryBytecodeOffsetIndex) == offset &&
+          history->get(i + kDeoptHistoryReasonIndex) == reason_smi &&
+          history->get(i + kDeoptHistoryKindIndex) == kind_smi) {
+        int count = Smi::ToInt(history->get(i + kDeoptHistoryCountIndex));
+        history->set(i + kDeoptHistoryCountIndex, Smi::FromInt(count + 1));
+        return;
+      }
+    }
+    length = history->length();
+  }
+  // Sites beyond the first kMaxDeoptHistoryEntries are not recorded; a
+  // function that deopts in that many places is better served by the
+  // deopt count based backoff in the RuntimeProfiler.
+  if (length == kMaxDeoptHistoryEntries * kDeoptHistoryEntrySize) return;
+
+  Handle<FixedArray> history = isolate->factory()->NewFixedArray(
+      length + kDeoptHistoryEntrySize, TENURED);
+  if (length > 0) {
+    FixedArray::cast(vector->deopt_history())
+        ->CopyTo(0, *history, 0, length);
+  }
+  history->set(length + kDeoptHistoryBytecodeOffsetIndex, offset);
+  history->set(length + kDeoptHistoryReasonIndex, reason_smi);
+  history->set(length + kDeoptHistoryKindIndex, kind_smi);
+  history->set(length + kDeoptHistoryCountIndex, Smi::FromInt(1));
+  vector->set_deopt_history(*history);
+}
+
+int FeedbackVector::EagerDeoptCountAt(int bytecode_offset) const {
+  if (!deopt_history()->IsFixedArray()) return 0;
+  FixedArray history = FixedArray::cast(deopt_history());
+  Smi offset = Smi::FromInt(bytecode_offset);
+  Smi kind = Smi::FromInt(static_cast<int>(DeoptimizeKind::kEager));
+  int count = 0;
+  for (int i = 0; i < history->length(); i += kDeoptHistoryEntrySize) {
+    if (history->get(i + kDeoptHistoryBytecodeOffsetIndex) == offset &&
+        history->get(i + kDeoptHistoryKindIndex) == kind) {
+      count += Smi::ToInt(history->get(i + kDeoptHistoryCountIndex));
+    }
+  }
+  return count;
+}
+
 void FeedbackVector::EvictOptimizedCodeMarkedForDeoptimization(
     SharedFunctionInfo shared, const char* reason) {
   MaybeObject slot = optimized_code_weak_or_smi();
@@ -841,9 +905,8 @@ void FeedbackNexus::SetSpeculationMode(SpeculationMode mode) {
   Object call_count = GetFeedbackExtra()->cast<Object>();
   CHECK(call_count->IsSmi());
   uint32_t count = static_cast<uint32_t>(Smi::ToInt(call_count));
-  uint32_t value = CallCountField::encode(CallCountField::decode(count));
-  int result = static_cast<int>(value | SpeculationModeField::encode(mode));
-  SetFeedbackExtra(Smi::FromInt(result), SKIP_WRITE_BARRIER);
+  uint32_t value = SpeculationModeField::update(count, mode);
+  SetFeedbackExtra(Smi::FromInt(static_cast<int>(value)), SKIP_WRITE_BARRIER);
 }
 
 SpeculationMode FeedbackNexus::GetSpeculationMode() {
@@ -855,6 +918,15 @@ SpeculationMode FeedbackNexus::GetSpeculationMode() {
   return SpeculationModeField::decode(value);
 }
 
+CallFeedbackContent FeedbackNexus::GetCallFeedbackContent() {
+  DCHECK(IsCallICKind(kind()));
+
+  Object call_count = GetFeedbackExtra()->cast<Object>();
+  CHECK(call_count->IsSmi());
+  uint32_t value = static_cast<uint32_t>(Smi::ToInt(call_count));
+  return CallFeedbackContentField::decode(value);
+}
+
 float FeedbackNexus::ComputeCallFrequency() {
   DCHECK(IsCallICKind(kind()));
 
@@ -1224,7 +1296,10 @@ MaybeHandle<JSObject> FeedbackNexus::GetConstructorFeedback() const {
   Isolate* isolate = GetIsolate();
   MaybeObject feedback = GetFeedback();
   HeapObject heap_object;
-  if (feedback->GetHeapObjectIfWeak(&heap_object)) {
+  // Instanceof sites only record JSObjects, but be defensive about the
+  // feedback cells that call sites record for several closures.
+  if (feedback->GetHeapObjectIfWeak(&heap_object) &&
+      heap_object->IsJSObject()) {
     return handle(JSObject::cast(heap_object), isolate);
   }
   return MaybeHandle<JSObject>();
@@ -9,6 +9,7 @@
 
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/deoptimize-reason.h"
 #include "src/elements-kind.h"
 #include "src/globals.h"
 #include "src/objects/map.h"
@@ -168,6 +169,11 @@ class FeedbackVector : public HeapObject {
   // marker defining optimization behaviour.
   DECL_ACCESSORS(optimized_code_weak_or_smi, MaybeObject)
 
+  // [deopt_history]: Smi zero, or a FixedArray recording where and why the
+  // optimized code of this function (or code it was inlined into)
+  // deoptimized, see {RecordDeopt}.
+  DECL_ACCESSORS(deopt_history, Object)
+
   // [length]: The length of the feedback vector (not including the header, i.e.
   // the number of feedback slots).
   DECL_INT32_ACCESSORS(length)
@@ -199,6 +205,24 @@ class FeedbackVector : public HeapObject {
   // Clears the optimization marker in the feedback vector.
   void ClearOptimizationMarker();
 
+  // Records a deopt at {bytecode_offset} in the deopt history. There is an
+  // entry per bytecode offset, reason and kind, for up to
+  // kMaxDeoptHistoryEntries entries.
+  static void RecordDeopt(Isolate* isolate, Handle<FeedbackVector> vector,
+                          int bytecode_offset, DeoptimizeReason reason,
+                          DeoptimizeKind kind);
+
+  // Returns the number of eager deopts recorded at {bytecode_offset}.
+  int EagerDeoptCountAt(int bytecode_offset) const;
+
+  // Layout of the entries of the deopt history.
+  static const int kDeoptHistoryBytecodeOffsetIndex = 0;
+  static const int kDeoptHistoryReasonIndex = 1;
+  static const int kDeoptHistoryKindIndex = 2;
+  static const int kDeoptHistoryCountIndex = 3;
+  static const int kDeoptHistoryEntrySize = 4;
+  static const int kMaxDeoptHistoryEntries = 16;
+
   // Conversion from a slot to an integer index to the underlying array.
   static int GetIndex(FeedbackSlot slot) { return slot.ToInt(); }
 
@@ -282,6 +306,7 @@ class FeedbackVector : public HeapObject {
   /* Header fields. */                      \
   V(kSharedFunctionInfoOffset, kTaggedSize) \
   V(kOptimizedCodeOffset, kTaggedSize)      \
+  V(kDeoptHistoryOffset, kTaggedSize)       \
   V(kLengthOffset, kInt32Size)              \
   V(kInvocationCountOffset, kInt32Size)     \
   V(kProfilerTicksOffset, kInt32Size)       \
@@ -654,13 +679,15 @@ class FeedbackNexus final {
   int GetCallCount();
   void SetSpeculationMode(SpeculationMode mode);
   SpeculationMode GetSpeculationMode();
+  CallFeedbackContent GetCallFeedbackContent();
 
   // Compute the call frequency based on the call count and the invocation
   // count (taken from the type feedback vector).
   float ComputeCallFrequency();
 
   typedef BitField<SpeculationMode, 0, 1> SpeculationModeField;
-  typedef BitField<uint32_t, 1, 31> CallCountField;
+  typedef BitField<CallFeedbackContent, 1, 1> CallFeedbackContentField;
+  typedef BitField<uint32_t, 2, 30> CallCountField;
 
   // For CreateClosure ICs.
   Handle<FeedbackCell> GetFeedbackCell() const;
@@ -346,10 +346,21 @@ DEFINE_INT(interrupt_budget, 144 * KB,
 #undef FLAG
 #define FLAG FLAG_FULL
 
+DEFINE_BOOL(lazy_feedback_allocation, false,
+            "Allocate feedback vectors lazily (experimental, memory savings "
+            "not measured yet)")
+DEFINE_INT(budget_for_feedback_vector_allocation, 1 * KB,
+           "the interrupt budget used before allocating a feedback vector "
+           "with --lazy-feedback-allocation")
+DEFINE_NEG_IMPLICATION(lite_mode, lazy_feedback_allocation)
+
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_short_star, false,
+            "use single-byte Star bytecodes for the first registers "
+            "(experimental, dispatch cost not measured yet)")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
@@ -412,6 +423,11 @@ DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
 DEFINE_BOOL(turbo_control_flow_aware_allocation, false,
             "consider control flow while allocating registers")
+DEFINE_BOOL(turbo_fast_register_allocation, false,
+            "always use the fast register allocation mode in TurboFan")
+DEFINE_INT(turbo_fast_register_allocation_queue_length, 0,
+           "use the fast register allocation mode for concurrent jobs queued "
+           "behind at least this many other jobs (0 = never)")
 
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
@@ -457,10 +473,19 @@ DEFINE_BOOL(turbo_stats_nvp, false,
             "print TurboFan statistics in machine-readable format")
 DEFINE_BOOL(turbo_stats_wasm, false,
             "print TurboFan statistics of wasm compilations")
+DEFINE_SIZE_T(turbo_max_zone_size, 512,
+              "zone memory (in Mbytes) after which TurboFan gives up on "
+              "optimizing a JavaScript function (0 means unlimited)")
+DEFINE_BOOL(trace_turbo_zone_peak, false,
+            "trace the peak zone memory and the phase reaching it for each "
+            "TurboFan compilation")
 DEFINE_BOOL(turbo_splitting, true, "split nodes during scheduling in TurboFan")
 DEFINE_BOOL(function_context_specialization, false,
             "enable function context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
+DEFINE_BOOL(script_context_const_tracking, false,
+            "track top-level let bindings that are never reassigned and "
+            "constant-fold them in TurboFan")
 DEFINE_INT(max_inlined_bytecode_size, 500,
            "maximum size of bytecode for a single inlining")
 DEFINE_INT(max_inlined_bytecode_size_cumulative, 1000,
@@ -483,12 +508,18 @@ DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size_absolute,
 DEFINE_VALUE_IMPLICATION(stress_inline, min_inlining_frequency, 0)
 DEFINE_VALUE_IMPLICATION(stress_inline, polymorphic_inlining, true)
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_INT(max_deopts_per_site, 2,
+           "number of eager deopts at a bytecode after which TurboFan stops "
+           "speculating on number feedback there (0 means never)")
 DEFINE_BOOL(inline_accessors, true, "inline JavaScript accessors")
 DEFINE_BOOL(inline_into_try, true, "inline into try blocks")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile code for on-stack replacement in the background")
+DEFINE_IMPLICATION(concurrent_osr, concurrent_recompilation)
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -504,6 +535,9 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
+DEFINE_BOOL(turbo_loop_vectorization_analysis, false,
+            "identify Turbofan loops over typed arrays that could use SIMD "
+            "(diagnostic only, does not vectorize)")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
@@ -780,6 +814,12 @@ DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
+DEFINE_BOOL(adaptive_bytecode_flushing, true,
+            "flush bytecode sooner when the heap is under memory pressure")
+DEFINE_BOOL(flush_bytecode_keep_preparse_data, false,
+            "keep the preparse data of lazily compiled functions, so that "
+            "recompiling them after their bytecode was flushed can skip "
+            "inner functions")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -865,6 +905,9 @@ DEFINE_BOOL(enable_regexp_unaligned_accesses, true,
 
 // api.cc
 DEFINE_BOOL(script_streaming, true, "enable parsing on background")
+DEFINE_BOOL(parallel_streaming_compile, false,
+            "compile the eager inner functions of streamed scripts on "
+            "several worker threads")
 DEFINE_BOOL(disable_old_api_accessors, false,
             "Disable old-style API accessors whose setters trigger through the "
             "prototype chain")
@@ -914,6 +957,11 @@ DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
+DEFINE_STRING(code_cache_dir, nullptr,
+              "directory in which V8 caches the code of compiled scripts")
+DEFINE_INT(code_cache_dir_warmup_delay, 5,
+           "seconds to run a script before writing its code to the "
+           "--code-cache-dir")
 #ifdef DEBUG
 DEFINE_BOOL(external_reference_stats, false,
             "print statistics on external references used during serialization")
@@ -921,6 +969,8 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(compilation_cache_eval_max_size, 4096,
+           "maximum size in KB of each of the eval compilation caches")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1014,6 +1064,22 @@ DEFINE_IMPLICATION(trace_maps, log_code)
 
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
+DEFINE_BOOL(parallel_preparse, false,
+            "preparse lazy top-level functions on worker threads")
+DEFINE_INT(parallel_preparse_min_source_length, 64 * KB,
+           "minimum length of a script for preparsing it in parallel")
+DEFINE_BOOL(stress_parallel_preparse, false,
+            "preparse all lazy top-level functions on worker threads before "
+            "parsing the script, regardless of its length")
+DEFINE_IMPLICATION(stress_parallel_preparse, parallel_preparse)
+
+// scanner.cc
+DEFINE_BOOL(vectorized_scanner, true,
+            "skip runs of whitespace, identifier and string literal "
+            "characters with vector instructions")
+DEFINE_BOOL(scan_one_byte_in_place, true,
+            "scan one-byte sources in place instead of widening them into "
+            "a UTF-16 buffer first")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_BOOL(trace_sim, false, "Trace simulator execution")
@@ -1439,6 +1505,8 @@ DEFINE_BOOL(single_threaded, false, "disable the use of background tasks")
 DEFINE_IMPLICATION(single_threaded, single_threaded_gc)
 DEFINE_NEG_IMPLICATION(single_threaded, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(single_threaded, compiler_dispatcher)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_streaming_compile)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_preparse)
 
 //
 // Parallel and concurrent GC (Orinoco) related flags.
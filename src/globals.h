@@ -535,6 +535,7 @@ class Descriptor;
 class DescriptorArray;
 class TransitionArray;
 class ExternalReference;
+class FeedbackCell;
 class FeedbackVector;
 class FixedArray;
 class Foreign;
@@ -1397,6 +1398,23 @@ inline std::ostream& operator<<(std::ostream& os,
   return os;
 }
 
+// Describes what the target feedback of a call site refers to: either the
+// called function itself, or, for calls to Function.prototype.apply,
+// Function.prototype.call and Reflect.apply, the function they forward to.
+enum class CallFeedbackContent { kTarget, kForwardedTarget };
+
+inline std::ostream& operator<<(std::ostream& os,
+                                CallFeedbackContent call_feedback_content) {
+  switch (call_feedback_content) {
+    case CallFeedbackContent::kTarget:
+      return os << "CallFeedbackContent::kTarget";
+    case CallFeedbackContent::kForwardedTarget:
+      return os << "CallFeedbackContent::kForwardedTarget";
+  }
+  UNREACHABLE();
+  return os;
+}
+
 enum class BlockingBehavior { kBlock, kDontBlock };
 
 enum class ConcurrencyMode { kNotConcurrent, kConcurrent };
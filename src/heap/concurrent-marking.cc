@@ -81,7 +81,7 @@ class ConcurrentMarkingVisitor final
       MemoryChunkDataMap* memory_chunk_data, WeakObjects* weak_objects,
       ConcurrentMarking::EmbedderTracingWorklist* embedder_objects, int task_id,
       bool embedder_tracing_enabled, unsigned mark_compact_epoch,
-      bool is_forced_gc)
+      bool is_forced_gc, BytecodeArray::Age old_bytecode_age)
       : shared_(shared, task_id),
         weak_objects_(weak_objects),
         embedder_objects_(embedder_objects, task_id),
@@ -90,7 +90,8 @@ class ConcurrentMarkingVisitor final
         task_id_(task_id),
         embedder_tracing_enabled_(embedder_tracing_enabled),
         mark_compact_epoch_(mark_compact_epoch),
-        is_forced_gc_(is_forced_gc) {}
+        is_forced_gc_(is_forced_gc),
+        old_bytecode_age_(old_bytecode_age) {}
 
   template <typename T>
   static V8_INLINE T Cast(HeapObject object) {
@@ -367,7 +368,7 @@ class ConcurrentMarkingVisitor final
 
     // If the SharedFunctionInfo has old bytecode, mark it as flushable,
     // otherwise visit the function data field strongly.
-    if (shared_info->ShouldFlushBytecode()) {
+    if (shared_info->ShouldFlushBytecode(old_bytecode_age_)) {
       weak_objects_->bytecode_flushing_candidates.Push(task_id_, shared_info);
     } else {
       VisitPointer(shared_info, shared_info->RawField(
@@ -676,6 +677,7 @@ class ConcurrentMarkingVisitor final
   bool embedder_tracing_enabled_;
   const unsigned mark_compact_epoch_;
   bool is_forced_gc_;
+  BytecodeArray::Age old_bytecode_age_;
 };
 
 // Strings can change maps due to conversion to thin string or external strings.
@@ -757,7 +759,8 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
   ConcurrentMarkingVisitor visitor(
       shared_, &task_state->memory_chunk_data, weak_objects_, embedder_objects_,
       task_id, heap_->local_embedder_heap_tracer()->InUse(),
-      task_state->mark_compact_epoch, task_state->is_forced_gc);
+      task_state->mark_compact_epoch, task_state->is_forced_gc,
+      task_state->old_bytecode_age);
   double time_ms;
   size_t marked_bytes = 0;
   if (FLAG_trace_concurrent_marking) {
@@ -889,6 +892,8 @@ void ConcurrentMarking::ScheduleTasks() {
       task_state_[i].mark_compact_epoch =
           heap_->mark_compact_collector()->epoch();
       task_state_[i].is_forced_gc = heap_->is_current_gc_forced();
+      task_state_[i].old_bytecode_age =
+          heap_->mark_compact_collector()->old_bytecode_age();
       is_pending_[i] = true;
       ++pending_task_count_;
       auto task =
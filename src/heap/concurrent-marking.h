@@ -14,6 +14,7 @@
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
 #include "src/heap/worklist.h"
+#include "src/objects/code.h"
 #include "src/utils.h"
 #include "src/v8.h"
 
@@ -107,6 +108,7 @@ class ConcurrentMarking {
     size_t marked_bytes = 0;
     unsigned mark_compact_epoch;
     bool is_forced_gc;
+    BytecodeArray::Age old_bytecode_age;
     char cache_line_padding[64];
   };
   class Task;
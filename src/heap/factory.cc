@@ -432,6 +432,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_optimized_code_weak_or_smi(MaybeObject::FromSmi(Smi::FromEnum(
       FLAG_log_function_events ? OptimizationMarker::kLogFirstExecution
                                : OptimizationMarker::kNone)));
+  vector->set_deopt_history(Smi::kZero);
   vector->set_length(length);
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
@@ -1492,7 +1493,18 @@ Handle<NativeContext> Factory::NewNativeContext() {
 Handle<Context> Factory::NewScriptContext(Handle<NativeContext> outer,
                                           Handle<ScopeInfo> scope_info) {
   DCHECK_EQ(scope_info->scope_type(), SCRIPT_SCOPE);
-  int variadic_part_length = scope_info->ContextLength();
+  // The side table tracking the let bindings that were reassigned lives in
+  // the slot after the context locals.
+  int local_count = scope_info->ContextLength() - Context::MIN_CONTEXT_SLOTS;
+  Handle<FixedArray> side_table = NewFixedArray(
+      Context::kScriptContextSideTableHeaderSize + local_count, TENURED);
+  Handle<PropertyCell> cell = NewPropertyCell(empty_string(), TENURED);
+  side_table->set(Context::kScriptContextSideTableCellIndex, *cell);
+  for (int i = 0; i < local_count; ++i) {
+    side_table->set(Context::kScriptContextSideTableHeaderSize + i,
+                    Smi::FromInt(Context::kConstScriptContextSlot));
+  }
+  int variadic_part_length = scope_info->ContextLength() + 1;
   Handle<Context> context = NewContext(RootIndex::kScriptContextMap,
                                        Context::SizeFor(variadic_part_length),
                                        variadic_part_length, TENURED);
@@ -1500,6 +1512,7 @@ Handle<Context> Factory::NewScriptContext(Handle<NativeContext> outer,
   context->set_previous(*outer);
   context->set_extension(*the_hole_value());
   context->set_native_context(*outer);
+  context->set(variadic_part_length - 1, *side_table);
   DCHECK(context->IsScriptContext());
   return context;
 }
@@ -1822,7 +1835,8 @@ Handle<BytecodeArray> Factory::NewBytecodeArray(
   instance->set_parameter_count(parameter_count);
   instance->set_incoming_new_target_or_generator_register(
       interpreter::Register::invalid_value());
-  instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
+  instance->set_interrupt_budget(
+      interpreter::Interpreter::InitialInterruptBudget());
   instance->set_osr_loop_nesting_level(0);
   instance->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
   instance->set_constant_pool(*constant_pool);
@@ -4896,6 +4896,16 @@ void Heap::AddRetainedMap(Handle<Map> map) {
   map->set_is_in_retained_map_list(true);
 }
 
+void Heap::KeepPreparseData(Handle<SharedFunctionInfo> shared,
+                            Handle<PreparseData> data) {
+  DCHECK(FLAG_flush_bytecode_keep_preparse_data);
+  DCHECK(shared->CanFlushBytecode());
+  Handle<KeptPreparseDataTable> table(
+      KeptPreparseDataTable::cast(kept_preparse_data()), isolate());
+  table = KeptPreparseDataTable::Put(isolate(), table, shared, data);
+  set_kept_preparse_data(EphemeronHashTable::cast(*table));
+}
+
 void Heap::CompactRetainedMaps(WeakArrayList retained_maps) {
   DCHECK_EQ(retained_maps, this->retained_maps());
   int length = retained_maps->length();
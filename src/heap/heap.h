@@ -534,6 +534,13 @@ class Heap {
 
   void AddRetainedMap(Handle<Map> map);
 
+  // Keeps the preparse data of {shared} while it is compiled. If its bytecode
+  // is flushed, the GC gives the data back to {shared}, so that recompiling
+  // it can skip its inner functions. Used by
+  // --flush-bytecode-keep-preparse-data.
+  void KeepPreparseData(Handle<SharedFunctionInfo> shared,
+                        Handle<PreparseData> data);
+
   // This event is triggered after successful allocation of a new object made
   // by runtime. Allocations of target space for object evacuation do not
   // trigger the event. In order to track ALL allocations one must turn off
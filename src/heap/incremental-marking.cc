@@ -337,6 +337,7 @@ void IncrementalMarking::StartMarking() {
 
   is_compacting_ =
       !FLAG_never_compact && heap_->mark_compact_collector()->StartCompaction();
+  heap_->mark_compact_collector()->StartBytecodeFlushing();
 
   SetState(MARKING);
 
@@ -9,6 +9,7 @@
 #include "src/base/utils/random-number-generator.h"
 #include "src/cancelable-task.h"
 #include "src/compilation-cache.h"
+#include "src/counters.h"
 #include "src/deoptimizer.h"
 #include "src/execution.h"
 #include "src/frames-inl.h"
@@ -805,6 +806,10 @@ void MarkCompactCollector::Prepare() {
     StartCompaction();
   }
 
+  if (!was_marked_incrementally_) {
+    StartBytecodeFlushing();
+  }
+
   PagedSpaces spaces(heap());
   for (PagedSpace* space = spaces.next(); space != nullptr;
        space = spaces.next()) {
@@ -819,6 +824,17 @@ void MarkCompactCollector::Prepare() {
 #endif
 }
 
+void MarkCompactCollector::StartBytecodeFlushing() {
+  old_bytecode_age_ = BytecodeArray::kIsOldBytecodeAge;
+  if (!FLAG_adaptive_bytecode_flushing) return;
+  if (heap()->HighMemoryPressure()) {
+    // Bytecode that was not executed since the last marking cycle is flushed.
+    old_bytecode_age_ = BytecodeArray::kQuadragenarianBytecodeAge;
+  } else if (heap()->ShouldOptimizeForMemoryUsage()) {
+    old_bytecode_age_ = BytecodeArray::kQuinquagenarianBytecodeAge;
+  }
+}
+
 void MarkCompactCollector::FinishConcurrentMarking(
     ConcurrentMarking::StopRequest stop_request) {
   // FinishConcurrentMarking is called for both, concurrent and parallel,
@@ -2000,6 +2016,16 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   int start_position = shared_info->StartPosition();
   int end_position = shared_info->EndPosition();
 
+  // With --flush-bytecode-keep-preparse-data, the function gets back the
+  // preparse data it had before it was compiled, so that recompiling it can
+  // skip its inner functions again.
+  Object preparse_data = ReadOnlyRoots(heap()).the_hole_value();
+  if (FLAG_flush_bytecode_keep_preparse_data) {
+    preparse_data = KeptPreparseDataTable::cast(heap()->kept_preparse_data())
+                        ->Take(isolate(), shared_info);
+  }
+  bool has_preparse_data = preparse_data->IsPreparseData();
+
   shared_info->DiscardCompiledMetadata(
       isolate(), [](HeapObject object, ObjectSlot slot, HeapObject target) {
         RecordSlot(object, slot, target);
@@ -2009,6 +2035,11 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // UncompiledData object.
   STATIC_ASSERT(BytecodeArray::SizeFor(0) >=
                 UncompiledDataWithoutPreparseData::kSize);
+  STATIC_ASSERT(BytecodeArray::SizeFor(0) >=
+                UncompiledDataWithPreparseData::kSize);
+  int uncompiled_data_size = has_preparse_data
+                                 ? UncompiledDataWithPreparseData::kSize
+                                 : UncompiledDataWithoutPreparseData::kSize;
 
   // Replace bytecode array with an uncompiled data array.
   HeapObject compiled_data = shared_info->GetBytecodeArray();
@@ -2027,25 +2058,41 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // Swap the map, using set_map_after_allocation to avoid verify heap checks
   // which are not necessary since we are doing this during the GC atomic pause.
   compiled_data->set_map_after_allocation(
-      ReadOnlyRoots(heap()).uncompiled_data_without_preparse_data_map(),
+      has_preparse_data
+          ? ReadOnlyRoots(heap()).uncompiled_data_with_preparse_data_map()
+          : ReadOnlyRoots(heap()).uncompiled_data_without_preparse_data_map(),
       SKIP_WRITE_BARRIER);
 
   // Create a filler object for any left over space in the bytecode array.
   if (!heap()->IsLargeObject(compiled_data)) {
     heap()->CreateFillerObjectAt(
-        compiled_data->address() + UncompiledDataWithoutPreparseData::kSize,
-        compiled_data_size - UncompiledDataWithoutPreparseData::kSize,
-        ClearRecordedSlots::kNo);
+        compiled_data->address() + uncompiled_data_size,
+        compiled_data_size - uncompiled_data_size, ClearRecordedSlots::kNo);
   }
 
   // Initialize the uncompiled data.
   UncompiledData uncompiled_data = UncompiledData::cast(compiled_data);
-  UncompiledData::Initialize(
-      uncompiled_data, inferred_name, start_position, end_position,
-      FunctionLiteral::kIdTypeInvalid,
-      [](HeapObject object, ObjectSlot slot, HeapObject target) {
-        RecordSlot(object, slot, target);
-      });
+  if (has_preparse_data) {
+    // The kept preparse data is held by the table as long as the function is
+    // alive, so it has already been marked.
+    DCHECK(non_atomic_marking_state()->IsBlackOrGrey(
+        HeapObject::cast(preparse_data)));
+    UncompiledDataWithPreparseData::Initialize(
+        UncompiledDataWithPreparseData::cast(uncompiled_data), inferred_name,
+        start_position, end_position, FunctionLiteral::kIdTypeInvalid,
+        PreparseData::cast(preparse_data),
+        [](HeapObject object, ObjectSlot slot, HeapObject target) {
+          RecordSlot(object, slot, target);
+        });
+    isolate()->counters()->kept_preparse_data_hits()->Increment();
+  } else {
+    UncompiledData::Initialize(
+        uncompiled_data, inferred_name, start_position, end_position,
+        FunctionLiteral::kIdTypeInvalid,
+        [](HeapObject object, ObjectSlot slot, HeapObject target) {
+          RecordSlot(object, slot, target);
+        });
+  }
 
   // Mark the uncompiled data as black, and ensure all fields have already been
   // marked.
@@ -2056,6 +2103,7 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   // performing the unusual task of decompiling.
   shared_info->set_function_data(uncompiled_data);
   DCHECK(!shared_info->is_compiled());
+  isolate()->counters()->bytecode_flushes()->Increment();
 }
 
 void MarkCompactCollector::ClearOldBytecodeCandidates() {
@@ -592,6 +592,13 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
 
   void AbortCompaction();
 
+  // Picks the bytecode age at which bytecode becomes a flushing candidate in
+  // the upcoming marking cycle. Bytecode is flushed sooner when the heap is
+  // under memory pressure.
+  void StartBytecodeFlushing();
+
+  BytecodeArray::Age old_bytecode_age() const { return old_bytecode_age_; }
+
   static inline bool IsOnEvacuationCandidate(Object obj) {
     return Page::FromAddress(obj->ptr())->IsEvacuationCandidate();
   }
@@ -904,6 +911,9 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // used, so it is okay if this counter overflows and wraps around.
   unsigned epoch_ = 0;
 
+  // Age at which bytecode is flushed during the current marking cycle.
+  BytecodeArray::Age old_bytecode_age_ = BytecodeArray::kIsOldBytecodeAge;
+
   friend class EphemeronHashTableMarkingTask;
   friend class FullEvacuator;
   friend class Heap;
@@ -802,6 +802,7 @@ void Heap::CreateInitialObjects() {
   set_empty_slow_element_dictionary(*slow_element_dictionary);
 
   set_materialized_objects(*factory->NewFixedArray(0, TENURED));
+  set_kept_preparse_data(*EphemeronHashTable::New(isolate(), 0, TENURED));
 
   // Handling of script id generation is in Heap::NextScriptId().
   set_last_script_id(Smi::FromInt(v8::UnboundScript::kNoScriptId));
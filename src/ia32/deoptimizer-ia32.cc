@@ -13,6 +13,10 @@
 namespace v8 {
 namespace internal {
 
+// Deoptimization exits are a single "call rel32" to the entry.
+const bool Deoptimizer::kSupportsFixedDeoptExitSize = true;
+const int Deoptimizer::kDeoptExitSize = 5;
+
 #define __ masm->
 
 void Deoptimizer::GenerateDeoptimizationEntries(MacroAssembler* masm,
@@ -52,8 +56,6 @@ void Deoptimizer::GenerateDeoptimizationEntries(MacroAssembler* masm,
   const int kSavedRegistersAreaSize =
       kNumberOfRegisters * kPointerSize + kDoubleRegsSize + kFloatRegsSize;
 
-  // The bailout id is passed in ebx by the caller.
-
   // Get the address of the location in the code object
   // and compute the fp-to-sp delta in register edx.
   __ mov(ecx, Operand(esp, kSavedRegistersAreaSize));
@@ -73,7 +75,9 @@ void Deoptimizer::GenerateDeoptimizationEntries(MacroAssembler* masm,
   __ mov(Operand(esp, 0 * kPointerSize), eax);  // Function.
   __ mov(Operand(esp, 1 * kPointerSize),
          Immediate(static_cast<int>(deopt_kind)));
-  __ mov(Operand(esp, 2 * kPointerSize), ebx);  // Bailout id.
+  // The bailout id is computed from the return address by the Deoptimizer.
+  __ mov(Operand(esp, 2 * kPointerSize),
+         Immediate(static_cast<int32_t>(kFixedExitSizeMarker)));
   __ mov(Operand(esp, 3 * kPointerSize), ecx);  // Code address or 0.
   __ mov(Operand(esp, 4 * kPointerSize), edx);  // Fp-to-sp delta.
   __ mov(Operand(esp, 5 * kPointerSize),
@@ -2031,9 +2031,9 @@ void TurboAssembler::ComputeCodeStartAddress(Register dst) {
 }
 
 void TurboAssembler::CallForDeoptimization(Address target, int deopt_id) {
-  NoRootArrayScope no_root_array(this);
-  // Save the deopt id in ebx (we don't need the roots array from now on).
-  mov(ebx, deopt_id);
+  // The Deoptimizer computes the {deopt_id} from the return address, see
+  // Deoptimizer::kSupportsFixedDeoptExitSize.
+  USE(deopt_id);
   call(target, RelocInfo::RUNTIME_ENTRY);
 }
 
@@ -1374,7 +1374,14 @@ MaybeHandle<Object> StoreGlobalIC::Store(Handle<Name> name,
       return ReferenceError(name);
     }
 
-    bool use_ic = (state() != NO_FEEDBACK) && FLAG_use_ic;
+    Context::StoreScriptContextSlot(isolate(), script_context,
+                                    lookup_result.slot_index, value);
+
+    // Stores to bindings that optimized code may treat as constant have to
+    // keep going through the runtime, so that the code can be deoptimized.
+    bool use_ic = (state() != NO_FEEDBACK) && FLAG_use_ic &&
+                  !script_context->IsConstScriptContextSlot(
+                      lookup_result.slot_index);
     if (use_ic) {
       if (nexus()->ConfigureLexicalVarMode(lookup_result.context_index,
                                            lookup_result.slot_index)) {
@@ -1386,8 +1393,6 @@ MaybeHandle<Object> StoreGlobalIC::Store(Handle<Name> name,
       }
       TraceIC("StoreGlobalIC", name);
     }
-
-    script_context->set(lookup_result.slot_index, *value);
     return value;
   }
 
@@ -2435,7 +2440,8 @@ RUNTIME_FUNCTION(Runtime_StoreGlobalIC_Slow) {
           isolate, NewReferenceError(MessageTemplate::kNotDefined, name));
     }
 
-    script_context->set(lookup_result.slot_index, *value);
+    Context::StoreScriptContextSlot(isolate, script_context,
+                                    lookup_result.slot_index, value);
     return *value;
   }
 
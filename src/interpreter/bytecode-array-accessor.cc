@@ -156,6 +156,15 @@ Register BytecodeArrayAccessor::GetRegisterOperand(int operand_index) const {
                                                 current_operand_scale());
 }
 
+Register BytecodeArrayAccessor::GetStarTargetRegister() const {
+  Bytecode bytecode = current_bytecode();
+  DCHECK(Bytecodes::IsAnyStar(bytecode));
+  if (Bytecodes::IsShortStar(bytecode)) {
+    return Register(Bytecodes::GetShortStarRegisterIndex(bytecode));
+  }
+  return GetRegisterOperand(0);
+}
+
 int BytecodeArrayAccessor::GetRegisterOperandRange(int operand_index) const {
   DCHECK_LE(operand_index, Bytecodes::NumberOfOperands(current_bytecode()));
   const OperandType* operand_types =
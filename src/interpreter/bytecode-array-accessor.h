@@ -89,6 +89,9 @@ class V8_EXPORT_PRIVATE BytecodeArrayAccessor {
   FeedbackSlot GetSlotOperand(int operand_index) const;
   uint32_t GetRegisterCountOperand(int operand_index) const;
   Register GetRegisterOperand(int operand_index) const;
+  // Returns the register that the current Star or short Star bytecode
+  // stores the accumulator to.
+  Register GetStarTargetRegister() const;
   int GetRegisterOperandRange(int operand_index) const;
   Runtime::FunctionId GetRuntimeIdOperand(int operand_index) const;
   Runtime::FunctionId GetIntrinsicIdOperand(int operand_index) const;
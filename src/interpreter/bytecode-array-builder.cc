@@ -138,9 +138,22 @@ void BytecodeArrayBuilder::AttachOrEmitDeferredSourceInfo(BytecodeNode* node) {
 
 void BytecodeArrayBuilder::Write(BytecodeNode* node) {
   AttachOrEmitDeferredSourceInfo(node);
+  if (node->bytecode() == Bytecode::kStar) MaybeUseShortStar(node);
   bytecode_array_writer_.Write(node);
 }
 
+void BytecodeArrayBuilder::MaybeUseShortStar(BytecodeNode* node) {
+  DCHECK_EQ(Bytecode::kStar, node->bytecode());
+  if (!FLAG_ignition_short_star) return;
+  // Stores to the first registers, which hold most of the locals and
+  // temporaries, have a single-byte form that dispatches to a handler
+  // specialized for the register.
+  Register reg = Register::FromOperand(static_cast<int32_t>(node->operand(0)));
+  if (reg.index() < 0 || reg.index() >= Bytecodes::kShortStarCount) return;
+  *node = BytecodeNode(Bytecodes::GetShortStarForRegisterIndex(reg.index()),
+                       node->source_info());
+}
+
 void BytecodeArrayBuilder::WriteJump(BytecodeNode* node, BytecodeLabel* label) {
   AttachOrEmitDeferredSourceInfo(node);
   bytecode_array_writer_.WriteJump(node, label);
@@ -582,6 +582,8 @@ class V8_EXPORT_PRIVATE BytecodeArrayBuilder final {
 
   // Write bytecode to bytecode array.
   void Write(BytecodeNode* node);
+  // Replaces the Star |node| with a short Star if its register has one.
+  void MaybeUseShortStar(BytecodeNode* node);
   void WriteJump(BytecodeNode* node, BytecodeLabel* label);
   void WriteSwitch(BytecodeNode* node, BytecodeJumpTable* label);
 
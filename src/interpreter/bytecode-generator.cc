@@ -2970,7 +2970,15 @@ void BytecodeGenerator::BuildVariableAssignment(
         builder()->LoadAccumulatorWithRegister(value_temp);
       }
 
-      if (mode != VariableMode::kConst || op == Token::INIT) {
+      if (mode == VariableMode::kLet && op != Token::INIT &&
+          variable->scope()->is_script_scope() &&
+          FLAG_script_context_const_tracking) {
+        // Reassignments of top-level let bindings go through the global
+        // store IC, which tracks whether the binding is still constant.
+        FeedbackSlot slot =
+            GetCachedStoreGlobalICSlot(language_mode(), variable);
+        builder()->StoreGlobal(variable->raw_name(), feedback_index(slot));
+      } else if (mode != VariableMode::kConst || op == Token::INIT) {
         builder()->StoreContextSlot(context_reg, variable->index(), depth);
       } else if (variable->throw_on_const_assignment(language_mode())) {
         builder()->CallRuntime(Runtime::kThrowConstAssignError);
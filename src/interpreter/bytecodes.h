@@ -21,6 +21,27 @@ namespace v8 {
 namespace internal {
 namespace interpreter {
 
+// The list of single-byte Star bytecodes, which store the accumulator to one
+// of the first registers without a register operand. They are listed in
+// reverse so that the register index is kStar0 - <bytecode>.
+#define SHORT_STAR_BYTECODE_LIST(V) \
+  V(Star15, AccumulatorUse::kRead)  \
+  V(Star14, AccumulatorUse::kRead)  \
+  V(Star13, AccumulatorUse::kRead)  \
+  V(Star12, AccumulatorUse::kRead)  \
+  V(Star11, AccumulatorUse::kRead)  \
+  V(Star10, AccumulatorUse::kRead)  \
+  V(Star9, AccumulatorUse::kRead)   \
+  V(Star8, AccumulatorUse::kRead)   \
+  V(Star7, AccumulatorUse::kRead)   \
+  V(Star6, AccumulatorUse::kRead)   \
+  V(Star5, AccumulatorUse::kRead)   \
+  V(Star4, AccumulatorUse::kRead)   \
+  V(Star3, AccumulatorUse::kRead)   \
+  V(Star2, AccumulatorUse::kRead)   \
+  V(Star1, AccumulatorUse::kRead)   \
+  V(Star0, AccumulatorUse::kRead)
+
 // The list of bytecodes which are interpreted by the interpreter.
 // Format is V(<bytecode>, <accumulator_use>, <operands>).
 #define BYTECODE_LIST(V)                                                       \
@@ -91,6 +112,7 @@ namespace interpreter {
   /* Register-accumulator transfers */                                         \
   V(Ldar, AccumulatorUse::kWrite, OperandType::kReg)                           \
   V(Star, AccumulatorUse::kRead, OperandType::kRegOut)                         \
+  SHORT_STAR_BYTECODE_LIST(V)                                                  \
                                                                                \
   /* Register-register transfers */                                            \
   V(Mov, AccumulatorUse::kNone, OperandType::kReg, OperandType::kRegOut)       \
@@ -472,6 +494,10 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // The total number of bytecodes used.
   static const int kBytecodeCount = static_cast<int>(Bytecode::kLast) + 1;
 
+  // The number of registers that have a short Star bytecode.
+  static const int kShortStarCount = static_cast<int>(Bytecode::kStar0) -
+                                     static_cast<int>(Bytecode::kStar15) + 1;
+
   // Returns string representation of |bytecode|.
   static const char* ToString(Bytecode bytecode);
 
@@ -570,7 +596,32 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   // e.g. Mov, Star.
   static constexpr bool IsRegisterLoadWithoutEffects(Bytecode bytecode) {
     return bytecode == Bytecode::kMov || bytecode == Bytecode::kPopContext ||
-           bytecode == Bytecode::kPushContext || bytecode == Bytecode::kStar;
+           bytecode == Bytecode::kPushContext || IsAnyStar(bytecode);
+  }
+
+  // Returns true if |bytecode| is one of the single-byte Star bytecodes.
+  static constexpr bool IsShortStar(Bytecode bytecode) {
+    return bytecode >= Bytecode::kStar15 && bytecode <= Bytecode::kStar0;
+  }
+
+  // Returns true if |bytecode| is Star or a short Star.
+  static constexpr bool IsAnyStar(Bytecode bytecode) {
+    return bytecode == Bytecode::kStar || IsShortStar(bytecode);
+  }
+
+  // Returns the index of the register a short Star |bytecode| stores to.
+  static int GetShortStarRegisterIndex(Bytecode bytecode) {
+    DCHECK(IsShortStar(bytecode));
+    return static_cast<int>(Bytecode::kStar0) - static_cast<int>(bytecode);
+  }
+
+  // Returns the short Star bytecode that stores to the register with index
+  // |register_index|, which must be less than kShortStarCount.
+  static Bytecode GetShortStarForRegisterIndex(int register_index) {
+    DCHECK_LE(0, register_index);
+    DCHECK_LT(register_index, kShortStarCount);
+    return static_cast<Bytecode>(static_cast<int>(Bytecode::kStar0) -
+                                 register_index);
   }
 
   // Returns true if the bytecode is a conditional jump taking
@@ -659,7 +710,7 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
 
   // Returns true if the bytecode is Ldar or Star.
   static constexpr bool IsLdarOrStar(Bytecode bytecode) {
-    return bytecode == Bytecode::kLdar || bytecode == Bytecode::kStar;
+    return bytecode == Bytecode::kLdar || IsAnyStar(bytecode);
   }
 
   // Returns true if the bytecode is a call or a constructor call.
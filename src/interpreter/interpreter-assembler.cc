@@ -721,9 +721,51 @@ void InterpreterAssembler::IncrementCallCount(Node* feedback_vector,
                           SKIP_WRITE_BARRIER, kTaggedSize);
 }
 
-void InterpreterAssembler::CollectCallableFeedback(Node* target, Node* context,
-                                                   Node* feedback_vector,
-                                                   Node* slot_id) {
+void InterpreterAssembler::UpdateCallFeedbackContent(
+    Node* feedback_vector, Node* slot_id, CallFeedbackContent content) {
+  Label done(this), update(this);
+  TNode<Smi> call_count =
+      CAST(LoadFeedbackVectorSlot(feedback_vector, slot_id, kTaggedSize));
+  const int mask = FeedbackNexus::CallFeedbackContentField::kMask;
+  Node* is_forwarded = IsSetSmi(call_count, mask);
+  if (content == CallFeedbackContent::kTarget) {
+    GotoIfNot(is_forwarded, &done);
+  } else {
+    GotoIf(is_forwarded, &done);
+  }
+
+  // The feedback collected so far is about a different function.
+  TNode<MaybeObject> feedback =
+      LoadFeedbackVectorSlot(feedback_vector, slot_id);
+  Node* is_uninitialized = WordEqual(
+      feedback, HeapConstant(FeedbackVector::UninitializedSentinel(isolate())));
+  GotoIf(is_uninitialized, &update);
+  Comment("transition to megamorphic");
+  StoreFeedbackVectorSlot(
+      feedback_vector, slot_id,
+      HeapConstant(FeedbackVector::MegamorphicSentinel(isolate())),
+      SKIP_WRITE_BARRIER);
+  ReportFeedbackUpdate(feedback_vector, slot_id,
+                       "Call:TransitionMegamorphic");
+  Goto(&update);
+
+  BIND(&update);
+  {
+    TNode<Smi> new_count = content == CallFeedbackContent::kTarget
+                               ? SmiAnd(call_count, SmiConstant(~mask))
+                               : SmiOr(call_count, SmiConstant(mask));
+    // Count is Smi, so we don't need a write barrier.
+    StoreFeedbackVectorSlot(feedback_vector, slot_id, new_count,
+                            SKIP_WRITE_BARRIER, kTaggedSize);
+    Goto(&done);
+  }
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::CollectCallableFeedback(
+    Node* target, Node* context, Node* feedback_vector, Node* slot_id,
+    CallableFeedbackKind kind) {
   Label extra_checks(this, Label::kDeferred), done(this);
 
   // Check if we have monomorphic {target} feedback already.
@@ -753,7 +795,43 @@ void InterpreterAssembler::CollectCallableFeedback(Node* target, Node* context,
     // If the weak reference is cleared, we have a new chance to become
     // monomorphic.
     Comment("check if weak reference is cleared");
-    Branch(IsCleared(feedback), &initialize, &mark_megamorphic);
+    GotoIf(IsCleared(feedback), &initialize);
+
+    if (kind == CallableFeedbackKind::kInstanceOf) {
+      Goto(&mark_megamorphic);
+    } else {
+      GotoIf(TaggedIsSmi(target), &mark_megamorphic);
+
+      // Check if {target} is a JSFunction.
+      Comment("check if target is a JSFunction");
+      GotoIfNot(IsJSFunction(target), &mark_megamorphic);
+
+      // Check if {target}s feedback cell matches the {feedback}, i.e. the
+      // call site saw several closures sharing that cell already.
+      TNode<HeapObject> feedback_value = GetHeapObjectAssumeWeak(feedback);
+      TNode<HeapObject> target_feedback_cell =
+          CAST(LoadObjectField(target, JSFunction::kFeedbackCellOffset));
+      GotoIf(WordEqual(feedback_value, target_feedback_cell), &done);
+
+      // Check if {target} was instantiated at the same closure creation site
+      // as the JSFunction in {feedback}, in which case we record their shared
+      // feedback cell instead of going megamorphic. Cells that hold no
+      // feedback vector (like the one shared by all builtins) do not
+      // identify a function.
+      Comment("check if target shares the feedback cell of the feedback");
+      GotoIfNot(IsJSFunction(feedback_value), &mark_megamorphic);
+      Node* feedback_value_cell =
+          LoadObjectField(feedback_value, JSFunction::kFeedbackCellOffset);
+      GotoIfNot(WordEqual(target_feedback_cell, feedback_value_cell),
+                &mark_megamorphic);
+      GotoIfNot(IsFeedbackVector(CAST(LoadObjectField(
+                    target_feedback_cell, FeedbackCell::kValueOffset))),
+                &mark_megamorphic);
+      StoreWeakReferenceInFeedbackVector(feedback_vector, slot_id,
+                                         target_feedback_cell);
+      ReportFeedbackUpdate(feedback_vector, slot_id, "Call:FeedbackCell");
+      Goto(&done);
+    }
 
     BIND(&initialize);
     {
@@ -834,7 +912,70 @@ void InterpreterAssembler::CollectCallFeedback(Node* target, Node* context,
   IncrementCallCount(maybe_feedback_vector, slot_id);
 
   // Collect the callable {target} feedback.
-  CollectCallableFeedback(target, context, maybe_feedback_vector, slot_id);
+  CollectCallableFeedback(target, context, maybe_feedback_vector, slot_id,
+                          CallableFeedbackKind::kCall);
+  Goto(&feedback_done);
+
+  BIND(&feedback_done);
+}
+
+void InterpreterAssembler::CollectCallFeedback(Node* target, Node* receiver,
+                                               Node* first_argument,
+                                               Node* context,
+                                               Node* maybe_feedback_vector,
+                                               Node* slot_id) {
+  VARIABLE(var_forwarded, MachineRepresentation::kTagged, receiver);
+  Label feedback_done(this), if_target(this),
+      if_forwarded(this, &var_forwarded),
+      if_not_monomorphic(this, Label::kDeferred);
+  // If feedback_vector is not valid, then nothing to do.
+  GotoIf(IsUndefined(maybe_feedback_vector), &feedback_done);
+
+  CSA_SLOW_ASSERT(this, IsFeedbackVector(maybe_feedback_vector));
+
+  // Increment the call count.
+  IncrementCallCount(maybe_feedback_vector, slot_id);
+
+  // Check if we have monomorphic {target} feedback already.
+  TNode<MaybeObject> feedback =
+      LoadFeedbackVectorSlot(maybe_feedback_vector, slot_id);
+  Branch(IsWeakReferenceTo(feedback, CAST(target)), &feedback_done,
+         &if_not_monomorphic);
+
+  BIND(&if_not_monomorphic);
+  {
+    // Check if {target} is one of the builtins that forward to another
+    // function.
+    GotoIf(TaggedIsSmi(target), &if_target);
+    GotoIfNot(IsJSFunction(target), &if_target);
+    Node* shared =
+        LoadObjectField(target, JSFunction::kSharedFunctionInfoOffset);
+    Node* function_data =
+        LoadObjectField(shared, SharedFunctionInfo::kFunctionDataOffset);
+    GotoIf(WordEqual(function_data,
+                     SmiConstant(Builtins::kFunctionPrototypeApply)),
+           &if_forwarded);
+    GotoIf(WordEqual(function_data,
+                     SmiConstant(Builtins::kFunctionPrototypeCall)),
+           &if_forwarded);
+    var_forwarded.Bind(first_argument);
+    Branch(WordEqual(function_data, SmiConstant(Builtins::kReflectApply)),
+           &if_forwarded, &if_target);
+
+    BIND(&if_forwarded);
+    UpdateCallFeedbackContent(maybe_feedback_vector, slot_id,
+                              CallFeedbackContent::kForwardedTarget);
+    CollectCallableFeedback(var_forwarded.value(), context,
+                            maybe_feedback_vector, slot_id,
+                            CallableFeedbackKind::kCall);
+    Goto(&feedback_done);
+  }
+
+  BIND(&if_target);
+  UpdateCallFeedbackContent(maybe_feedback_vector, slot_id,
+                            CallFeedbackContent::kTarget);
+  CollectCallableFeedback(target, context, maybe_feedback_vector, slot_id,
+                          CallableFeedbackKind::kCall);
   Goto(&feedback_done);
 
   BIND(&feedback_done);
@@ -1284,7 +1425,8 @@ void InterpreterAssembler::UpdateInterruptBudget(Node* weight, bool backward) {
     // Perform interrupt and reset budget.
     BIND(&interrupt_check);
     {
-      CallRuntime(Runtime::kInterrupt, GetContext());
+      CallRuntime(Runtime::kBytecodeBudgetInterrupt, GetContext(),
+                  LoadRegister(Register::function_closure()));
       new_budget.Bind(Int32Constant(Interpreter::InterruptBudget()));
       Goto(&ok);
     }
@@ -1360,14 +1502,15 @@ Node* InterpreterAssembler::LoadBytecode(Node* bytecode_offset) {
 }
 
 Node* InterpreterAssembler::StarDispatchLookahead(Node* target_bytecode) {
-  Label do_inline_star(this), done(this);
+  Label do_inline_star(this), check_short_star(this),
+      do_inline_short_star(this), done(this);
 
   Variable var_bytecode(this, MachineType::PointerRepresentation());
   var_bytecode.Bind(target_bytecode);
 
   Node* star_bytecode = IntPtrConstant(static_cast<int>(Bytecode::kStar));
   Node* is_star = WordEqual(target_bytecode, star_bytecode);
-  Branch(is_star, &do_inline_star, &done);
+  Branch(is_star, &do_inline_star, &check_short_star);
 
   BIND(&do_inline_star);
   {
@@ -1375,6 +1518,24 @@ Node* InterpreterAssembler::StarDispatchLookahead(Node* target_bytecode) {
     var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
     Goto(&done);
   }
+
+  BIND(&check_short_star);
+  {
+    // The short Star bytecodes are contiguous, so a single unsigned
+    // comparison checks for all of them.
+    Node* short_star_index = IntPtrSub(
+        target_bytecode, IntPtrConstant(static_cast<int>(Bytecode::kStar15)));
+    Node* is_short_star = UintPtrLessThan(
+        short_star_index, IntPtrConstant(Bytecodes::kShortStarCount));
+    Branch(is_short_star, &do_inline_short_star, &done);
+  }
+
+  BIND(&do_inline_short_star);
+  {
+    InlineShortStar(target_bytecode);
+    var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+    Goto(&done);
+  }
   BIND(&done);
   return var_bytecode.value();
 }
@@ -1399,6 +1560,33 @@ void InterpreterAssembler::InlineStar() {
   accumulator_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::InlineShortStar(Node* short_star_bytecode) {
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  // All short Star bytecodes have the same size and accumulator use, so any
+  // of them stands in for the one that is dispatched to.
+  bytecode_ = Bytecode::kStar0;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+#ifdef V8_TRACE_IGNITION
+  TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+#endif
+  // The register index is kStar0 - bytecode, so its operand is
+  // Register(0).ToOperand() - kStar0 + bytecode.
+  Node* reg_index = IntPtrAdd(
+      IntPtrConstant(Register(0).ToOperand() -
+                     static_cast<int>(Bytecode::kStar0)),
+      short_star_bytecode);
+  StoreRegister(GetAccumulator(), reg_index);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+
+  Advance();
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
 Node* InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
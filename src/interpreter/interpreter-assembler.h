@@ -156,11 +156,24 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   void IncrementCallCount(compiler::Node* feedback_vector,
                           compiler::Node* slot_id);
 
+  // Records in the call count at |slot_id+1| whether the feedback at
+  // |slot_id| is for the call target or for the function it forwards to.
+  // Switching between the two transitions the feedback to megamorphic.
+  void UpdateCallFeedbackContent(compiler::Node* feedback_vector,
+                                 compiler::Node* slot_id,
+                                 CallFeedbackContent content);
+
+  // The kind of IC that callable feedback is collected for. Only call sites
+  // record the feedback cell shared by several closures of a function;
+  // instanceof feedback always holds the JSObject it saw.
+  enum class CallableFeedbackKind { kCall, kInstanceOf };
+
   // Collect the callable |target| feedback for either a CALL_IC or
   // an INSTANCEOF_IC in the |feedback_vector| at |slot_id|.
   void CollectCallableFeedback(compiler::Node* target, compiler::Node* context,
                                compiler::Node* feedback_vector,
-                               compiler::Node* slot_id);
+                               compiler::Node* slot_id,
+                               CallableFeedbackKind kind);
 
   // Collect CALL_IC feedback for |target| function in the
   // |feedback_vector| at |slot_id|, and the call counts in
@@ -169,6 +182,16 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
                            compiler::Node* maybe_feedback_vector,
                            compiler::Node* slot_id);
 
+  // Like the above, but if |target| is Function.prototype.apply,
+  // Function.prototype.call or Reflect.apply, collects the feedback for the
+  // function they forward to instead, which is either the |receiver| or the
+  // |first_argument| of the call.
+  void CollectCallFeedback(compiler::Node* target, compiler::Node* receiver,
+                           compiler::Node* first_argument,
+                           compiler::Node* context,
+                           compiler::Node* maybe_feedback_vector,
+                           compiler::Node* slot_id);
+
   // Call JSFunction or Callable |function| with |args| arguments, possibly
   // including the receiver depending on |receiver_mode|. After the call returns
   // directly dispatches to the next bytecode.
@@ -397,14 +420,18 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // Load the bytecode at |bytecode_offset|.
   compiler::Node* LoadBytecode(compiler::Node* bytecode_offset);
 
-  // Look ahead for Star and inline it in a branch. Returns a new target
-  // bytecode node for dispatch.
+  // Look ahead for Star or a short Star and inline it in a branch. Returns a
+  // new target bytecode node for dispatch.
   compiler::Node* StarDispatchLookahead(compiler::Node* target_bytecode);
 
   // Build code for Star at the current BytecodeOffset() and Advance() to the
   // next dispatch offset.
   void InlineStar();
 
+  // Build code for the short Star |short_star_bytecode| at the current
+  // BytecodeOffset() and Advance() to the next dispatch offset.
+  void InlineShortStar(compiler::Node* short_star_bytecode);
+
   // Dispatch to the bytecode handler with code offset |handler|.
   compiler::Node* DispatchToBytecodeHandler(compiler::Node* handler,
                                             compiler::Node* bytecode_offset,
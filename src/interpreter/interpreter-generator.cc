@@ -143,6 +143,19 @@ IGNITION_HANDLER(Star, InterpreterAssembler) {
   Dispatch();
 }
 
+// Star0 - Star15
+//
+// Store accumulator to the register encoded in the bytecode, r0 - r15.
+#define SHORT_STAR_HANDLER(Name, ...)                               \
+  IGNITION_HANDLER(Name, InterpreterAssembler) {                    \
+    Node* accumulator = GetAccumulator();                           \
+    Register reg(Bytecodes::GetShortStarRegisterIndex(bytecode())); \
+    StoreRegister(accumulator, reg);                                \
+    Dispatch();                                                     \
+  }
+SHORT_STAR_BYTECODE_LIST(SHORT_STAR_HANDLER)
+#undef SHORT_STAR_HANDLER
+
 // Mov <src> <dst>
 //
 // Stores the value of register <src> to register <dst>.
@@ -1606,12 +1619,32 @@ class InterpreterJSCallAssembler : public InterpreterAssembler {
     Node* context = GetContext();
 
     // Collect the {function} feedback.
-    CollectCallFeedback(function, context, maybe_feedback_vector, slot_id);
+    Node* receiver;
+    Node* first_argument;
+    if (receiver_mode == ConvertReceiverMode::kNullOrUndefined) {
+      receiver = UndefinedConstant();
+      first_argument = LoadRegisterFromRegisterListOrUndefined(args, 0);
+    } else {
+      receiver = LoadRegisterFromRegisterListOrUndefined(args, 0);
+      first_argument = LoadRegisterFromRegisterListOrUndefined(args, 1);
+    }
+    CollectCallFeedback(function, receiver, first_argument, context,
+                        maybe_feedback_vector, slot_id);
 
     // Call the function and dispatch to the next handler.
     CallJSAndDispatch(function, context, args, receiver_mode);
   }
 
+  // Loads the register at |index| in |args|, or undefined if |args| has
+  // fewer registers.
+  Node* LoadRegisterFromRegisterListOrUndefined(const RegListNodePair& args,
+                                                int index) {
+    return Select<Object>(
+        Uint32GreaterThan(args.reg_count(), Int32Constant(index)),
+        [=] { return CAST(LoadRegisterFromRegisterList(args, index)); },
+        [=] { return UndefinedConstant(); });
+  }
+
   // Generates code to perform a JS call without collecting feedback.
   void JSCallNoFeedback(ConvertReceiverMode receiver_mode) {
     Node* function = LoadRegisterAtOperandIndex(0);
@@ -1639,7 +1672,16 @@ class InterpreterJSCallAssembler : public InterpreterAssembler {
     Node* context = GetContext();
 
     // Collect the {function} feedback.
-    CollectCallFeedback(function, context, maybe_feedback_vector, slot_id);
+    Node* receiver =
+        kReceiverOperandCount == 0
+            ? UndefinedConstant()
+            : LoadRegisterAtOperandIndex(kFirstArgumentOperandIndex);
+    Node* first_argument =
+        arg_count == 0 ? UndefinedConstant()
+                       : LoadRegisterAtOperandIndex(kFirstArgumentOperandIndex +
+                                                    kReceiverOperandCount);
+    CollectCallFeedback(function, receiver, first_argument, context,
+                        maybe_feedback_vector, slot_id);
 
     switch (kRecieverAndArgOperandCount) {
       case 0:
@@ -1960,7 +2002,8 @@ IGNITION_HANDLER(TestInstanceOf, InterpreterAssembler) {
   GotoIf(IsUndefined(feedback_vector), &feedback_done);
 
   // Record feedback for the {callable} in the {feedback_vector}.
-  CollectCallableFeedback(callable, context, feedback_vector, slot_id);
+  CollectCallableFeedback(callable, context, feedback_vector, slot_id,
+                          CallableFeedbackKind::kInstanceOf);
   Goto(&feedback_done);
 
   BIND(&feedback_done);
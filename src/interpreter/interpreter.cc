@@ -4,6 +4,7 @@
 
 #include "src/interpreter/interpreter.h"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -139,6 +140,17 @@ int Interpreter::InterruptBudget() {
   return FLAG_interrupt_budget;
 }
 
+int Interpreter::InitialInterruptBudget() {
+  // Functions start without a feedback vector when feedback is allocated
+  // lazily. The first interrupt allocates it, so use a smaller budget to
+  // get there quickly for functions that run more than a few times.
+  if (FLAG_lazy_feedback_allocation) {
+    return std::min(FLAG_budget_for_feedback_vector_allocation,
+                    InterruptBudget());
+  }
+  return InterruptBudget();
+}
+
 namespace {
 
 void MaybePrintAst(ParseInfo* parse_info,
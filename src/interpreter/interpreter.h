@@ -40,6 +40,12 @@ class Interpreter {
   // Returns the interrupt budget which should be used for the profiler counter.
   static int InterruptBudget();
 
+  // Returns the interrupt budget that newly created bytecode arrays start
+  // with. This is smaller than InterruptBudget() with
+  // --lazy-feedback-allocation, as the first interrupt allocates the feedback
+  // vector.
+  static int InitialInterruptBudget();
+
   // Creates a compilation job which will generate bytecode for |literal|.
   // Additionally, if |eager_inner_literals| is not null, adds any eagerly
   // compilable inner FunctionLiterals to this list.
@@ -59,8 +59,10 @@
 #include "src/runtime-profiler.h"
 #include "src/setup-isolate.h"
 #include "src/simulator.h"
+#include "src/snapshot/code-cache-directory.h"
 #include "src/snapshot/embedded-data.h"
 #include "src/snapshot/embedded-file-writer.h"
+#include "src/snapshot/feedback-serializer.h"
 #include "src/snapshot/startup-deserializer.h"
 #include "src/string-stream.h"
 #include "src/tracing/tracing-category-observer.h"
@@ -2889,10 +2891,21 @@ bool Isolate::LogObjectRelocation() {
          heap()->has_heap_object_allocation_tracker();
 }
 
+void Isolate::set_persisted_feedback(
+    std::unique_ptr<PersistedFeedback> feedback) {
+  persisted_feedback_ = std::move(feedback);
+}
+
 void Isolate::Deinit() {
   TRACE_ISOLATE(deinit);
 
   tracing_cpu_profiler_.reset();
+  persisted_feedback_.reset();
+  if (code_cache_directory_) {
+    // Write the code of the scripts whose warm-up delay has not ended yet.
+    code_cache_directory_->Flush();
+    code_cache_directory_.reset();
+  }
   if (FLAG_stress_sampling_allocation_profiler > 0) {
     heap_profiler()->StopSamplingHeapProfiler();
   }
@@ -3278,6 +3291,11 @@ bool Isolate::Init(StartupDeserializer* des) {
   compiler_dispatcher_ =
       new CompilerDispatcher(this, V8::GetCurrentPlatform(), FLAG_stack_size);
 
+  if (FLAG_code_cache_dir != nullptr && !serializer_enabled()) {
+    code_cache_directory_.reset(
+        new CodeCacheDirectory(this, FLAG_code_cache_dir));
+  }
+
   // Enable logging before setting up the heap
   logger_->SetUp(this);
 
@@ -64,6 +64,7 @@ class AstStringConstants;
 class Bootstrapper;
 class BuiltinsConstantsTableBuilder;
 class CancelableTaskManager;
+class CodeCacheDirectory;
 class CodeEventDispatcher;
 class CodeTracer;
 class CompilationCache;
@@ -86,6 +87,7 @@ class MaterializedObjectStore;
 class Microtask;
 class MicrotaskQueue;
 class OptimizingCompileDispatcher;
+class PersistedFeedback;
 class PromiseOnStack;
 class RegExpStack;
 class RootVisitor;
@@ -1099,6 +1101,19 @@ class Isolate final : private HiddenFactory {
   }
   HeapProfiler* heap_profiler() const { return heap_profiler_; }
 
+  // Type feedback from a previous process, see ScriptCompiler::
+  // ConsumeTypeFeedbackCache.
+  PersistedFeedback* persisted_feedback() const {
+    return persisted_feedback_.get();
+  }
+  void set_persisted_feedback(std::unique_ptr<PersistedFeedback> feedback);
+
+  // The code cache that V8 manages for the scripts compiled in this isolate,
+  // if --code-cache-dir is given.
+  CodeCacheDirectory* code_cache_directory() const {
+    return code_cache_directory_.get();
+  }
+
 #ifdef DEBUG
   static size_t non_disposed_isolates() { return non_disposed_isolates_; }
 #endif
@@ -1899,6 +1914,10 @@ class Isolate final : private HiddenFactory {
 
   std::unique_ptr<TracingCpuProfilerImpl> tracing_cpu_profiler_;
 
+  std::unique_ptr<PersistedFeedback> persisted_feedback_;
+
+  std::unique_ptr<CodeCacheDirectory> code_cache_directory_;
+
   EmbeddedFileWriterInterface* embedded_file_writer_ = nullptr;
 
   // The top entry of the v8::Context::BackupIncumbentScope stack.
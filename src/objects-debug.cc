@@ -501,6 +501,7 @@ void FeedbackVector::FeedbackVectorVerify(Isolate* isolate) {
   MaybeObject code = optimized_code_weak_or_smi();
   MaybeObject::VerifyMaybeObjectPointer(isolate, code);
   CHECK(code->IsSmi() || code->IsWeakOrCleared());
+  CHECK(deopt_history() == Smi::kZero || deopt_history()->IsFixedArray());
 }
 
 template <class Traits>
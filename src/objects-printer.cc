@@ -1087,6 +1087,21 @@ void FeedbackVector::FeedbackVectorPrint(std::ostream& os) {  // NOLINT
   }
   os << "\n - invocation count: " << invocation_count();
   os << "\n - profiler ticks: " << profiler_ticks();
+  os << "\n - deopt count: " << deopt_count();
+  if (deopt_history()->IsFixedArray()) {
+    FixedArray history = FixedArray::cast(deopt_history());
+    for (int i = 0; i < history->length(); i += kDeoptHistoryEntrySize) {
+      os << "\n - deopt at bytecode offset "
+         << Smi::ToInt(history->get(i + kDeoptHistoryBytecodeOffsetIndex))
+         << ": "
+         << static_cast<DeoptimizeReason>(
+                Smi::ToInt(history->get(i + kDeoptHistoryReasonIndex)))
+         << " ("
+         << static_cast<DeoptimizeKind>(
+                Smi::ToInt(history->get(i + kDeoptHistoryKindIndex)))
+         << ") x" << Smi::ToInt(history->get(i + kDeoptHistoryCountIndex));
+    }
+  }
 
   FeedbackMetadataIterator iter(metadata());
   while (iter.HasNext()) {
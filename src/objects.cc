@@ -6201,8 +6201,8 @@ void BytecodeArray::MakeOlder() {
   DCHECK_LE(bytecode_age(), kLastBytecodeAge);
 }
 
-bool BytecodeArray::IsOld() const {
-  return bytecode_age() >= kIsOldBytecodeAge;
+bool BytecodeArray::IsOld(Age old_age) const {
+  return bytecode_age() >= old_age;
 }
 
 // static
@@ -6645,6 +6645,23 @@ void Symbol::SymbolShortPrint(std::ostream& os) {
 }
 
 
+namespace {
+
+// Code compiled by CreateDynamicFunction() and indirect eval uses the empty
+// function of the native context as its outer function. On snapshot builds
+// its SFI is de-duped by the PartialSnapshotCache (see LookupScript below),
+// but without a snapshot every native context creates an SFI of its own, so
+// let them match each other there too.
+bool IsSameOuterInfo(SharedFunctionInfo shared, SharedFunctionInfo other) {
+  if (shared == other) return true;
+  return shared->HasBuiltinId() &&
+         shared->builtin_id() == Builtins::kEmptyFunction &&
+         other->HasBuiltinId() &&
+         other->builtin_id() == Builtins::kEmptyFunction;
+}
+
+}  // namespace
+
 // StringSharedKeys are used as keys in the eval cache.
 class StringSharedKey : public HashTableKey {
  public:
@@ -6676,7 +6693,7 @@ class StringSharedKey : public HashTableKey {
     }
     FixedArray other_array = FixedArray::cast(other);
     SharedFunctionInfo shared = SharedFunctionInfo::cast(other_array->get(0));
-    if (shared != *shared_) return false;
+    if (!IsSameOuterInfo(shared, *shared_)) return false;
     int language_unchecked = Smi::ToInt(other_array->get(2));
     DCHECK(is_valid_language_mode(language_unchecked));
     LanguageMode language_mode = static_cast<LanguageMode>(language_unchecked);
@@ -7949,10 +7966,45 @@ Handle<ObjectHashSet> ObjectHashSet::Add(Isolate* isolate,
   return set;
 }
 
+Handle<KeptPreparseDataTable> KeptPreparseDataTable::Put(
+    Isolate* isolate, Handle<KeptPreparseDataTable> table,
+    Handle<SharedFunctionInfo> shared, Handle<PreparseData> data) {
+  uint32_t hash = KeptPreparseDataTableShape::Hash(isolate, *shared);
+  int entry = table->FindEntry(ReadOnlyRoots(isolate), *shared, hash);
+  if (entry != kNotFound) {
+    table->set(EntryToIndex(entry) + 1, *data);
+    return table;
+  }
+  table = EnsureCapacity(isolate, table, 1);
+  entry = table->FindInsertionEntry(hash);
+  table->set(EntryToIndex(entry), *shared);
+  table->set(EntryToIndex(entry) + 1, *data);
+  table->ElementAdded();
+  return table;
+}
+
+Object KeptPreparseDataTable::Take(Isolate* isolate,
+                                   SharedFunctionInfo shared) {
+  DisallowHeapAllocation no_gc;
+  ReadOnlyRoots roots(isolate);
+  uint32_t hash = KeptPreparseDataTableShape::Hash(isolate, shared);
+  int entry = FindEntry(roots, shared, hash);
+  if (entry == kNotFound) return roots.the_hole_value();
+  Object data = get(EntryToIndex(entry) + 1);
+  set_the_hole(isolate, EntryToIndex(entry));
+  set_the_hole(isolate, EntryToIndex(entry) + 1);
+  ElementRemoved();
+  return data;
+}
+
 namespace {
 
+// The literals map of an eval cache entry starts with the tick of the last use
+// of the entry, followed by pairs of native context and feedback cell.
+const int kLiteralUseTickIndex = 0;
+const int kLiteralPrefixLength = 1;
 const int kLiteralEntryLength = 2;
-const int kLiteralInitialLength = 2;
+const int kLiteralInitialLength = kLiteralPrefixLength + kLiteralEntryLength;
 const int kLiteralContextOffset = 0;
 const int kLiteralLiteralsOffset = 1;
 
@@ -7968,7 +8020,7 @@ int SearchLiteralsMapEntry(CompilationCacheTable cache, int cache_entry,
   if (obj->IsWeakFixedArray()) {
     WeakFixedArray literals_map = WeakFixedArray::cast(obj);
     int length = literals_map->length();
-    for (int i = 0; i < length; i += kLiteralEntryLength) {
+    for (int i = kLiteralPrefixLength; i < length; i += kLiteralEntryLength) {
       DCHECK(literals_map->Get(i + kLiteralContextOffset)->IsWeakOrCleared());
       if (literals_map->Get(i + kLiteralContextOffset) ==
           HeapObjectReference::Weak(native_context)) {
@@ -7996,7 +8048,9 @@ void AddToFeedbackCellsMap(Handle<CompilationCacheTable> cache, int cache_entry,
   if (!obj->IsWeakFixedArray() || WeakFixedArray::cast(obj)->length() == 0) {
     new_literals_map =
         isolate->factory()->NewWeakFixedArray(kLiteralInitialLength, TENURED);
-    entry = 0;
+    new_literals_map->Set(kLiteralUseTickIndex,
+                          MaybeObject::FromSmi(Smi::zero()));
+    entry = kLiteralPrefixLength;
   } else {
     Handle<WeakFixedArray> old_literals_map(WeakFixedArray::cast(obj), isolate);
     entry = SearchLiteralsMapEntry(*cache, cache_entry, *native_context);
@@ -8010,7 +8064,7 @@ void AddToFeedbackCellsMap(Handle<CompilationCacheTable> cache, int cache_entry,
     // Can we reuse an entry?
     DCHECK_LT(entry, 0);
     int length = old_literals_map->length();
-    for (int i = 0; i < length; i += kLiteralEntryLength) {
+    for (int i = kLiteralPrefixLength; i < length; i += kLiteralEntryLength) {
       if (old_literals_map->Get(i + kLiteralContextOffset)->IsCleared()) {
         new_literals_map = old_literals_map;
         entry = i;
@@ -8032,7 +8086,9 @@ void AddToFeedbackCellsMap(Handle<CompilationCacheTable> cache, int cache_entry,
                         HeapObjectReference::Weak(*feedback_cell));
 
 #ifdef DEBUG
-  for (int i = 0; i < new_literals_map->length(); i += kLiteralEntryLength) {
+  DCHECK(new_literals_map->Get(kLiteralUseTickIndex)->IsSmi());
+  for (int i = kLiteralPrefixLength; i < new_literals_map->length();
+       i += kLiteralEntryLength) {
     MaybeObject object = new_literals_map->Get(i + kLiteralContextOffset);
     DCHECK(object->IsCleared() ||
            object->GetHeapObjectAssumeWeak()->IsNativeContext());
@@ -8065,6 +8121,18 @@ FeedbackCell SearchLiteralsMap(CompilationCacheTable cache, int cache_entry,
   return result;
 }
 
+int GetEvalUseTick(CompilationCacheTable cache, int cache_entry) {
+  WeakFixedArray literals_map = WeakFixedArray::cast(cache->get(cache_entry));
+  return literals_map->Get(kLiteralUseTickIndex)->ToSmi().value();
+}
+
+void SetEvalUseTick(CompilationCacheTable cache, int cache_entry,
+                    int use_tick) {
+  WeakFixedArray literals_map = WeakFixedArray::cast(cache->get(cache_entry));
+  literals_map->Set(kLiteralUseTickIndex,
+                    MaybeObject::FromSmi(Smi::FromInt(use_tick)));
+}
+
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
@@ -8095,7 +8163,7 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
 InfoCellPair CompilationCacheTable::LookupEval(
     Handle<CompilationCacheTable> table, Handle<String> src,
     Handle<SharedFunctionInfo> outer_info, Handle<Context> native_context,
-    LanguageMode language_mode, int position) {
+    LanguageMode language_mode, int position, int use_tick) {
   InfoCellPair empty_result;
   Isolate* isolate = native_context->GetIsolate();
   src = String::Flatten(isolate, src);
@@ -8106,6 +8174,7 @@ InfoCellPair CompilationCacheTable::LookupEval(
   if (!table->get(index)->IsFixedArray()) return empty_result;
   Object obj = table->get(EntryToIndex(entry) + 1);
   if (obj->IsSharedFunctionInfo()) {
+    SetEvalUseTick(*table, index + 2, use_tick);
     FeedbackCell feedback_cell =
         SearchLiteralsMap(*table, EntryToIndex(entry) + 2, *native_context);
     return InfoCellPair(SharedFunctionInfo::cast(obj), feedback_cell);
@@ -8149,7 +8218,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
     Handle<CompilationCacheTable> cache, Handle<String> src,
     Handle<SharedFunctionInfo> outer_info, Handle<SharedFunctionInfo> value,
     Handle<Context> native_context, Handle<FeedbackCell> feedback_cell,
-    int position) {
+    int position, int use_tick) {
   Isolate* isolate = native_context->GetIsolate();
   src = String::Flatten(isolate, src);
   StringSharedKey key(src, outer_info, value->language_mode(), position);
@@ -8164,6 +8233,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
       // and entry remains correct.
       AddToFeedbackCellsMap(cache, EntryToIndex(entry) + 2, native_context,
                             feedback_cell);
+      SetEvalUseTick(*cache, EntryToIndex(entry) + 2, use_tick);
       return cache;
     }
   }
@@ -8222,6 +8292,131 @@ void CompilationCacheTable::Age() {
   }
 }
 
+// static
+size_t CompilationCacheTable::EvalEntrySize(String source,
+                                            SharedFunctionInfo shared) {
+  DisallowHeapAllocation no_allocation;
+  DCHECK(shared->script()->IsScript());
+  size_t size = source->Size();
+  WeakFixedArray infos =
+      Script::cast(shared->script())->shared_function_infos();
+  for (int i = 0; i < infos->length(); i++) {
+    HeapObject object;
+    if (!infos->Get(i)->GetHeapObject(&object) ||
+        !object->IsSharedFunctionInfo()) {
+      continue;
+    }
+    SharedFunctionInfo info = SharedFunctionInfo::cast(object);
+    size += info->Size();
+    if (info->HasBytecodeArray()) {
+      size += info->GetBytecodeArray()->SizeIncludingMetadata();
+    }
+  }
+  return size;
+}
+
+namespace {
+
+size_t EvalEntrySizeAt(CompilationCacheTable table, int entry_index) {
+  FixedArray key = FixedArray::cast(table->get(entry_index));
+  return CompilationCacheTable::EvalEntrySize(
+      String::cast(key->get(1)),
+      SharedFunctionInfo::cast(table->get(entry_index + 1)));
+}
+
+// The entries of an eval cache as pairs of use tick and entry index, least
+// recently used first.
+std::vector<std::pair<int, int>> EvalEntriesByUseTick(
+    CompilationCacheTable table) {
+  std::vector<std::pair<int, int>> entries;
+  for (int entry = 0, capacity = table->Capacity(); entry < capacity;
+       entry++) {
+    int entry_index = CompilationCacheTable::EntryToIndex(entry);
+    if (!table->get(entry_index)->IsFixedArray()) continue;
+    int use_tick = GetEvalUseTick(table, entry_index + 2);
+    entries.push_back(std::make_pair(use_tick, entry_index));
+  }
+  std::sort(entries.begin(), entries.end());
+  return entries;
+}
+
+}  // namespace
+
+size_t CompilationCacheTable::AgeEval() {
+  DisallowHeapAllocation no_allocation;
+  Object the_hole_value = GetReadOnlyRoots().the_hole_value();
+  size_t size = 0;
+  for (int entry = 0, size = Capacity(); entry < size; entry++) {
+    int entry_index = EntryToIndex(entry);
+    int value_index = entry_index + 1;
+
+    if (get(entry_index)->IsNumber()) {
+      Smi count = Smi::cast(get(value_index));
+      count = Smi::FromInt(count->value() - 1);
+      if (count->value() == 0) {
+        NoWriteBarrierSet(*this, entry_index, the_hole_value);
+        NoWriteBarrierSet(*this, value_index, the_hole_value);
+        ElementRemoved();
+      } else {
+        NoWriteBarrierSet(*this, value_index, count);
+      }
+    } else if (get(entry_index)->IsFixedArray()) {
+      // Unlike Age, keep the entries with old bytecode, since TrimEval bounds
+      // the size of the cache. Only the entries whose bytecode was flushed
+      // are gone for good.
+      SharedFunctionInfo info = SharedFunctionInfo::cast(get(value_index));
+      if (!info->is_compiled()) {
+        for (int i = 0; i < kEntrySize; i++) {
+          NoWriteBarrierSet(*this, entry_index + i, the_hole_value);
+        }
+        ElementRemoved();
+      } else {
+        size += EvalEntrySizeAt(*this, entry_index);
+      }
+    }
+  }
+  return size;
+}
+
+size_t CompilationCacheTable::EvalSize() {
+  DisallowHeapAllocation no_allocation;
+  size_t size = 0;
+  for (int entry = 0, capacity = Capacity(); entry < capacity; entry++) {
+    int entry_index = EntryToIndex(entry);
+    if (get(entry_index)->IsFixedArray()) {
+      size += EvalEntrySizeAt(*this, entry_index);
+    }
+  }
+  return size;
+}
+
+size_t CompilationCacheTable::TrimEval(size_t max_size, int* evicted) {
+  DisallowHeapAllocation no_allocation;
+  size_t size = EvalSize();
+  *evicted = 0;
+  Object the_hole_value = GetReadOnlyRoots().the_hole_value();
+  for (const std::pair<int, int>& entry : EvalEntriesByUseTick(*this)) {
+    if (size <= max_size) break;
+    int entry_index = entry.second;
+    size -= EvalEntrySizeAt(*this, entry_index);
+    for (int i = 0; i < kEntrySize; i++) {
+      NoWriteBarrierSet(*this, entry_index + i, the_hole_value);
+    }
+    ElementRemoved();
+    (*evicted)++;
+  }
+  return size;
+}
+
+int CompilationCacheTable::ResetEvalUseTicks() {
+  DisallowHeapAllocation no_allocation;
+  int use_tick = 0;
+  for (const std::pair<int, int>& entry : EvalEntriesByUseTick(*this)) {
+    SetEvalUseTick(*this, entry.second + 2, use_tick++);
+  }
+  return use_tick;
+}
+
 void CompilationCacheTable::Remove(Object value) {
   DisallowHeapAllocation no_allocation;
   Object the_hole_value = GetReadOnlyRoots().the_hole_value();
@@ -9168,6 +9363,8 @@ template class ObjectHashTableBase<ObjectHashTable, ObjectHashTableShape>;
 
 template class ObjectHashTableBase<EphemeronHashTable, EphemeronHashTableShape>;
 
+template class HashTable<KeptPreparseDataTable, KeptPreparseDataTableShape>;
+
 template class Dictionary<NameDictionary, NameDictionaryShape>;
 
 template class Dictionary<GlobalDictionary, GlobalDictionaryShape>;
@@ -793,8 +793,9 @@ class BytecodeArray : public FixedArrayBase {
 
   void CopyBytecodesTo(BytecodeArray to);
 
-  // Bytecode aging
-  bool IsOld() const;
+  // Bytecode aging. Bytecode is old once it reaches {old_age}, which is
+  // lowered under memory pressure to flush bytecode sooner.
+  bool IsOld(Age old_age = kIsOldBytecodeAge) const;
   void MakeOlder();
 
   // Clear uninitialized padding space. This ensures that the snapshot content
@@ -847,7 +848,8 @@ class DeoptimizationData : public FixedArray {
   static const int kOptimizationIdIndex = 5;
   static const int kSharedFunctionInfoIndex = 6;
   static const int kInliningPositionsIndex = 7;
-  static const int kFirstDeoptEntryIndex = 8;
+  static const int kDeoptExitStartIndex = 8;
+  static const int kFirstDeoptEntryIndex = 9;
 
   // Offsets of deopt entry elements relative to the start of the entry.
   static const int kBytecodeOffsetRawOffset = 0;
@@ -868,6 +870,7 @@ class DeoptimizationData : public FixedArray {
   DECL_ELEMENT_ACCESSORS(OptimizationId, Smi)
   DECL_ELEMENT_ACCESSORS(SharedFunctionInfo, Object)
   DECL_ELEMENT_ACCESSORS(InliningPositions, PodArray<InliningPosition>)
+  DECL_ELEMENT_ACCESSORS(DeoptExitStart, Smi)
 
 #undef DECL_ELEMENT_ACCESSORS
 
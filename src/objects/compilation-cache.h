@@ -80,6 +80,9 @@ class InfoCellPair {
 // Such entries are identified by SharedFunctionInfos pointing to either the
 // recompilation stub, or to "old" code. This avoids memory leaks due to
 // premature caching of scripts and eval strings that are never needed later.
+// The eval caches keep entries with old code and are bounded by size instead:
+// TrimEval evicts the entries with the oldest use tick, which are the ones
+// that were least recently used.
 class CompilationCacheTable
     : public HashTable<CompilationCacheTable, CompilationCacheShape> {
  public:
@@ -91,7 +94,8 @@ class CompilationCacheTable
                                  Handle<String> src,
                                  Handle<SharedFunctionInfo> shared,
                                  Handle<Context> native_context,
-                                 LanguageMode language_mode, int position);
+                                 LanguageMode language_mode, int position,
+                                 int use_tick);
   Handle<Object> LookupRegExp(Handle<String> source, JSRegExp::Flags flags);
   static Handle<CompilationCacheTable> PutScript(
       Handle<CompilationCacheTable> cache, Handle<String> src,
@@ -101,12 +105,28 @@ class CompilationCacheTable
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<SharedFunctionInfo> outer_info, Handle<SharedFunctionInfo> value,
       Handle<Context> native_context, Handle<FeedbackCell> feedback_cell,
-      int position);
+      int position, int use_tick);
   static Handle<CompilationCacheTable> PutRegExp(
       Isolate* isolate, Handle<CompilationCacheTable> cache, Handle<String> src,
       JSRegExp::Flags flags, Handle<FixedArray> value);
   void Remove(Object value);
   void Age();
+
+  // Ages the hash entries of an eval cache like Age, but only removes the
+  // entries whose bytecode was flushed. Returns the size of the rest.
+  size_t AgeEval();
+  // The number of bytes that the entries of an eval cache keep alive.
+  size_t EvalSize();
+  // The number of bytes that an eval cache entry for {source} keeps alive,
+  // which are the source and the SFIs and bytecode of all of its functions.
+  static size_t EvalEntrySize(String source, SharedFunctionInfo shared);
+  // Evicts the least recently used entries of an eval cache until the rest
+  // keep at most {max_size} bytes alive. Returns the size of the rest.
+  size_t TrimEval(size_t max_size, int* evicted);
+  // Renumbers the use ticks of an eval cache from zero, keeping their order.
+  // Returns the next free use tick.
+  int ResetEvalUseTicks();
+
   static const int kHashGenerations = 10;
 
   DECL_CAST(CompilationCacheTable)
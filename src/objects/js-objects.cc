@@ -4914,8 +4914,12 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function) {
       DCHECK(function->shared()->HasBytecodeArray());
       Handle<FeedbackVector> feedback_vector =
           FeedbackVector::New(isolate, shared);
+      // Closures created by a function without a feedback vector use the
+      // shared no_feedback_cell, which must not be written to either.
       if (function->raw_feedback_cell() ==
-          isolate->heap()->many_closures_cell()) {
+              isolate->heap()->many_closures_cell() ||
+          function->raw_feedback_cell() ==
+              isolate->heap()->no_feedback_cell()) {
         Handle<FeedbackCell> feedback_cell =
             isolate->factory()->NewOneClosureCell(feedback_vector);
         function->set_raw_feedback_cell(*feedback_cell);
@@ -8,6 +8,7 @@
 #include "src/objects/shared-function-info.h"
 
 #include "src/ast/ast.h"
+#include "src/base/functional.h"
 #include "src/feedback-vector-inl.h"
 #include "src/handles-inl.h"
 #include "src/heap/heap-inl.h"
@@ -490,15 +491,18 @@ void SharedFunctionInfo::set_bytecode_array(BytecodeArray bytecode) {
   set_function_data(bytecode);
 }
 
-bool SharedFunctionInfo::ShouldFlushBytecode() {
+bool SharedFunctionInfo::CanFlushBytecode() {
   if (!FLAG_flush_bytecode) return false;
 
   // TODO(rmcilroy): Enable bytecode flushing for resumable functions amd class
   // member initializers.
-  if (IsResumableFunction(kind()) ||
-      IsClassMembersInitializerFunction(kind()) || !allows_lazy_compilation()) {
-    return false;
-  }
+  return !IsResumableFunction(kind()) &&
+         !IsClassMembersInitializerFunction(kind()) &&
+         allows_lazy_compilation();
+}
+
+bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeArray::Age old_age) {
+  if (!CanFlushBytecode()) return false;
 
   // Get a snapshot of the function data field, and if it is a bytecode array,
   // check if it is old. Note, this is done this way since this function can be
@@ -510,7 +514,7 @@ bool SharedFunctionInfo::ShouldFlushBytecode() {
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
-  return bytecode->IsOld();
+  return bytecode->IsOld(old_age);
 }
 
 Code SharedFunctionInfo::InterpreterTrampoline() const {
@@ -755,6 +759,35 @@ bool SharedFunctionInfo::CanDiscardCompiled() const {
   return can_decompile;
 }
 
+KeptPreparseDataTable::KeptPreparseDataTable(Address ptr)
+    : HashTable<KeptPreparseDataTable, KeptPreparseDataTableShape>(ptr) {
+  SLOW_DCHECK(IsEphemeronHashTable());
+}
+
+CAST_ACCESSOR(KeptPreparseDataTable)
+
+bool KeptPreparseDataTableShape::IsMatch(SharedFunctionInfo key,
+                                         Object other) {
+  return key == other;
+}
+
+uint32_t KeptPreparseDataTableShape::Hash(Isolate* isolate,
+                                          SharedFunctionInfo key) {
+  int script_id = key->script()->IsScript() ? Script::cast(key->script())->id()
+                                            : v8::UnboundScript::kNoScriptId;
+  return static_cast<uint32_t>(
+      base::hash_combine(script_id, key->StartPosition()));
+}
+
+uint32_t KeptPreparseDataTableShape::HashForObject(Isolate* isolate,
+                                                   Object object) {
+  return Hash(isolate, SharedFunctionInfo::cast(object));
+}
+
+RootIndex KeptPreparseDataTableShape::GetMapRootIndex() {
+  return RootIndex::kEphemeronHashTableMap;
+}
+
 }  // namespace internal
 }  // namespace v8
 
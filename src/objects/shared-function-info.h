@@ -9,6 +9,8 @@
 #include "src/function-kind.h"
 #include "src/objects.h"
 #include "src/objects/builtin-function-id.h"
+#include "src/objects/code.h"
+#include "src/objects/hash-table.h"
 #include "src/objects/script.h"
 #include "src/objects/smi.h"
 #include "src/objects/struct.h"
@@ -558,8 +560,13 @@ class SharedFunctionInfo : public HeapObject {
           gc_notify_updated_slot =
               [](HeapObject object, ObjectSlot slot, HeapObject target) {});
 
-  // Returns true if the function has old bytecode that could be flushed.
-  inline bool ShouldFlushBytecode();
+  // Returns true if the bytecode of the function can ever be flushed.
+  inline bool CanFlushBytecode();
+
+  // Returns true if the function has bytecode of at least {old_age} that
+  // could be flushed.
+  inline bool ShouldFlushBytecode(
+      BytecodeArray::Age old_age = BytecodeArray::kIsOldBytecodeAge);
 
   // Check whether or not this function is inlineable.
   bool IsInlineable();
@@ -761,6 +768,42 @@ class IsCompiledScope {
 
 std::ostream& operator<<(std::ostream& os, const SourceCodeOf& v);
 
+class KeptPreparseDataTableShape : public BaseShape<SharedFunctionInfo> {
+ public:
+  static inline bool IsMatch(SharedFunctionInfo key, Object other);
+  static inline uint32_t Hash(Isolate* isolate, SharedFunctionInfo key);
+  static inline uint32_t HashForObject(Isolate* isolate, Object object);
+  static inline RootIndex GetMapRootIndex();
+  static const int kPrefixSize = 0;
+  static const int kEntrySize = 2;
+  static const bool kNeedsHoleCheck = false;
+};
+
+// Maps functions that were lazily compiled to the preparse data they had
+// before, so that it can be given back to them when their bytecode is flushed
+// (see --flush-bytecode-keep-preparse-data). The table has the layout and map
+// of an EphemeronHashTable, so entries die with their functions. Since
+// SharedFunctionInfos have no identity hash, they are hashed by their script
+// and start position instead.
+class KeptPreparseDataTable
+    : public HashTable<KeptPreparseDataTable, KeptPreparseDataTableShape> {
+ public:
+  static Handle<KeptPreparseDataTable> Put(Isolate* isolate,
+                                           Handle<KeptPreparseDataTable> table,
+                                           Handle<SharedFunctionInfo> shared,
+                                           Handle<PreparseData> data);
+
+  // Removes the entry of {shared} and returns its preparse data, or the hole
+  // if there is none. Does not allocate, so it can be used by the GC.
+  Object Take(Isolate* isolate, SharedFunctionInfo shared);
+
+  DECL_CAST(KeptPreparseDataTable)
+
+  OBJECT_CONSTRUCTORS(
+      KeptPreparseDataTable,
+      HashTable<KeptPreparseDataTable, KeptPreparseDataTableShape>);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -55,7 +55,8 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
     kTraceTurboJson = 1 << 14,
     kTraceTurboGraph = 1 << 15,
     kTraceTurboScheduled = 1 << 16,
-    kWasmRuntimeExceptionSupport = 1 << 17
+    kWasmRuntimeExceptionSupport = 1 << 17,
+    kFastRegisterAllocation = 1 << 18
   };
 
   // Construct a compilation info for optimized compilation.
@@ -158,6 +159,13 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
     return GetFlag(kAnalyzeEnvironmentLiveness);
   }
 
+  // Trade code quality for compile latency by skipping the optional phases
+  // of register allocation (bundles, splintering and move optimization).
+  void MarkAsFastRegisterAllocation() { SetFlag(kFastRegisterAllocation); }
+  bool is_fast_register_allocation() const {
+    return GetFlag(kFastRegisterAllocation);
+  }
+
   void SetWasmRuntimeExceptionSupport() {
     SetFlag(kWasmRuntimeExceptionSupport);
   }
@@ -0,0 +1,627 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "src/assert-scope.h"
+#include "src/ast/ast-value-factory.h"
+#include "src/ast/scopes.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/template-utils.h"
+#include "src/flags.h"
+#include "src/parsing/parse-info.h"
+#include "src/parsing/parser.h"
+#include "src/parsing/scanner.h"
+#include "src/tracing/trace-event.h"
+#include "src/v8.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The number of functions that are preparsed ahead of the parser before the
+// tasks wait for the parser to catch up.
+const int kMaxResultsAhead = 256;
+
+// A function found by the scan, which a worker task preparses unless the
+// parser reaches it first.
+struct Candidate {
+  enum class Status { kQueued, kRunning, kDone };
+
+  int start_position = kNoSourcePosition;
+  FunctionKind kind = kNormalFunction;
+  FunctionLiteral::FunctionType function_type =
+      FunctionLiteral::kAnonymousExpression;
+  LanguageMode language_mode = LanguageMode::kSloppy;
+  // The raw characters of the function's name, empty for anonymous functions.
+  std::vector<uint8_t> name;
+  bool name_is_one_byte = true;
+  Status status = Status::kQueued;
+  // nullptr if preparsing the function failed.
+  std::unique_ptr<ParallelPreparser::Result> result;
+};
+
+bool HasName(const Candidate& candidate, const AstRawString* name) {
+  if (name == nullptr || name->IsEmpty()) return candidate.name.empty();
+  return name->is_one_byte() == candidate.name_is_one_byte &&
+         static_cast<size_t>(name->byte_length()) == candidate.name.size() &&
+         std::equal(candidate.name.begin(), candidate.name.end(),
+                    name->raw_data());
+}
+
+// Whether a '/' after {token} is a division rather than the start of a
+// regular expression.
+bool EndsOperand(Token::Value token) {
+  switch (token) {
+    case Token::RPAREN:
+    case Token::RBRACK:
+    case Token::RBRACE:
+    case Token::TEMPLATE_TAIL:
+    case Token::REGEXP_LITERAL:
+    case Token::INC:
+    case Token::DEC:
+    case Token::THIS:
+    case Token::SUPER:
+    case Token::PRIVATE_NAME:
+      return true;
+    default:
+      return Token::IsLiteral(token) || Token::IsAnyIdentifier(token);
+  }
+}
+
+// Whether a '{' after {token} opens a block or a function body rather than
+// an object literal.
+bool StartsBlock(Token::Value token) {
+  switch (token) {
+    case Token::RPAREN:
+    case Token::SEMICOLON:
+    case Token::LBRACE:
+    case Token::RBRACE:
+    case Token::ARROW:
+    case Token::ELSE:
+    case Token::DO:
+    case Token::TRY:
+    case Token::CATCH:
+    case Token::FINALLY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Finds the 'function' tokens that are not nested in a function body or a
+// block, in a single pass of the scanner. Only the braces are tracked, so
+// this also finds functions in the expressions of top-level statements. The
+// scan tells regular expressions from divisions and blocks from object
+// literals by the preceding token, and stops at the first token that does not
+// fit, e.g. because it took a division for a regular expression.
+class TopLevelFunctionFinder {
+ public:
+  TopLevelFunctionFinder(Utf16CharacterStream* stream, ParseInfo* info,
+                         AccountingAllocator* allocator,
+                         const std::atomic<bool>* cancelled)
+      : scanner_(stream, false),
+        zone_(allocator, ZONE_NAME),
+        ast_value_factory_(&zone_, info->ast_string_constants(),
+                           info->hash_seed()),
+        cancelled_(cancelled),
+        language_mode_(info->language_mode()) {
+    scanner_.set_allow_harmony_numeric_separator(
+        info->allow_harmony_numeric_separator());
+    scanner_.set_allow_harmony_private_fields(
+        info->allow_harmony_private_fields());
+    scanner_.Initialize();
+    if (FLAG_harmony_hashbang) scanner_.SkipHashBang();
+    ScanDirectivePrologue();
+  }
+
+  // Fills in {candidate} with the next function that might be at the top
+  // level. Returns false when the scan is over.
+  bool FindNext(Candidate* candidate) {
+    while (!cancelled_->load(std::memory_order_relaxed)) {
+      Token::Value token = Advance();
+      if (token == Token::EOS || token == Token::ILLEGAL) return false;
+      if (token == Token::FUNCTION && blocks_ == 0 &&
+          ReadFunction(candidate)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  enum class Brace { kBlock, kObjectLiteral, kTemplate };
+
+  struct SeenToken {
+    Token::Value token;
+    bool after_line_terminator;
+  };
+
+  // Sets the language mode if the script starts with a "use strict"
+  // directive.
+  void ScanDirectivePrologue() {
+    while (scanner_.peek() == Token::STRING) {
+      bool use_strict = scanner_.NextLiteralEquals("use strict");
+      Advance();
+      Token::Value next = scanner_.peek();
+      if (next != Token::SEMICOLON && next != Token::EOS &&
+          !scanner_.HasLineTerminatorBeforeNext()) {
+        return;
+      }
+      if (use_strict) language_mode_ = LanguageMode::kStrict;
+      if (next == Token::SEMICOLON) Advance();
+    }
+  }
+
+  // Consumes the next token and keeps track of the braces. Returns
+  // Token::ILLEGAL if the tokens do not look like a well-formed script.
+  Token::Value Advance() {
+    Token::Value token = scanner_.peek();
+    bool continues_template = false;
+    if ((token == Token::DIV || token == Token::ASSIGN_DIV) &&
+        !PreviousEndsOperand()) {
+      if (!scanner_.ScanRegExpPattern() ||
+          scanner_.ScanRegExpFlags().IsNothing()) {
+        return Token::ILLEGAL;
+      }
+    } else if (token == Token::RBRACE && !braces_.empty() &&
+               braces_.back() == Brace::kTemplate) {
+      scanner_.ScanTemplateContinuation();
+      continues_template = true;
+    }
+    bool after_line_terminator = scanner_.HasLineTerminatorBeforeNext();
+    token = scanner_.Next();
+
+    switch (token) {
+      case Token::LBRACE:
+        if (StartsBlock(history_[0].token)) {
+          braces_.push_back(Brace::kBlock);
+          blocks_++;
+        } else {
+          braces_.push_back(Brace::kObjectLiteral);
+        }
+        break;
+      case Token::RBRACE:
+        if (braces_.empty()) return Token::ILLEGAL;
+        closed_block_ = braces_.back() == Brace::kBlock;
+        if (closed_block_) blocks_--;
+        braces_.pop_back();
+        break;
+      case Token::TEMPLATE_SPAN:
+        if (!continues_template) braces_.push_back(Brace::kTemplate);
+        break;
+      case Token::TEMPLATE_TAIL:
+        if (continues_template) braces_.pop_back();
+        break;
+      default:
+        break;
+    }
+
+    history_[2] = history_[1];
+    history_[1] = history_[0];
+    history_[0] = {token, after_line_terminator};
+    return token;
+  }
+
+  bool PreviousEndsOperand() const {
+    Token::Value previous = history_[0].token;
+    if (previous == Token::RBRACE) return !closed_block_;
+    return EndsOperand(previous);
+  }
+
+  // Reads the function after the 'function' token that was just consumed,
+  // up to the '(' of its parameters.
+  bool ReadFunction(Candidate* candidate) {
+    bool is_async = history_[1].token == Token::ASYNC &&
+                    !history_[0].after_line_terminator;
+    // The token before 'function' or 'async function', and whether the
+    // function starts on a new line.
+    const SeenToken& preceding = history_[is_async ? 2 : 1];
+    bool starts_line = history_[is_async ? 1 : 0].after_line_terminator;
+
+    bool is_generator = scanner_.peek() == Token::MUL;
+    if (is_generator) Advance();
+
+    candidate->name.clear();
+    candidate->name_is_one_byte = true;
+    if (Token::IsAnyIdentifier(scanner_.peek())) {
+      Advance();
+      const AstRawString* name = scanner_.CurrentSymbol(&ast_value_factory_);
+      candidate->name.assign(name->raw_data(),
+                             name->raw_data() + name->byte_length());
+      candidate->name_is_one_byte = name->is_one_byte();
+    }
+    if (scanner_.peek() != Token::LPAREN) return false;
+    Advance();
+
+    // Functions in parentheses are likely called, and compiled eagerly.
+    if (preceding.token == Token::LPAREN) return false;
+
+    candidate->start_position = scanner_.location().beg_pos;
+    if (is_async) {
+      candidate->kind =
+          is_generator ? kAsyncGeneratorFunction : kAsyncFunction;
+    } else {
+      candidate->kind = is_generator ? kGeneratorFunction : kNormalFunction;
+    }
+    bool is_declaration =
+        !candidate->name.empty() &&
+        (preceding.token == Token::SEMICOLON ||
+         preceding.token == Token::RBRACE ||
+         (starts_line && EndsOperand(preceding.token)));
+    if (is_declaration) {
+      candidate->function_type = FunctionLiteral::kDeclaration;
+    } else if (!candidate->name.empty()) {
+      candidate->function_type = FunctionLiteral::kNamedExpression;
+    } else {
+      candidate->function_type = FunctionLiteral::kAnonymousExpression;
+    }
+    candidate->language_mode = language_mode_;
+    return true;
+  }
+
+  Scanner scanner_;
+  Zone zone_;
+  AstValueFactory ast_value_factory_;
+  const std::atomic<bool>* cancelled_;
+  LanguageMode language_mode_;
+
+  std::vector<Brace> braces_;
+  // The number of kBlock entries in {braces_}.
+  int blocks_ = 0;
+  // Whether the last '}' closed a block.
+  bool closed_block_ = false;
+  // The last three tokens, most recent first. The script starts like a
+  // statement.
+  SeenToken history_[3] = {{Token::SEMICOLON, true},
+                           {Token::SEMICOLON, true},
+                           {Token::SEMICOLON, true}};
+
+  DISALLOW_COPY_AND_ASSIGN(TopLevelFunctionFinder);
+};
+
+}  // namespace
+
+// The state shared by the parser and the worker tasks. It is reference
+// counted because tasks that start running only after the parser is done
+// still access it, find that they were cancelled and exit.
+class ParallelPreparser::State
+    : public std::enable_shared_from_this<ParallelPreparser::State> {
+ public:
+  State(ParseInfo* info, std::unique_ptr<Utf16CharacterStream> stream)
+      : allocator_(info->zone()->allocator()),
+        info_(ParseInfo::ForSameScript(info, allocator_)),
+        stream_(std::move(stream)),
+        scan_stream_(stream_->Clone()),
+        stack_size_(FLAG_stack_size),
+        max_tasks_(V8::GetCurrentPlatform()->NumberOfWorkerThreads()),
+        max_results_ahead_(FLAG_stress_parallel_preparse ? kMaxInt
+                                                         : kMaxResultsAhead) {
+    DCHECK(stream_->can_be_cloned_for_parallel_access());
+  }
+
+  void Start() {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        base::make_unique<ScanTask>(shared_from_this()));
+  }
+
+  void Cancel() {
+    cancelled_ = true;
+    base::MutexGuard guard(&mutex_);
+    while (scanning_ || running_tasks_ > 0) cv_.Wait(&mutex_);
+    // Tasks that did not start yet only access the cancellation state, so
+    // free everything that uses the isolate's zone allocator now.
+    candidates_.clear();
+    info_.reset();
+  }
+
+  std::unique_ptr<Result> TakeResult(
+      const AstRawString* function_name, FunctionKind kind,
+      FunctionLiteral::FunctionType function_type,
+      DeclarationScope* function_scope) {
+    int position = function_scope->start_position();
+    base::MutexGuard guard(&mutex_);
+    main_position_ = position;
+    DropCandidatesBeforeLocked(position);
+
+    auto it = candidates_.find(position);
+    if (it == candidates_.end()) return nullptr;
+    Candidate* candidate = it->second.get();
+    if (candidate->status == Candidate::Status::kQueued) {
+      // The parser preparses the function faster than a task that did not
+      // even start.
+      candidates_.erase(it);
+      return nullptr;
+    }
+    while (candidate->status == Candidate::Status::kRunning) {
+      cv_.Wait(&mutex_);
+    }
+
+    std::unique_ptr<Result> result;
+    if (candidate->kind == kind && candidate->function_type == function_type &&
+        candidate->language_mode == function_scope->language_mode() &&
+        HasName(*candidate, function_name)) {
+      result = std::move(candidate->result);
+    }
+    candidates_.erase(it);
+    results_ahead_--;
+    ScheduleTasksLocked();
+    return result;
+  }
+
+  void WaitForAllResults() {
+    base::MutexGuard guard(&mutex_);
+    while (!scan_finished_ || running_tasks_ > 0 || !queue_.empty()) {
+      cv_.Wait(&mutex_);
+    }
+  }
+
+ private:
+  class ScanTask : public Task {
+   public:
+    explicit ScanTask(std::shared_ptr<State> state)
+        : state_(std::move(state)) {}
+
+    void Run() override { state_->Scan(); }
+
+   private:
+    std::shared_ptr<State> state_;
+
+    DISALLOW_COPY_AND_ASSIGN(ScanTask);
+  };
+
+  class PreparseTask : public Task {
+   public:
+    explicit PreparseTask(std::shared_ptr<State> state)
+        : state_(std::move(state)) {}
+
+    void Run() override { state_->PreparseCandidates(); }
+
+   private:
+    std::shared_ptr<State> state_;
+
+    DISALLOW_COPY_AND_ASSIGN(PreparseTask);
+  };
+
+  void Scan() {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHeapAccess no_heap_access;
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.ParallelPreParseScan");
+    {
+      base::MutexGuard guard(&mutex_);
+      if (cancelled_) {
+        scan_finished_ = true;
+        cv_.NotifyAll();
+        return;
+      }
+      scanning_ = true;
+    }
+
+    {
+      TopLevelFunctionFinder finder(scan_stream_.get(), info_.get(),
+                                    allocator_, &cancelled_);
+      std::unique_ptr<Candidate> candidate = base::make_unique<Candidate>();
+      while (finder.FindNext(candidate.get())) {
+        base::MutexGuard guard(&mutex_);
+        if (candidate->start_position < main_position_) continue;
+        int position = candidate->start_position;
+        candidates_[position] = std::move(candidate);
+        queue_.push_back(position);
+        ScheduleTasksLocked();
+        candidate = base::make_unique<Candidate>();
+      }
+    }
+
+    base::MutexGuard guard(&mutex_);
+    scanning_ = false;
+    scan_finished_ = true;
+    cv_.NotifyAll();
+  }
+
+  void PreparseCandidates() {
+    DisallowHeapAllocation no_allocation;
+    DisallowHandleAllocation no_handles;
+    DisallowHeapAccess no_heap_access;
+    uintptr_t stack_limit = GetCurrentStackPosition() - stack_size_ * KB;
+    while (true) {
+      Candidate* candidate;
+      {
+        base::MutexGuard guard(&mutex_);
+        candidate = NextCandidateLocked();
+        if (candidate == nullptr) {
+          pending_tasks_--;
+          cv_.NotifyAll();
+          return;
+        }
+        candidate->status = Candidate::Status::kRunning;
+        running_tasks_++;
+      }
+
+      // The parser does not remove running candidates, and only the task
+      // that runs it changes one.
+      std::unique_ptr<Result> result = Preparse(*candidate, stack_limit);
+
+      base::MutexGuard guard(&mutex_);
+      candidate->result = std::move(result);
+      candidate->status = Candidate::Status::kDone;
+      running_tasks_--;
+      cv_.NotifyAll();
+    }
+  }
+
+  std::unique_ptr<Result> Preparse(const Candidate& candidate,
+                                   uintptr_t stack_limit) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.ParallelPreParse");
+    std::unique_ptr<ParseInfo> info =
+        ParseInfo::ForSameScript(info_.get(), allocator_);
+    info->set_stack_limit(stack_limit);
+    info->set_character_stream(stream_->Clone());
+    info->character_stream()->Seek(candidate.start_position);
+
+    std::unique_ptr<Result> result = base::make_unique<Result>();
+    {
+      Parser parser(info.get());
+      AstValueFactory* ast_value_factory = info->GetOrCreateAstValueFactory();
+      const AstRawString* name = nullptr;
+      if (candidate.name_is_one_byte) {
+        name = ast_value_factory->GetOneByteString(Vector<const uint8_t>(
+            candidate.name.data(), static_cast<int>(candidate.name.size())));
+      } else {
+        name = ast_value_factory->GetTwoByteString(Vector<const uint16_t>(
+            reinterpret_cast<const uint16_t*>(candidate.name.data()),
+            static_cast<int>(candidate.name.size() / 2)));
+      }
+      if (!parser.PreParseTopLevelFunction(name, candidate.kind,
+                                           candidate.function_type,
+                                           candidate.language_mode,
+                                           result.get())) {
+        return nullptr;
+      }
+    }
+    result->parse_info = std::move(info);
+    return result;
+  }
+
+  // Returns the next candidate the parser did not reach yet, or nullptr if
+  // there is none or the tasks are far enough ahead of the parser.
+  Candidate* NextCandidateLocked() {
+    if (cancelled_) return nullptr;
+    while (!queue_.empty() && results_ahead_ < max_results_ahead_) {
+      int position = queue_.front();
+      queue_.pop_front();
+      auto it = candidates_.find(position);
+      if (it == candidates_.end()) continue;
+      if (position < main_position_) {
+        candidates_.erase(it);
+        continue;
+      }
+      DCHECK_EQ(Candidate::Status::kQueued, it->second->status);
+      results_ahead_++;
+      return it->second.get();
+    }
+    return nullptr;
+  }
+
+  // Drops the candidates before {position}, which the parser either
+  // compiled eagerly or that were not functions at the top level. Running
+  // candidates are dropped once they are done.
+  void DropCandidatesBeforeLocked(int position) {
+    auto it = candidates_.begin();
+    while (it != candidates_.end() && it->first < position) {
+      switch (it->second->status) {
+        case Candidate::Status::kRunning:
+          ++it;
+          break;
+        case Candidate::Status::kDone:
+          results_ahead_--;
+          it = candidates_.erase(it);
+          break;
+        case Candidate::Status::kQueued:
+          it = candidates_.erase(it);
+          break;
+      }
+    }
+  }
+
+  // Posts tasks for the queued candidates that no task will pick up soon.
+  void ScheduleTasksLocked() {
+    while (pending_tasks_ < max_tasks_ &&
+           static_cast<size_t>(pending_tasks_) < queue_.size() &&
+           results_ahead_ + pending_tasks_ < max_results_ahead_) {
+      pending_tasks_++;
+      V8::GetCurrentPlatform()->CallOnWorkerThread(
+          base::make_unique<PreparseTask>(shared_from_this()));
+    }
+  }
+
+  AccountingAllocator* const allocator_;
+  // The template for the parse infos of the tasks, which only read it.
+  std::unique_ptr<ParseInfo> info_;
+  // The source, which is cloned for every task.
+  std::unique_ptr<Utf16CharacterStream> stream_;
+  std::unique_ptr<Utf16CharacterStream> scan_stream_;
+  const int stack_size_;
+  const int max_tasks_;
+  const int max_results_ahead_;
+
+  std::atomic<bool> cancelled_{false};
+
+  base::Mutex mutex_;
+  base::ConditionVariable cv_;
+  // The candidates by start position.
+  std::map<int, std::unique_ptr<Candidate>> candidates_;
+  // The start positions of the candidates to preparse, in source order.
+  std::deque<int> queue_;
+  // The start position of the function the parser reached last.
+  int main_position_ = 0;
+  // The number of running or done candidates the parser did not take yet.
+  int results_ahead_ = 0;
+  int running_tasks_ = 0;
+  int pending_tasks_ = 0;
+  bool scanning_ = false;
+  bool scan_finished_ = false;
+
+  DISALLOW_COPY_AND_ASSIGN(State);
+};
+
+ParallelPreparser::Result::Result() {
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    use_counts[feature] = 0;
+  }
+}
+
+ParallelPreparser::Result::~Result() = default;
+
+// static
+bool ParallelPreparser::IsEnabledFor(ParseInfo* info, int source_length) {
+  if (!FLAG_parallel_preparse) return false;
+  if (!info->allow_lazy_parsing() || !info->allow_lazy_compile() ||
+      info->is_eager() || info->is_native()) {
+    return false;
+  }
+  if (info->is_eval() || info->is_module() || info->is_wrapped_as_function() ||
+      info->extension() != nullptr) {
+    return false;
+  }
+  // Function events and runtime call stats are only recorded for functions
+  // that are preparsed on the main thread.
+  if (FLAG_log_function_events || FLAG_runtime_stats) return false;
+  if (V8::GetCurrentPlatform()->NumberOfWorkerThreads() == 0) return false;
+  return FLAG_stress_parallel_preparse ||
+         source_length >= FLAG_parallel_preparse_min_source_length;
+}
+
+ParallelPreparser::ParallelPreparser(
+    ParseInfo* info, std::unique_ptr<Utf16CharacterStream> stream)
+    : state_(std::make_shared<State>(info, std::move(stream))) {
+  state_->Start();
+}
+
+ParallelPreparser::~ParallelPreparser() { state_->Cancel(); }
+
+std::unique_ptr<ParallelPreparser::Result> ParallelPreparser::TakeResult(
+    const AstRawString* function_name, FunctionKind kind,
+    FunctionLiteral::FunctionType function_type,
+    DeclarationScope* function_scope) {
+  return state_->TakeResult(function_name, kind, function_type,
+                            function_scope);
+}
+
+void ParallelPreparser::WaitForAllResults() { state_->WaitForAllResults(); }
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,93 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PARALLEL_PREPARSER_H_
+#define V8_PARSING_PARALLEL_PREPARSER_H_
+
+#include <memory>
+
+#include "include/v8.h"
+#include "src/ast/ast.h"
+#include "src/function-kind.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+class AstRawString;
+class DeclarationScope;
+class ParseInfo;
+class ProducedPreparseData;
+class Utf16CharacterStream;
+
+// Preparses the lazily compiled functions at the top level of a script on
+// worker threads while the main thread parses the script.
+//
+// A worker task scans the source for the 'function' tokens that are not
+// nested in a function body or block, and other worker tasks preparse the
+// functions they find ahead of the parser. These functions do not need the
+// rest of the script to be preparsed, since all their free variables resolve
+// to the script scope. When the parser reaches a lazy function whose outer
+// scope is the script scope, it takes the result for the function's position
+// instead of preparsing the function itself, but only if the function's
+// name, kind and language mode match the ones the worker assumed. The scan
+// for candidates is a heuristic on the token stream, and results the parser
+// does not take are dropped.
+class ParallelPreparser {
+ public:
+  // The outcome of preparsing a function on a worker thread.
+  struct Result {
+    Result();
+    ~Result();
+
+    int end_position = kNoSourcePosition;
+    int num_parameters = 0;
+    int num_inner_functions = 0;
+    LanguageMode language_mode = LanguageMode::kSloppy;
+    bool allow_eval_cache = true;
+    bool calls_sloppy_eval = false;
+    bool inner_scope_calls_eval = false;
+    int use_counts[v8::Isolate::kUseCounterFeatureCount];
+    // Lives in the zone of {parse_info}.
+    ProducedPreparseData* produced_preparse_data = nullptr;
+    std::unique_ptr<ParseInfo> parse_info;
+
+    DISALLOW_COPY_AND_ASSIGN(Result);
+  };
+
+  // Whether the script parsed with {info} should be preparsed in parallel.
+  static bool IsEnabledFor(ParseInfo* info, int source_length);
+
+  // Starts scanning {stream}, which must be cloneable and must not access
+  // the heap, for functions to preparse on worker threads.
+  ParallelPreparser(ParseInfo* info,
+                    std::unique_ptr<Utf16CharacterStream> stream);
+  // Cancels the remaining work and waits for the running tasks.
+  ~ParallelPreparser();
+
+  // Returns the result for the function that starts at the start position of
+  // {function_scope}, waiting for it if a worker thread is preparsing it.
+  // Returns nullptr if there is none, or if the worker made assumptions
+  // about the function that turned out to be wrong.
+  std::unique_ptr<Result> TakeResult(
+      const AstRawString* function_name, FunctionKind kind,
+      FunctionLiteral::FunctionType function_type,
+      DeclarationScope* function_scope);
+
+  // Waits until all functions are found and preparsed, so that the parser
+  // takes every result. Used for stress testing.
+  void WaitForAllResults();
+
+ private:
+  class State;
+
+  std::shared_ptr<State> state_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelPreparser);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PARALLEL_PREPARSER_H_
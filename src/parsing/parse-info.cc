@@ -128,14 +128,7 @@ std::unique_ptr<ParseInfo> ParseInfo::FromParent(
     const ParseInfo* outer_parse_info, AccountingAllocator* zone_allocator,
     const FunctionLiteral* literal, const AstRawString* function_name) {
   std::unique_ptr<ParseInfo> result =
-      base::make_unique<ParseInfo>(zone_allocator);
-
-  // Replicate shared state of the outer_parse_info.
-  result->flags_ = outer_parse_info->flags_;
-  result->script_id_ = outer_parse_info->script_id_;
-  result->set_logger(outer_parse_info->logger());
-  result->set_ast_string_constants(outer_parse_info->ast_string_constants());
-  result->set_hash_seed(outer_parse_info->hash_seed());
+      ForSameScript(outer_parse_info, zone_allocator);
 
   DCHECK_EQ(outer_parse_info->parameters_end_pos(), kNoSourcePosition);
   DCHECK_NULL(outer_parse_info->extension());
@@ -158,6 +151,21 @@ std::unique_ptr<ParseInfo> ParseInfo::FromParent(
   return result;
 }
 
+// static
+std::unique_ptr<ParseInfo> ParseInfo::ForSameScript(
+    const ParseInfo* outer_parse_info, AccountingAllocator* zone_allocator) {
+  std::unique_ptr<ParseInfo> result =
+      base::make_unique<ParseInfo>(zone_allocator);
+
+  // Replicate shared state of the outer_parse_info.
+  result->flags_ = outer_parse_info->flags_;
+  result->script_id_ = outer_parse_info->script_id_;
+  result->set_logger(outer_parse_info->logger());
+  result->set_ast_string_constants(outer_parse_info->ast_string_constants());
+  result->set_hash_seed(outer_parse_info->hash_seed());
+  return result;
+}
+
 ParseInfo::~ParseInfo() = default;
 
 DeclarationScope* ParseInfo::scope() const { return literal()->scope(); }
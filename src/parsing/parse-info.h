@@ -51,6 +51,11 @@ class V8_EXPORT_PRIVATE ParseInfo {
       const ParseInfo* outer_parse_info, AccountingAllocator* zone_allocator,
       const FunctionLiteral* literal, const AstRawString* function_name);
 
+  // Creates a new parse info with the flags and script id of
+  // |outer_parse_info|, for parsing another part of the same script.
+  static std::unique_ptr<ParseInfo> ForSameScript(
+      const ParseInfo* outer_parse_info, AccountingAllocator* zone_allocator);
+
   ~ParseInfo();
 
   Handle<Script> CreateScript(Isolate* isolate, Handle<String> source,
@@ -23,6 +23,7 @@
 #include "src/parsing/expression-scope-reparenter.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/rewriter.h"
+#include "src/parsing/scanner-character-streams.h"
 #include "src/runtime/runtime.h"
 #include "src/string-stream.h"
 #include "src/tracing/trace-event.h"
@@ -500,7 +501,17 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
   if (FLAG_harmony_hashbang && !info->is_eval()) {
     scanner_.SkipHashBang();
   }
+  if (ParallelPreparser::IsEnabledFor(
+          info, String::cast(info->script()->source())->length())) {
+    Handle<String> source(String::cast(info->script()->source()), isolate);
+    parallel_preparser_.reset(new ParallelPreparser(
+        info, ScannerStream::ForOffHeapCopy(isolate, source)));
+    if (FLAG_stress_parallel_preparse) {
+      parallel_preparser_->WaitForAllResults();
+    }
+  }
   FunctionLiteral* result = DoParseProgram(isolate, info);
+  parallel_preparser_.reset();
   MaybeResetCharacterStream(info, result);
   MaybeProcessSourceRanges(info, result, stack_limit_);
 
@@ -2488,6 +2499,41 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
     return true;
   }
 
+  if (parallel_preparser_ && function_scope->outer_scope()->is_script_scope() &&
+      !IsArrowFunction(kind)) {
+    std::unique_ptr<ParallelPreparser::Result> result =
+        parallel_preparser_->TakeResult(function_name, kind, function_type,
+                                        function_scope);
+    if (result) {
+      if (stack_overflow()) return true;
+      function_scope->set_end_position(result->end_position);
+      scanner()->SeekForward(result->end_position - 1);
+      Expect(Token::RBRACE);
+      function_scope->SetLanguageMode(result->language_mode);
+      if (result->calls_sloppy_eval) function_scope->RecordEvalCall();
+      if (result->inner_scope_calls_eval) {
+        function_scope->RecordInnerScopeEvalCall();
+      }
+      if (!result->allow_eval_cache) set_allow_eval_cache(false);
+      total_preparse_skipped_ +=
+          function_scope->end_position() - function_scope->start_position();
+      *num_parameters = result->num_parameters;
+      SkipFunctionLiterals(result->num_inner_functions);
+      // The data lives in the zone of the worker's parse info, so copy it.
+      if (result->produced_preparse_data != nullptr) {
+        *produced_preparse_data = ProducedPreparseData::For(
+            result->produced_preparse_data->Serialize(main_zone()),
+            main_zone());
+      }
+      for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+           ++feature) {
+        use_counts_[feature] += result->use_counts[feature];
+      }
+      function_scope->ResetAfterPreparsing(ast_value_factory(), false);
+      return true;
+    }
+  }
+
   Scanner::BookmarkScope bookmark(scanner());
   bookmark.Set(function_scope->start_position());
 
@@ -2535,6 +2581,61 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
   return true;
 }
 
+bool Parser::PreParseTopLevelFunction(
+    const AstRawString* function_name, FunctionKind kind,
+    FunctionLiteral::FunctionType function_type, LanguageMode language_mode,
+    ParallelPreparser::Result* result) {
+  DCHECK(!IsArrowFunction(kind));
+  parsing_on_main_thread_ = false;
+  scanner_.Initialize();
+  if (!Check(Token::LPAREN)) return false;
+
+  DeclarationScope* script_scope = NewScriptScope();
+  FunctionState script_state(&function_state_, &scope_, script_scope);
+  script_scope->SetLanguageMode(language_mode);
+
+  DeclarationScope* function_scope = NewFunctionScope(kind, &preparser_zone_);
+  function_scope->SetLanguageMode(language_mode);
+  function_scope->set_start_position(position());
+
+  ProducedPreparseData* produced_preparse_data = nullptr;
+  FunctionState function_state(&function_state_, &scope_, function_scope);
+  PreParser::PreParseResult preparse_result =
+      reusable_preparser()->PreParseFunction(
+          function_name, kind, function_type, function_scope, use_counts_,
+          &produced_preparse_data, script_id());
+  if (preparse_result != PreParser::kPreParseSuccess ||
+      pending_error_handler()->has_pending_error()) {
+    return false;
+  }
+
+  PreParserLogger* logger = reusable_preparser()->logger();
+  function_scope->set_end_position(logger->end());
+  // The parser of the script reports octal literals in strict functions.
+  if (is_strict(function_scope->language_mode()) &&
+      scanner()->octal_position().IsValid()) {
+    return false;
+  }
+  result->end_position = logger->end();
+  result->num_parameters = logger->num_parameters();
+  result->num_inner_functions = logger->num_inner_functions();
+  result->language_mode = function_scope->language_mode();
+  result->allow_eval_cache = reusable_preparser()->allow_eval_cache();
+  result->calls_sloppy_eval = function_scope->calls_sloppy_eval();
+  result->inner_scope_calls_eval = function_scope->inner_scope_calls_eval();
+
+  function_scope->AnalyzePartially(this, factory());
+  // References to private names outside of a class are errors.
+  if (function_scope->has_unresolved_references()) return false;
+
+  result->produced_preparse_data = produced_preparse_data;
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    result->use_counts[feature] = use_counts_[feature];
+  }
+  return true;
+}
+
 Block* Parser::BuildParameterInitializationBlock(
     const ParserFormalParameters& parameters) {
   DCHECK(!parameters.is_simple);
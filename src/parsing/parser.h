@@ -13,6 +13,7 @@
 #include "src/base/compiler-specific.h"
 #include "src/base/threaded-list.h"
 #include "src/globals.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parser-base.h"
 #include "src/parsing/parsing.h"
 #include "src/parsing/preparser.h"
@@ -181,6 +182,18 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
 
   void ParseOnBackground(ParseInfo* info);
 
+  // Preparses the function at the top level of the script whose parameters
+  // start at the current position of the character stream, as the parser of
+  // the script would if it did not compile the function eagerly. Fills in
+  // {result} and returns true if that succeeded. Returns false if the
+  // function has an error, which is left for the parser of the script to
+  // report. Used by the ParallelPreparser on worker threads.
+  bool PreParseTopLevelFunction(const AstRawString* function_name,
+                                FunctionKind kind,
+                                FunctionLiteral::FunctionType function_type,
+                                LanguageMode language_mode,
+                                ParallelPreparser::Result* result);
+
   // Initializes an empty scope chain for top-level scripts, or scopes which
   // consist of only the native context.
   void InitializeEmptyScopeChain(ParseInfo* info);
@@ -1061,6 +1074,8 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
   std::vector<uint8_t> preparse_data_buffer_;
+  // Preparses the lazy top-level functions on worker threads, if enabled.
+  std::unique_ptr<ParallelPreparser> parallel_preparser_;
 
   // If not kNoSourcePosition, indicates that the first function literal
   // encountered is a dynamic function, see CreateDynamicFunction(). This field
@@ -139,6 +139,30 @@ class ExternalStringStream {
   const size_t length_;
 };
 
+// A Char stream backed by an off-heap copy of a string. The copy is shared
+// with the clones of the stream, which may be used on other threads.
+template <typename Char>
+class OffHeapCopyStream {
+ public:
+  explicit OffHeapCopyStream(std::shared_ptr<const std::vector<Char>> data)
+      : data_(std::move(data)) {}
+
+  // The no_gc argument is only here because of the templated way this class
+  // is used along with other implementations that require V8 heap access.
+  Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
+                        DisallowHeapAllocation* no_gc = nullptr) {
+    const Char* start = data_->data();
+    size_t length = data_->size();
+    return {&start[Min(length, pos)], &start[length]};
+  }
+
+  static const bool kCanBeCloned = true;
+  static const bool kCanAccessHeap = false;
+
+ private:
+  std::shared_ptr<const std::vector<Char>> data_;
+};
+
 // A Char stream backed by a C array. Testing only.
 template <typename Char>
 class TestingStream {
@@ -299,26 +323,26 @@ class BufferedCharacterStream : public Utf16CharacterStream {
 };
 
 // Provides a unbuffered utf-16 view on the bytes from the underlying
-// ByteStream.
-template <template <typename T> class ByteStream>
+// ByteStream. With one-byte Chars, the stream scans the one-byte characters
+// in place instead of widening them into a buffer.
+template <template <typename T> class ByteStream, typename Char = uint16_t>
 class UnbufferedCharacterStream : public Utf16CharacterStream {
  public:
   template <class... TArgs>
   UnbufferedCharacterStream(size_t pos, TArgs... args) : byte_stream_(args...) {
     buffer_pos_ = pos;
+    is_one_byte_ = sizeof(Char) == 1;
   }
 
   bool can_access_heap() const final {
-    return ByteStream<uint16_t>::kCanAccessHeap;
+    return ByteStream<Char>::kCanAccessHeap;
   }
 
-  bool can_be_cloned() const final {
-    return ByteStream<uint16_t>::kCanBeCloned;
-  }
+  bool can_be_cloned() const final { return ByteStream<Char>::kCanBeCloned; }
 
   std::unique_ptr<Utf16CharacterStream> Clone() const override {
     return std::unique_ptr<Utf16CharacterStream>(
-        new UnbufferedCharacterStream<ByteStream>(*this));
+        new UnbufferedCharacterStream<ByteStream, Char>(*this));
   }
 
  protected:
@@ -326,32 +350,34 @@ class UnbufferedCharacterStream : public Utf16CharacterStream {
     size_t position = pos();
     buffer_pos_ = position;
     DisallowHeapAllocation no_gc;
-    Range<uint16_t> range =
+    Range<Char> range =
         byte_stream_.GetDataAt(position, runtime_call_stats(), &no_gc);
-    buffer_start_ = range.start;
-    buffer_end_ = range.end;
-    buffer_cursor_ = buffer_start_;
+    SetBuffer(range.start, range.end);
     if (range.length() == 0) return false;
 
     DCHECK(!range.unaligned_start());
-    DCHECK_LE(buffer_start_, buffer_end_);
+    DCHECK_LE(range.start, range.end);
     return true;
   }
 
-  UnbufferedCharacterStream(const UnbufferedCharacterStream<ByteStream>& other)
-      : byte_stream_(other.byte_stream_) {}
+  UnbufferedCharacterStream(
+      const UnbufferedCharacterStream<ByteStream, Char>& other)
+      : byte_stream_(other.byte_stream_) {
+    is_one_byte_ = sizeof(Char) == 1;
+  }
 
-  ByteStream<uint16_t> byte_stream_;
+  ByteStream<Char> byte_stream_;
 };
 
 // Provides a unbuffered utf-16 view on the bytes from the underlying
-// ByteStream.
+// on-heap string, which moves the view along when the string is relocated.
+template <typename Char>
 class RelocatingCharacterStream
-    : public UnbufferedCharacterStream<OnHeapStream> {
+    : public UnbufferedCharacterStream<OnHeapStream, Char> {
  public:
   template <class... TArgs>
   RelocatingCharacterStream(Isolate* isolate, size_t pos, TArgs... args)
-      : UnbufferedCharacterStream<OnHeapStream>(pos, args...),
+      : UnbufferedCharacterStream<OnHeapStream, Char>(pos, args...),
         isolate_(isolate) {
     isolate->heap()->AddGCEpilogueCallback(UpdateBufferPointersCallback,
                                            v8::kGCTypeAll, this);
@@ -373,13 +399,10 @@ class RelocatingCharacterStream
 
   void UpdateBufferPointers() {
     DisallowHeapAllocation no_gc;
-    Range<uint16_t> range =
-        byte_stream_.GetDataAt(0, runtime_call_stats(), &no_gc);
-    if (range.start != buffer_start_) {
-      buffer_cursor_ = (buffer_cursor_ - buffer_start_) + range.start;
-      buffer_start_ = range.start;
-      buffer_end_ = range.end;
-    }
+    // The buffer starts at buffer_pos_, which ReadBlock last read from.
+    Range<Char> range = this->byte_stream_.GetDataAt(
+        this->buffer_pos_, this->runtime_call_stats(), &no_gc);
+    this->RelocateBuffer(range.start, range.end);
   }
 
   Isolate* isolate_;
@@ -769,6 +792,11 @@ Utf16CharacterStream* ScannerStream::For(Isolate* isolate, Handle<String> data,
     data = String::Flatten(isolate, data);
   }
   if (data->IsExternalOneByteString()) {
+    if (FLAG_scan_one_byte_in_place) {
+      return new UnbufferedCharacterStream<ExternalStringStream, uint8_t>(
+          static_cast<size_t>(start_pos), ExternalOneByteString::cast(*data),
+          start_offset, static_cast<size_t>(end_pos));
+    }
     return new BufferedCharacterStream<ExternalStringStream>(
         static_cast<size_t>(start_pos), ExternalOneByteString::cast(*data),
         start_offset, static_cast<size_t>(end_pos));
@@ -777,11 +805,17 @@ Utf16CharacterStream* ScannerStream::For(Isolate* isolate, Handle<String> data,
         static_cast<size_t>(start_pos), ExternalTwoByteString::cast(*data),
         start_offset, static_cast<size_t>(end_pos));
   } else if (data->IsSeqOneByteString()) {
+    if (FLAG_scan_one_byte_in_place) {
+      return new RelocatingCharacterStream<uint8_t>(
+          isolate, static_cast<size_t>(start_pos),
+          Handle<SeqOneByteString>::cast(data), start_offset,
+          static_cast<size_t>(end_pos));
+    }
     return new BufferedCharacterStream<OnHeapStream>(
         static_cast<size_t>(start_pos), Handle<SeqOneByteString>::cast(data),
         start_offset, static_cast<size_t>(end_pos));
   } else if (data->IsSeqTwoByteString()) {
-    return new RelocatingCharacterStream(
+    return new RelocatingCharacterStream<uint16_t>(
         isolate, static_cast<size_t>(start_pos),
         Handle<SeqTwoByteString>::cast(data), start_offset,
         static_cast<size_t>(end_pos));
@@ -790,6 +824,33 @@ Utf16CharacterStream* ScannerStream::For(Isolate* isolate, Handle<String> data,
   }
 }
 
+std::unique_ptr<Utf16CharacterStream> ScannerStream::ForOffHeapCopy(
+    Isolate* isolate, Handle<String> data) {
+  data = String::Flatten(isolate, data);
+  DisallowHeapAllocation no_gc;
+  size_t length = static_cast<size_t>(data->length());
+  if (data->IsOneByteRepresentation()) {
+    auto chars = std::make_shared<std::vector<uint8_t>>(length);
+    String::WriteToFlat(*data, chars->data(), 0, data->length());
+    if (FLAG_scan_one_byte_in_place) {
+      return std::unique_ptr<Utf16CharacterStream>(
+          new UnbufferedCharacterStream<OffHeapCopyStream, uint8_t>(
+              static_cast<size_t>(0),
+              std::shared_ptr<const std::vector<uint8_t>>(std::move(chars))));
+    }
+    return std::unique_ptr<Utf16CharacterStream>(
+        new BufferedCharacterStream<OffHeapCopyStream>(
+            static_cast<size_t>(0),
+            std::shared_ptr<const std::vector<uint8_t>>(std::move(chars))));
+  }
+  auto chars = std::make_shared<std::vector<uint16_t>>(length);
+  String::WriteToFlat(*data, chars->data(), 0, data->length());
+  return std::unique_ptr<Utf16CharacterStream>(
+      new UnbufferedCharacterStream<OffHeapCopyStream>(
+          static_cast<size_t>(0),
+          std::shared_ptr<const std::vector<uint16_t>>(std::move(chars))));
+}
+
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data) {
   return ScannerStream::ForTesting(data, strlen(data));
@@ -797,6 +858,12 @@ std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
 
 std::unique_ptr<Utf16CharacterStream> ScannerStream::ForTesting(
     const char* data, size_t length) {
+  if (FLAG_scan_one_byte_in_place) {
+    return std::unique_ptr<Utf16CharacterStream>(
+        new UnbufferedCharacterStream<TestingStream, uint8_t>(
+            static_cast<size_t>(0), reinterpret_cast<const uint8_t*>(data),
+            static_cast<size_t>(length)));
+  }
   return std::unique_ptr<Utf16CharacterStream>(
       new BufferedCharacterStream<TestingStream>(
           static_cast<size_t>(0), reinterpret_cast<const uint8_t*>(data),
@@ -811,6 +878,10 @@ Utf16CharacterStream* ScannerStream::For(
       return new UnbufferedCharacterStream<ChunkedStream>(
           static_cast<size_t>(0), source_stream);
     case v8::ScriptCompiler::StreamedSource::ONE_BYTE:
+      if (FLAG_scan_one_byte_in_place) {
+        return new UnbufferedCharacterStream<ChunkedStream, uint8_t>(
+            static_cast<size_t>(0), source_stream);
+      }
       return new BufferedCharacterStream<ChunkedStream>(static_cast<size_t>(0),
                                                         source_stream);
     case v8::ScriptCompiler::StreamedSource::UTF8:
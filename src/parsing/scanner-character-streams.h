@@ -26,6 +26,11 @@ class V8_EXPORT_PRIVATE ScannerStream {
       ScriptCompiler::ExternalSourceStream* source_stream,
       ScriptCompiler::StreamedSource::Encoding encoding);
 
+  // Returns a stream over an off-heap copy of {data}, which can be cloned for
+  // worker threads that scan the source in parallel.
+  static std::unique_ptr<Utf16CharacterStream> ForOffHeapCopy(
+      Isolate* isolate, Handle<String> data);
+
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data);
   static std::unique_ptr<Utf16CharacterStream> ForTesting(const char* data,
                                                           size_t length);
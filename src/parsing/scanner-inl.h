@@ -7,6 +7,7 @@
 
 #include "src/char-predicates-inl.h"
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 
 namespace v8 {
@@ -256,6 +257,8 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // fall into the slow path after scanning the identifier.
       DCHECK(!NeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
+      // Any characters the fast path skips are left to the keyword lookup.
+      if (vectorize_) AddLiteralRun(scanner_simd::IdentifierPartRun());
       AdvanceUntil([this, &scan_flags](uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
@@ -310,6 +313,12 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
+    if (vectorize_) {
+      bool line_terminator = false;
+      source_->AdvanceRun(scanner_simd::WhiteSpaceRun(&line_terminator),
+                          scanner_simd::IgnoreRun());
+      if (line_terminator) next().after_line_terminator = true;
+    }
     Advance();
   }
 
@@ -0,0 +1,225 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <stdint.h>
+
+#include "src/base/bits.h"
+#include "src/base/macros.h"
+#include "src/char-predicates-inl.h"
+
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#endif
+
+namespace v8 {
+namespace internal {
+
+// Vectorized helpers for the scanner fast paths. Each of them returns a
+// pointer to the first character in [start, end) that is not in its ASCII
+// character class, or {end} if there is none. Non-ASCII characters are never
+// in the class, so that the scanner handles them on its regular path. They
+// work both on UTF-16 code units and on the characters of one-byte sources
+// that are scanned in place.
+//
+// On x64 the characters are classified a vector at a time with SSE2, which
+// every x64 CPU supports. Other platforms, and the remainder of a range that
+// does not fill a whole vector, use the scalar loop.
+
+namespace scanner_simd {
+
+#if V8_HOST_ARCH_X64
+
+template <typename Char>
+struct Lanes;
+
+template <>
+struct Lanes<uint8_t> {
+  static const int kCount = 16;
+  static V8_INLINE __m128i Splat(uint8_t c) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  }
+  static V8_INLINE __m128i Equals(__m128i v, uint8_t c) {
+    return _mm_cmpeq_epi8(v, Splat(c));
+  }
+  // Lanes whose character is in [lo, hi], using an unsigned comparison.
+  static V8_INLINE __m128i InRange(__m128i v, uint8_t lo, uint8_t hi) {
+    __m128i excess = _mm_subs_epu8(_mm_sub_epi8(v, Splat(lo)), Splat(hi - lo));
+    return _mm_cmpeq_epi8(excess, _mm_setzero_si128());
+  }
+};
+
+template <>
+struct Lanes<uint16_t> {
+  static const int kCount = 8;
+  static V8_INLINE __m128i Splat(uint16_t c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static V8_INLINE __m128i Equals(__m128i v, uint16_t c) {
+    return _mm_cmpeq_epi16(v, Splat(c));
+  }
+  static V8_INLINE __m128i InRange(__m128i v, uint16_t lo, uint16_t hi) {
+    __m128i excess =
+        _mm_subs_epu16(_mm_sub_epi16(v, Splat(lo)), Splat(hi - lo));
+    return _mm_cmpeq_epi16(excess, _mm_setzero_si128());
+  }
+};
+
+// Returns the index of the first lane that is not set in {in_class}, or the
+// number of lanes if all of them are.
+template <typename Char>
+V8_INLINE int FirstLaneNotInClass(__m128i in_class) {
+  // The byte mask has sizeof(Char) bits per lane.
+  uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(in_class)) ^ 0xFFFF;
+  if (mask == 0) return Lanes<Char>::kCount;
+  return base::bits::CountTrailingZeros(mask) / sizeof(Char);
+}
+
+// Whether any of the first {count} lanes is set in {lanes}.
+template <typename Char>
+V8_INLINE bool AnyLaneSet(__m128i lanes, int count) {
+  uint32_t prefix = (1u << (count * sizeof(Char))) - 1;
+  return (static_cast<uint32_t>(_mm_movemask_epi8(lanes)) & prefix) != 0;
+}
+
+V8_INLINE __m128i Load(const void* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+#endif  // V8_HOST_ARCH_X64
+
+V8_INLINE bool IsAsciiWhiteSpace(uc32 c) {
+  return c == ' ' || IsInRange(c, '\t', '\r');
+}
+
+V8_INLINE bool IsAsciiIdentifierPart(uc32 c) {
+  return IsInRange(AsciiAlphaToLower(c), 'a', 'z') || IsDecimalDigit(c) ||
+         c == '_' || c == '$';
+}
+
+// Everything but the characters that end the fast path of a string literal:
+// quotes, escapes, line terminators and non-ASCII characters.
+V8_INLINE bool IsAsciiStringLiteralPart(uc32 c) {
+  return c < 0x80 && c != '\'' && c != '"' && c != '\\' && c != '\n' &&
+         c != '\r';
+}
+
+// Skips ' ', '\t', '\v', '\f' and the line terminators '\n' and '\r'. Sets
+// {line_terminator} if any of the latter were skipped.
+template <typename Char>
+V8_INLINE const Char* SkipAsciiWhiteSpace(const Char* start, const Char* end,
+                                          bool* line_terminator) {
+  const Char* p = start;
+#if V8_HOST_ARCH_X64
+  typedef Lanes<Char> L;
+  while (end - p >= L::kCount) {
+    __m128i v = Load(p);
+    int count = FirstLaneNotInClass<Char>(
+        _mm_or_si128(L::Equals(v, ' '), L::InRange(v, '\t', '\r')));
+    __m128i terminators = _mm_or_si128(L::Equals(v, '\n'), L::Equals(v, '\r'));
+    if (AnyLaneSet<Char>(terminators, count)) *line_terminator = true;
+    p += count;
+    if (count < L::kCount) return p;
+  }
+#endif  // V8_HOST_ARCH_X64
+  for (; p < end && IsAsciiWhiteSpace(*p); ++p) {
+    if (*p == '\n' || *p == '\r') *line_terminator = true;
+  }
+  return p;
+}
+
+// Skips the ASCII identifier part characters [A-Za-z0-9_$].
+template <typename Char>
+V8_INLINE const Char* SkipAsciiIdentifierPart(const Char* start,
+                                              const Char* end) {
+  const Char* p = start;
+#if V8_HOST_ARCH_X64
+  typedef Lanes<Char> L;
+  while (end - p >= L::kCount) {
+    __m128i v = Load(p);
+    // Setting 0x20 maps upper case letters to lower case ones, and no other
+    // character into the lower case range.
+    __m128i letters = L::InRange(_mm_or_si128(v, L::Splat(0x20)), 'a', 'z');
+    __m128i others =
+        _mm_or_si128(L::InRange(v, '0', '9'),
+                     _mm_or_si128(L::Equals(v, '_'), L::Equals(v, '$')));
+    int count = FirstLaneNotInClass<Char>(_mm_or_si128(letters, others));
+    p += count;
+    if (count < L::kCount) return p;
+  }
+#endif  // V8_HOST_ARCH_X64
+  while (p < end && IsAsciiIdentifierPart(*p)) ++p;
+  return p;
+}
+
+// Skips the ASCII characters that can appear in a string literal as is, that
+// is everything but quotes, backslashes and line terminators.
+template <typename Char>
+V8_INLINE const Char* SkipAsciiStringLiteralPart(const Char* start,
+                                                 const Char* end) {
+  const Char* p = start;
+#if V8_HOST_ARCH_X64
+  typedef Lanes<Char> L;
+  while (end - p >= L::kCount) {
+    __m128i v = Load(p);
+    __m128i special = _mm_or_si128(
+        _mm_or_si128(L::Equals(v, '\''), L::Equals(v, '"')),
+        _mm_or_si128(L::Equals(v, '\\'),
+                     _mm_or_si128(L::Equals(v, '\n'), L::Equals(v, '\r'))));
+    __m128i ascii = L::InRange(v, 0, 0x7F);
+    int count = FirstLaneNotInClass<Char>(_mm_andnot_si128(special, ascii));
+    p += count;
+    if (count < L::kCount) return p;
+  }
+#endif  // V8_HOST_ARCH_X64
+  while (p < end && IsAsciiStringLiteralPart(*p)) ++p;
+  return p;
+}
+
+// Function objects for Utf16CharacterStream::AdvanceRun, which calls them
+// with either the one-byte or the UTF-16 buffer of the stream.
+
+class WhiteSpaceRun {
+ public:
+  explicit WhiteSpaceRun(bool* line_terminator)
+      : line_terminator_(line_terminator) {}
+
+  template <typename Char>
+  V8_INLINE const Char* operator()(const Char* start, const Char* end) const {
+    return SkipAsciiWhiteSpace(start, end, line_terminator_);
+  }
+
+ private:
+  bool* line_terminator_;
+};
+
+class IdentifierPartRun {
+ public:
+  template <typename Char>
+  V8_INLINE const Char* operator()(const Char* start, const Char* end) const {
+    return SkipAsciiIdentifierPart(start, end);
+  }
+};
+
+class StringLiteralRun {
+ public:
+  template <typename Char>
+  V8_INLINE const Char* operator()(const Char* start, const Char* end) const {
+    return SkipAsciiStringLiteralPart(start, end);
+  }
+};
+
+class IgnoreRun {
+ public:
+  template <typename Char>
+  V8_INLINE void operator()(const Char* chars, int length) const {}
+};
+
+}  // namespace scanner_simd
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
@@ -104,6 +104,24 @@ void Scanner::LiteralBuffer::ConvertToTwoByte() {
   is_one_byte_ = false;
 }
 
+template <typename Char>
+void Scanner::LiteralBuffer::AddAsciiChars(const Char* chars, int length) {
+  int size = length * (is_one_byte() ? kOneByteSize : kUC16Size);
+  while (position_ + size > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    CopyChars(&backing_store_[position_], chars, length);
+  } else {
+    CopyChars(reinterpret_cast<uint16_t*>(&backing_store_[position_]), chars,
+              length);
+  }
+  position_ += size;
+}
+
+template void Scanner::LiteralBuffer::AddAsciiChars(const uint8_t* chars,
+                                                    int length);
+template void Scanner::LiteralBuffer::AddAsciiChars(const uint16_t* chars,
+                                                    int length);
+
 void Scanner::LiteralBuffer::AddTwoByteChar(uc32 code_unit) {
   DCHECK(!is_one_byte());
   if (position_ >= backing_store_.length()) ExpandBuffer();
@@ -162,6 +180,7 @@ Scanner::Scanner(Utf16CharacterStream* source, bool is_module)
       found_html_comment_(false),
       allow_harmony_numeric_separator_(false),
       is_module_(is_module),
+      vectorize_(FLAG_vectorized_scanner),
       octal_pos_(Location::invalid()),
       octal_message_(MessageTemplate::kNone) {
   DCHECK_NOT_NULL(source);
@@ -510,6 +529,7 @@ Token::Value Scanner::ScanString() {
          !unibrow::IsStringLiteralLineTerminator(c0_)) ||
         !MayTerminateString(character_scan_flags[c0_])) {
       AddLiteralChar(c0_);
+      if (vectorize_) AddLiteralRun(scanner_simd::StringLiteralRun());
       AdvanceUntil([this](uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
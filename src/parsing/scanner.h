@@ -34,6 +34,11 @@ class Zone;
 // Buffered stream of UTF-16 code units, using an internal UTF-16 buffer.
 // A code unit is a 16 bit value representing either a 16 bit code point
 // or one part of a surrogate pair that make a single 21 bit code point.
+//
+// Streams over one-byte sources can instead scan the source characters in
+// place, without widening them into a UTF-16 buffer first. Such streams are
+// is_one_byte(), and use the one_byte_*_ buffer pointers instead of the
+// buffer_*_ ones.
 class Utf16CharacterStream {
  public:
   static const uc32 kEndOfInput = -1;
@@ -42,16 +47,20 @@ class Utf16CharacterStream {
 
   V8_INLINE void set_parser_error() {
     buffer_cursor_ = buffer_end_;
+    one_byte_cursor_ = one_byte_end_;
     has_parser_error_ = true;
   }
   V8_INLINE void reset_parser_error_flag() { has_parser_error_ = false; }
   V8_INLINE bool has_parser_error() const { return has_parser_error_; }
 
+  // Whether the stream scans a one-byte source in place.
+  bool is_one_byte() const { return is_one_byte_; }
+
   inline uc32 Peek() {
-    if (V8_LIKELY(buffer_cursor_ < buffer_end_)) {
-      return static_cast<uc32>(*buffer_cursor_);
+    if (V8_LIKELY(HasBufferedCodeUnit())) {
+      return CurrentCodeUnit();
     } else if (ReadBlockChecked()) {
-      return static_cast<uc32>(*buffer_cursor_);
+      return CurrentCodeUnit();
     } else {
       return kEndOfInput;
     }
@@ -61,7 +70,11 @@ class Utf16CharacterStream {
   // stream. If there are no more code units it returns kEndOfInput.
   inline uc32 Advance() {
     uc32 result = Peek();
-    buffer_cursor_++;
+    if (is_one_byte()) {
+      one_byte_cursor_++;
+    } else {
+      buffer_cursor_++;
+    }
     return result;
   }
 
@@ -70,23 +83,23 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE uc32 AdvanceUntil(FunctionType check) {
-    while (true) {
-      auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
-            uc32 c0_ = static_cast<uc32>(raw_c0_);
-            return check(c0_);
-          });
-
-      if (next_cursor_pos == buffer_end_) {
-        buffer_cursor_ = buffer_end_;
-        if (!ReadBlockChecked()) {
-          buffer_cursor_++;
-          return kEndOfInput;
-        }
-      } else {
-        buffer_cursor_ = next_cursor_pos + 1;
-        return static_cast<uc32>(*next_cursor_pos);
-      }
+    if (is_one_byte()) {
+      return AdvanceUntil(check, &one_byte_cursor_, &one_byte_end_);
+    }
+    return AdvanceUntil(check, &buffer_cursor_, &buffer_end_);
+  }
+
+  // Advances past the run of code units at the cursor that {find_end} skips,
+  // reading more blocks while the run extends to the end of the buffer.
+  // {find_end} maps a range of code units to the first one that ends the run,
+  // and {visit} is called with each piece of the run that was skipped. Both
+  // are called with one-byte characters if the stream is_one_byte().
+  template <typename FindEndFunction, typename VisitFunction>
+  V8_INLINE void AdvanceRun(FindEndFunction find_end, VisitFunction visit) {
+    if (is_one_byte()) {
+      AdvanceRun(find_end, visit, &one_byte_cursor_, &one_byte_end_);
+    } else {
+      AdvanceRun(find_end, visit, &buffer_cursor_, &buffer_end_);
     }
   }
 
@@ -96,21 +109,24 @@ class Utf16CharacterStream {
     // The common case - if the previous character is within
     // buffer_start_ .. buffer_end_ will be handles locally.
     // Otherwise, a new block is requested.
-    if (V8_LIKELY(buffer_cursor_ > buffer_start_)) {
+    if (is_one_byte()) {
+      if (V8_LIKELY(one_byte_cursor_ > one_byte_start_)) {
+        one_byte_cursor_--;
+        return;
+      }
+    } else if (V8_LIKELY(buffer_cursor_ > buffer_start_)) {
       buffer_cursor_--;
-    } else {
-      ReadBlockAt(pos() - 1);
+      return;
     }
+    ReadBlockAt(pos() - 1);
   }
 
-  inline size_t pos() const {
-    return buffer_pos_ + (buffer_cursor_ - buffer_start_);
-  }
+  inline size_t pos() const { return buffer_pos_ + cursor_offset(); }
 
   inline void Seek(size_t pos) {
     if (V8_LIKELY(pos >= buffer_pos_ &&
-                  pos < (buffer_pos_ + (buffer_end_ - buffer_start_)))) {
-      buffer_cursor_ = buffer_start_ + (pos - buffer_pos_);
+                  pos < (buffer_pos_ + buffer_length()))) {
+      set_cursor_offset(pos - buffer_pos_);
     } else {
       ReadBlockAt(pos);
     }
@@ -156,9 +172,8 @@ class Utf16CharacterStream {
     //                  2, Cursor should be inside the buffer.
     //                  3, We should have more characters available iff success.
     DCHECK_EQ(pos(), position);
-    DCHECK_LE(buffer_cursor_, buffer_end_);
-    DCHECK_LE(buffer_start_, buffer_cursor_);
-    DCHECK_EQ(success, buffer_cursor_ < buffer_end_);
+    DCHECK_LE(cursor_offset(), buffer_length());
+    DCHECK_EQ(success, cursor_offset() < buffer_length());
     return success;
   }
 
@@ -173,6 +188,7 @@ class Utf16CharacterStream {
     // Change pos() to point to new_pos.
     buffer_pos_ = new_pos;
     buffer_cursor_ = buffer_start_;
+    one_byte_cursor_ = one_byte_start_;
     DCHECK_EQ(pos(), new_pos);
     ReadBlockChecked();
   }
@@ -193,12 +209,106 @@ class Utf16CharacterStream {
   //   the start of the buffer.
   virtual bool ReadBlock() = 0;
 
+  // Points the buffer at the characters [start, end), with the cursor at
+  // {start}. Streams that scan a one-byte source in place use the one-byte
+  // overload.
+  void SetBuffer(const uint16_t* start, const uint16_t* end) {
+    DCHECK(!is_one_byte());
+    buffer_start_ = buffer_cursor_ = start;
+    buffer_end_ = end;
+  }
+  void SetBuffer(const uint8_t* start, const uint8_t* end) {
+    DCHECK(is_one_byte());
+    one_byte_start_ = one_byte_cursor_ = start;
+    one_byte_end_ = end;
+  }
+
+  // Moves the buffer to [start, end) while keeping the cursor at the same
+  // offset, for streams whose underlying characters were relocated.
+  template <typename Char>
+  void RelocateBuffer(const Char* start, const Char* end) {
+    size_t offset = cursor_offset();
+    SetBuffer(start, end);
+    set_cursor_offset(offset);
+  }
+
   const uint16_t* buffer_start_;
   const uint16_t* buffer_cursor_;
   const uint16_t* buffer_end_;
   size_t buffer_pos_;
   RuntimeCallStats* runtime_call_stats_;
   bool has_parser_error_ = false;
+
+  // Used instead of buffer_{start,cursor,end}_ if is_one_byte().
+  const uint8_t* one_byte_start_ = nullptr;
+  const uint8_t* one_byte_cursor_ = nullptr;
+  const uint8_t* one_byte_end_ = nullptr;
+  bool is_one_byte_ = false;
+
+ private:
+  V8_INLINE bool HasBufferedCodeUnit() const {
+    return is_one_byte() ? one_byte_cursor_ < one_byte_end_
+                         : buffer_cursor_ < buffer_end_;
+  }
+
+  V8_INLINE uc32 CurrentCodeUnit() const {
+    return is_one_byte() ? static_cast<uc32>(*one_byte_cursor_)
+                         : static_cast<uc32>(*buffer_cursor_);
+  }
+
+  V8_INLINE size_t cursor_offset() const {
+    return is_one_byte() ? one_byte_cursor_ - one_byte_start_
+                         : buffer_cursor_ - buffer_start_;
+  }
+
+  V8_INLINE void set_cursor_offset(size_t offset) {
+    if (is_one_byte()) {
+      one_byte_cursor_ = one_byte_start_ + offset;
+    } else {
+      buffer_cursor_ = buffer_start_ + offset;
+    }
+  }
+
+  V8_INLINE size_t buffer_length() const {
+    return is_one_byte() ? one_byte_end_ - one_byte_start_
+                         : buffer_end_ - buffer_start_;
+  }
+
+  template <typename FunctionType, typename Char>
+  V8_INLINE uc32 AdvanceUntil(FunctionType check, const Char** cursor,
+                              const Char* const* end) {
+    while (true) {
+      auto next_cursor_pos =
+          std::find_if(*cursor, *end, [&check](Char raw_c0_) {
+            uc32 c0_ = static_cast<uc32>(raw_c0_);
+            return check(c0_);
+          });
+
+      if (next_cursor_pos == *end) {
+        *cursor = *end;
+        if (!ReadBlockChecked()) {
+          (*cursor)++;
+          return kEndOfInput;
+        }
+      } else {
+        *cursor = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+    }
+  }
+
+  template <typename FindEndFunction, typename VisitFunction, typename Char>
+  V8_INLINE void AdvanceRun(FindEndFunction find_end, VisitFunction visit,
+                            const Char** cursor, const Char* const* end) {
+    while (true) {
+      const Char* run_start = *cursor;
+      *cursor = find_end(run_start, *end);
+      if (*cursor != run_start) {
+        visit(run_start, static_cast<int>(*cursor - run_start));
+      }
+      if (*cursor != *end || !ReadBlockChecked()) return;
+    }
+  }
 };
 
 // ----------------------------------------------------------------------------
@@ -428,6 +538,10 @@ class Scanner {
       AddOneByteChar(static_cast<byte>(code_unit));
     }
 
+    // Adds a run of ASCII characters.
+    template <typename Char>
+    void AddAsciiChars(const Char* chars, int length);
+
     V8_INLINE void AddChar(uc32 code_unit) {
       if (is_one_byte()) {
         if (code_unit <= static_cast<uc32>(unibrow::Latin1::kMaxChar)) {
@@ -601,6 +715,27 @@ class Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  // Vectorized fast path: advances past the run of ASCII characters following
+  // c0_ that {find_end} skips, and adds them to the literal. Leaves c0_ alone,
+  // so the caller continues with the character after the run.
+  template <typename FindEndFunction>
+  V8_INLINE void AddLiteralRun(FindEndFunction find_end) {
+    source_->AdvanceRun(find_end, LiteralRunVisitor(&next().literal_chars));
+  }
+
+  class LiteralRunVisitor {
+   public:
+    explicit LiteralRunVisitor(LiteralBuffer* literal) : literal_(literal) {}
+
+    template <typename Char>
+    V8_INLINE void operator()(const Char* chars, int length) const {
+      literal_->AddAsciiChars(chars, length);
+    }
+
+   private:
+    LiteralBuffer* literal_;
+  };
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -797,6 +932,9 @@ class Scanner {
 
   const bool is_module_;
 
+  // Whether to use the vectorized fast paths of the scanner.
+  const bool vectorize_;
+
   // Values parsed from magic comments.
   LiteralBuffer source_url_;
   LiteralBuffer source_mapping_url_;
@@ -275,6 +275,8 @@ class RootVisitor;
   V(WeakArrayList, detached_contexts, DetachedContexts)                    \
   V(WeakArrayList, retaining_path_targets, RetainingPathTargets)           \
   V(WeakArrayList, retained_maps, RetainedMaps)                            \
+  /* Preparse data kept by --flush-bytecode-keep-preparse-data */          \
+  V(EphemeronHashTable, kept_preparse_data, KeptPreparseData)              \
   /* Feedback vectors that we need for code coverage or type profile */    \
   V(Object, feedback_vectors_for_profiling_tools,                          \
     FeedbackVectorsForProfilingTools)                                      \
@@ -26,6 +26,11 @@ static const int kProfilerTicksBeforeOptimization = 2;
 // kProfilerTicksBeforeOptimization required for any function.
 static const int kBytecodeSizeAllowancePerTick = 1200;
 
+// Every deopt of a function delays its reoptimization by another tick, up to
+// this many ticks, so that functions stuck in a deopt loop are reoptimized
+// with more (and more stable) feedback.
+static const int kMaxDeoptBackoffTicks = 8;
+
 // Maximum size in bytes of generate code for a function to allow OSR.
 static const int kOSRBytecodeSizeAllowanceBase = 180;
 
@@ -184,6 +189,12 @@ bool RuntimeProfiler::MaybeOSR(JSFunction function, InterpretedFrame* frame) {
   return false;
 }
 
+// static
+int RuntimeProfiler::TicksForOptimization(BytecodeArray bytecode) {
+  return kProfilerTicksBeforeOptimization +
+         (bytecode->length() / kBytecodeSizeAllowancePerTick);
+}
+
 OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
                                                    BytecodeArray bytecode) {
   int ticks = function->feedback_vector()->profiler_ticks();
@@ -191,12 +202,12 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
     return OptimizationReason::kDoNotOptimize;
   }
 
+  int deopt_count = function->feedback_vector()->deopt_count();
   int ticks_for_optimization =
-      kProfilerTicksBeforeOptimization +
-      (bytecode->length() / kBytecodeSizeAllowancePerTick);
+      TicksForOptimization(bytecode) + Min(deopt_count, kMaxDeoptBackoffTicks);
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
-  } else if (!any_ic_changed_ &&
+  } else if (!any_ic_changed_ && deopt_count == 0 &&
              bytecode->length() < kMaxBytecodeSizeForEarlyOpt) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
@@ -204,10 +215,11 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
   } else if (FLAG_trace_opt_verbose) {
     PrintF("[not yet optimizing ");
     function->PrintName();
-    PrintF(", not enough ticks: %d/%d and ", ticks,
-           kProfilerTicksBeforeOptimization);
+    PrintF(", not enough ticks: %d/%d and ", ticks, ticks_for_optimization);
     if (any_ic_changed_) {
       PrintF("ICs changed]\n");
+    } else if (deopt_count > 0) {
+      PrintF("deoptimized %d times]\n", deopt_count);
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
              bytecode->length(), kMaxBytecodeSizeForEarlyOpt);
@@ -242,7 +242,46 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
   DCHECK(!ast_id.IsNone());
 
   MaybeHandle<Code> maybe_result;
-  if (IsSuitableForOnStackReplacement(isolate, function)) {
+  if (FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled()) {
+    OptimizingCompileDispatcher* dispatcher =
+        isolate->optimizing_compile_dispatcher();
+    OptimizedCompilationJob* job =
+        dispatcher->FindReadyOSRCandidate(function, ast_id);
+    // Disarming the back edges above also disarmed them for finished jobs
+    // of other loops in this function.
+    dispatcher->ArmReadyOSRCandidates();
+    if (job != nullptr) {
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Found ready job of ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", ast_id.ToInt());
+      }
+      maybe_result =
+          Compiler::FinalizeOptimizedCompilationJobForOSR(job, isolate);
+    } else if (dispatcher->IsQueuedForOSR(function, ast_id)) {
+      // The job is still running; keep interpreting until it is done and
+      // the back edges are re-armed by the dispatcher.
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Still waiting for job of ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", ast_id.ToInt());
+      }
+      return Object();
+    } else if (IsSuitableForOnStackReplacement(isolate, function) &&
+               dispatcher->IsQueueAvailable()) {
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Queueing concurrent compilation of ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", ast_id.ToInt());
+      }
+      maybe_result = Compiler::GetOptimizedCodeForOSR(
+          function, ast_id, frame, ConcurrencyMode::kConcurrent);
+      if (maybe_result.is_null() &&
+          dispatcher->IsQueuedForOSR(function, ast_id)) {
+        return Object();
+      }
+    }
+  } else if (IsSuitableForOnStackReplacement(isolate, function)) {
     if (FLAG_trace_osr) {
       PrintF("[OSR - Compiling: ");
       function->PrintName();
@@ -257,6 +257,24 @@ RUNTIME_FUNCTION(Runtime_Interrupt) {
   return isolate->stack_guard()->HandleInterrupts();
 }
 
+RUNTIME_FUNCTION(Runtime_BytecodeBudgetInterrupt) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  // With --lazy-feedback-allocation the first budget interrupt of a function
+  // allocates its feedback vector.
+  if (!function->has_feedback_vector()) {
+    JSFunction::EnsureFeedbackVector(function);
+    // Also initialize the invocation count here. This is only really needed
+    // for OSR. When we OSR functions with lazy feedback allocation we want to
+    // have a non zero invocation count so we can inline functions.
+    if (function->has_feedback_vector()) {
+      function->feedback_vector()->set_invocation_count(1);
+    }
+  }
+  return isolate->stack_guard()->HandleInterrupts();
+}
+
 RUNTIME_FUNCTION(Runtime_AllocateInNewSpace) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
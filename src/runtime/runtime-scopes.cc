@@ -924,7 +924,12 @@ MaybeHandle<Object> StoreLookupSlot(
                       Object);
     }
     if ((attributes & READ_ONLY) == 0) {
-      Handle<Context>::cast(holder)->set(index, *value);
+      Handle<Context> context = Handle<Context>::cast(holder);
+      if (context->IsScriptContext()) {
+        Context::StoreScriptContextSlot(isolate, context, index, value);
+      } else {
+        context->set(index, *value);
+      }
     } else if (!is_sloppy_function_name || is_strict(language_mode)) {
       THROW_NEW_ERROR(
           isolate, NewTypeError(MessageTemplate::kConstAssign, name), Object);
@@ -449,6 +449,43 @@ RUNTIME_FUNCTION(Runtime_GetDeoptCount) {
   return Smi::FromInt(function->feedback_vector()->deopt_count());
 }
 
+// Returns the deopt history of {function} as an array of
+// [bytecode offset, reason, kind, count] entries.
+RUNTIME_FUNCTION(Runtime_GetDeoptHistory) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  Factory* factory = isolate->factory();
+  if (!function->has_feedback_vector() ||
+      !function->feedback_vector()->deopt_history()->IsFixedArray()) {
+    return *factory->NewJSArray(0);
+  }
+  Handle<FixedArray> history(
+      FixedArray::cast(function->feedback_vector()->deopt_history()), isolate);
+  int entry_count = history->length() / FeedbackVector::kDeoptHistoryEntrySize;
+  Handle<FixedArray> result = factory->NewFixedArray(entry_count);
+  for (int i = 0; i < entry_count; ++i) {
+    int base = i * FeedbackVector::kDeoptHistoryEntrySize;
+    auto reason = static_cast<DeoptimizeReason>(Smi::ToInt(
+        history->get(base + FeedbackVector::kDeoptHistoryReasonIndex)));
+    auto kind = static_cast<DeoptimizeKind>(Smi::ToInt(
+        history->get(base + FeedbackVector::kDeoptHistoryKindIndex)));
+    Handle<FixedArray> entry = factory->NewFixedArray(4);
+    entry->set(0, history->get(
+                      base + FeedbackVector::kDeoptHistoryBytecodeOffsetIndex));
+    Handle<String> reason_string =
+        factory->NewStringFromAsciiChecked(DeoptimizeReasonToString(reason));
+    entry->set(1, *reason_string);
+    Handle<String> kind_string =
+        factory->NewStringFromAsciiChecked(Deoptimizer::MessageFor(kind));
+    entry->set(2, *kind_string);
+    entry->set(3, history->get(base + FeedbackVector::kDeoptHistoryCountIndex));
+    Handle<JSArray> entry_array = factory->NewJSArrayWithElements(entry);
+    result->set(i, *entry_array);
+  }
+  return *factory->NewJSArrayWithElements(result);
+}
+
 static void ReturnThis(const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().Set(args.This());
 }
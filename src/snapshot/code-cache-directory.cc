@@ -0,0 +1,319 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/code-cache-directory.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
+#include "src/base/functional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
+#include "src/counters.h"
+#include "src/flags.h"
+#include "src/global-handles.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/v8.h"
+#include "src/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Hash of the characters of {string}, which unlike the string hash does not
+// depend on the per-process hash seed.
+size_t ContentHash(String string) {
+  DisallowHeapAllocation no_gc;
+  size_t hash = base::hash_value(string->length());
+  StringCharacterStream stream(string);
+  while (stream.HasMore()) hash = base::hash_combine(hash, stream.GetNext());
+  return hash;
+}
+
+// Every file starts with the length of the script source, whether it is
+// one-byte, and its characters, padded so that the serialized code that
+// follows stays pointer aligned. The file name only holds a hash of the
+// source, so Lookup compares the full source before it deserializes.
+const size_t kSourceLengthOffset = 0;
+const size_t kSourceIsOneByteOffset = kSourceLengthOffset + kUInt32Size;
+const size_t kSourceCharsOffset = kSourceIsOneByteOffset + kUInt32Size;
+
+std::vector<byte> SourceHeader(Isolate* isolate, Handle<String> source) {
+  source = String::Flatten(isolate, source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  uint32_t length = static_cast<uint32_t>(source->length());
+  uint32_t is_one_byte = content.IsOneByte() ? 1 : 0;
+  size_t chars_size = length * (is_one_byte ? kCharSize : kUC16Size);
+  std::vector<byte> header(
+      RoundUp(kSourceCharsOffset + chars_size, kPointerAlignment), 0);
+  memcpy(&header[kSourceLengthOffset], &length, kUInt32Size);
+  memcpy(&header[kSourceIsOneByteOffset], &is_one_byte, kUInt32Size);
+  if (is_one_byte) {
+    memcpy(&header[kSourceCharsOffset], content.ToOneByteVector().start(),
+           chars_size);
+  } else {
+    memcpy(&header[kSourceCharsOffset], content.ToUC16Vector().start(),
+           chars_size);
+  }
+  return header;
+}
+
+// Returns the size of the header of the file in {data} if the file was
+// written for {source}, and 0 otherwise.
+size_t MatchSourceHeader(Isolate* isolate, const byte* data, size_t size,
+                         Handle<String> source) {
+  if (size < kSourceCharsOffset) return 0;
+  uint32_t length;
+  uint32_t is_one_byte;
+  memcpy(&length, data + kSourceLengthOffset, kUInt32Size);
+  memcpy(&is_one_byte, data + kSourceIsOneByteOffset, kUInt32Size);
+  if (length != static_cast<uint32_t>(source->length())) return 0;
+  size_t chars_size = length * (is_one_byte ? kCharSize : kUC16Size);
+  size_t header_size =
+      RoundUp(kSourceCharsOffset + chars_size, kPointerAlignment);
+  if (header_size >= size) return 0;
+
+  source = String::Flatten(isolate, source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  const byte* chars = data + kSourceCharsOffset;
+  for (uint32_t i = 0; i < length; i++) {
+    uc16 c;
+    if (is_one_byte) {
+      c = chars[i];
+    } else {
+      memcpy(&c, chars + i * kUC16Size, kUC16Size);
+    }
+    if (c != content.Get(static_cast<int>(i))) return 0;
+  }
+  return header_size;
+}
+
+// Writes {header} and {data} to a temporary file next to {file_name} and
+// renames it, so that other processes map either the previous file or the
+// complete new one.
+void WriteFile(const std::string& file_name, const std::vector<byte>& header,
+               const ScriptCompiler::CachedData* data) {
+  static std::atomic<int> next_id(0);
+  std::string temp_name = file_name + "." +
+                          std::to_string(base::OS::GetCurrentProcessId()) +
+                          "-" + std::to_string(next_id++) + ".tmp";
+  FILE* file = base::OS::FOpen(temp_name.c_str(), "wb");
+  if (file == nullptr) return;
+  size_t length = static_cast<size_t>(data->length);
+  bool success =
+      fwrite(header.data(), 1, header.size(), file) == header.size() &&
+      fwrite(data->data, 1, length, file) == length;
+  success = fclose(file) == 0 && success;
+  if (!success || std::rename(temp_name.c_str(), file_name.c_str()) != 0) {
+    base::OS::Remove(temp_name.c_str());
+  }
+}
+
+}  // namespace
+
+// Counts the files that are being written, so that the directory can wait
+// for them before the process exits.
+class CodeCacheDirectory::Writes {
+ public:
+  void Start() {
+    base::MutexGuard guard(&mutex_);
+    count_++;
+  }
+
+  void Finish() {
+    base::MutexGuard guard(&mutex_);
+    if (--count_ == 0) done_.NotifyAll();
+  }
+
+  void Wait() {
+    base::MutexGuard guard(&mutex_);
+    while (count_ > 0) done_.Wait(&mutex_);
+  }
+
+ private:
+  base::Mutex mutex_;
+  base::ConditionVariable done_;
+  int count_ = 0;
+};
+
+class CodeCacheDirectory::FlushTask : public CancelableTask {
+ public:
+  FlushTask(Isolate* isolate, CodeCacheDirectory* directory)
+      : CancelableTask(isolate), directory_(directory) {}
+
+ private:
+  void RunInternal() override {
+    directory_->flush_task_pending_ = false;
+    directory_->Flush();
+  }
+
+  CodeCacheDirectory* directory_;
+
+  DISALLOW_COPY_AND_ASSIGN(FlushTask);
+};
+
+class CodeCacheDirectory::WriteTask : public Task {
+ public:
+  WriteTask(std::shared_ptr<Writes> writes, const std::string& file_name,
+            std::vector<byte> header,
+            std::unique_ptr<ScriptCompiler::CachedData> data)
+      : writes_(std::move(writes)),
+        file_name_(file_name),
+        header_(std::move(header)),
+        data_(std::move(data)) {}
+
+  void Run() override {
+    WriteFile(file_name_, header_, data_.get());
+    writes_->Finish();
+  }
+
+ private:
+  std::shared_ptr<Writes> writes_;
+  std::string file_name_;
+  std::vector<byte> header_;
+  std::unique_ptr<ScriptCompiler::CachedData> data_;
+
+  DISALLOW_COPY_AND_ASSIGN(WriteTask);
+};
+
+CodeCacheDirectory::CodeCacheDirectory(Isolate* isolate, const char* path)
+    : isolate_(isolate),
+      path_(path),
+      taskrunner_(V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+          reinterpret_cast<v8::Isolate*>(isolate))),
+      writes_in_flight_(std::make_shared<Writes>()) {}
+
+CodeCacheDirectory::~CodeCacheDirectory() {
+  if (flush_task_pending_) {
+    isolate_->cancelable_task_manager()->TryAbort(flush_task_id_);
+  }
+  for (const std::unique_ptr<Pending>& pending : pending_) {
+    if (pending->location != nullptr) GlobalHandles::Destroy(pending->location);
+  }
+  WaitForPendingWrites();
+}
+
+std::string CodeCacheDirectory::FileNameFor(
+    Handle<String> source, const Compiler::ScriptDetails& script_details,
+    ScriptOriginOptions origin_options) const {
+  size_t origin_hash = base::hash_combine(
+      FlagList::Hash(), Version::Hash(), script_details.line_offset,
+      script_details.column_offset, origin_options.Flags());
+  Handle<Object> name;
+  if (script_details.name_obj.ToHandle(&name) && name->IsString()) {
+    origin_hash = base::hash_combine(origin_hash,
+                                     ContentHash(String::cast(*name)));
+  }
+  char file_name[64];
+  SNPrintF(ArrayVector(file_name), "/%" V8PRIxPTR "-%" V8PRIxPTR ".v8cache",
+           static_cast<uintptr_t>(ContentHash(*source)),
+           static_cast<uintptr_t>(origin_hash));
+  return path_ + file_name;
+}
+
+MaybeHandle<SharedFunctionInfo> CodeCacheDirectory::Lookup(
+    const std::string& file_name, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          file_name.c_str(),
+          base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file || file->size() == 0 ||
+      file->size() > static_cast<size_t>(kMaxInt)) {
+    misses_++;
+    isolate_->counters()->code_cache_directory_misses()->Increment();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  const byte* data = static_cast<const byte*>(file->memory());
+  size_t header_size = MatchSourceHeader(isolate_, data, file->size(), source);
+  if (header_size == 0) {
+    // The file is corrupt or belongs to a different script with the same
+    // source hash.
+    rejects_++;
+    isolate_->counters()->code_cache_directory_rejects()->Increment();
+    base::OS::Remove(file_name.c_str());
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  // The mapping is page aligned and the header keeps pointer alignment, so
+  // the deserializer reads the file in place instead of copying it.
+  ScriptData script_data(data + header_size,
+                         static_cast<int>(file->size() - header_size));
+  MaybeHandle<SharedFunctionInfo> result = CodeSerializer::Deserialize(
+      isolate_, &script_data, source, origin_options);
+  if (result.is_null()) {
+    rejects_++;
+    isolate_->counters()->code_cache_directory_rejects()->Increment();
+    if (script_data.rejected()) base::OS::Remove(file_name.c_str());
+    return result;
+  }
+  hits_++;
+  isolate_->counters()->code_cache_directory_hits()->Increment();
+  return result;
+}
+
+void CodeCacheDirectory::Add(const std::string& file_name,
+                             Handle<SharedFunctionInfo> toplevel) {
+  std::unique_ptr<Pending> pending(new Pending());
+  pending->file_name = file_name;
+  pending->location = isolate_->global_handles()->Create(*toplevel).location();
+  GlobalHandles::MakeWeak(&pending->location);
+  pending_.push_back(std::move(pending));
+
+  if (!flush_task_pending_) {
+    std::unique_ptr<FlushTask> task =
+        base::make_unique<FlushTask>(isolate_, this);
+    flush_task_pending_ = true;
+    flush_task_id_ = task->id();
+    taskrunner_->PostDelayedTask(std::move(task),
+                                 FLAG_code_cache_dir_warmup_delay);
+  }
+}
+
+void CodeCacheDirectory::Flush() {
+  if (flush_task_pending_) {
+    isolate_->cancelable_task_manager()->TryAbort(flush_task_id_);
+    flush_task_pending_ = false;
+  }
+
+  HandleScope scope(isolate_);
+  for (const std::unique_ptr<Pending>& pending : pending_) {
+    // The function died before the warm-up delay ended.
+    if (pending->location == nullptr) continue;
+    Handle<SharedFunctionInfo> toplevel(
+        SharedFunctionInfo::cast(Object(*pending->location)), isolate_);
+    GlobalHandles::Destroy(pending->location);
+    std::unique_ptr<ScriptCompiler::CachedData> data(
+        CodeSerializer::Serialize(toplevel));
+    if (!data) continue;
+    Handle<String> source(
+        String::cast(Script::cast(toplevel->script())->source()), isolate_);
+
+    writes_++;
+    isolate_->counters()->code_cache_directory_writes()->Increment();
+    writes_in_flight_->Start();
+    std::unique_ptr<WriteTask> task = base::make_unique<WriteTask>(
+        writes_in_flight_, pending->file_name,
+        SourceHeader(isolate_, source), std::move(data));
+    if (FLAG_single_threaded) {
+      task->Run();
+    } else {
+      V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    }
+  }
+  pending_.clear();
+}
+
+void CodeCacheDirectory::WaitForPendingWrites() { writes_in_flight_->Wait(); }
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,102 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
+#define V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/cancelable-task.h"
+#include "src/compiler.h"
+#include "src/globals.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class SharedFunctionInfo;
+class String;
+
+// A code cache that V8 keeps on disk by itself, for embedders that do not
+// manage code caches. Every script gets a file in the directory given by
+// --code-cache-dir, named after a seed-independent hash of its source and a
+// hash of its origin, the V8 version and the flags. The file starts with the
+// full source, which is compared before deserializing. Compiling a script
+// first maps its file into memory, read-only, and deserializes it. On a miss
+// the script is compiled as usual and remembered, and
+// --code-cache-dir-warmup-delay seconds later its code is serialized, so that
+// the cache includes the functions that were lazily compiled in the meantime. Serializing walks the heap and
+// runs on the main thread, but the file is written on a worker thread and
+// moved into place once complete, so that other processes never map a
+// partial file.
+class CodeCacheDirectory {
+ public:
+  CodeCacheDirectory(Isolate* isolate, const char* path);
+  // Waits for the files that are being written.
+  ~CodeCacheDirectory();
+
+  // The name of the file for the script with {source} and the given origin.
+  std::string FileNameFor(Handle<String> source,
+                          const Compiler::ScriptDetails& script_details,
+                          ScriptOriginOptions origin_options) const;
+
+  // Returns the code for the script with {source} from {file_name}, or an
+  // empty handle if there is no such file, the file holds a different source
+  // or it was produced by a different V8 version or with different flags.
+  // Files that are rejected are removed.
+  MaybeHandle<SharedFunctionInfo> Lookup(const std::string& file_name,
+                                         Handle<String> source,
+                                         ScriptOriginOptions origin_options);
+
+  // Remembers the freshly compiled {toplevel} function of a script for which
+  // Lookup failed, and writes its code to {file_name} after the warm-up
+  // delay unless the function dies before.
+  void Add(const std::string& file_name, Handle<SharedFunctionInfo> toplevel);
+
+  // Serializes the code of all remembered scripts right away, and starts
+  // writing their files. Called at the end of the warm-up delay and when
+  // the isolate is torn down.
+  void Flush();
+
+  // Waits until all files started by Flush are written.
+  void WaitForPendingWrites();
+
+  int hits() const { return hits_; }
+  int misses() const { return misses_; }
+  int rejects() const { return rejects_; }
+  int writes() const { return writes_; }
+
+ private:
+  class FlushTask;
+  class WriteTask;
+  class Writes;
+
+  struct Pending {
+    std::string file_name;
+    // A weak global handle to the toplevel function, which is reset when
+    // the function dies.
+    Address* location;
+  };
+
+  Isolate* isolate_;
+  std::string path_;
+  std::shared_ptr<v8::TaskRunner> taskrunner_;
+  std::vector<std::unique_ptr<Pending>> pending_;
+  bool flush_task_pending_ = false;
+  CancelableTaskManager::Id flush_task_id_;
+  std::shared_ptr<Writes> writes_in_flight_;
+  int hits_ = 0;
+  int misses_ = 0;
+  int rejects_ = 0;
+  int writes_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(CodeCacheDirectory);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_CODE_CACHE_DIRECTORY_H_
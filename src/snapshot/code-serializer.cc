@@ -233,6 +233,53 @@ void CodeSerializer::SerializeGeneric(HeapObject heap_object,
   serializer.Serialize();
 }
 
+namespace {
+
+// Logs the functions of the freshly deserialized {result}, and prepares its
+// script for profiling.
+void FinalizeDeserialization(Isolate* isolate,
+                             Handle<SharedFunctionInfo> result,
+                             const base::ElapsedTimer& timer) {
+  bool log_code_creation =
+      isolate->logger()->is_listening_to_code_events() ||
+      isolate->is_profiling() ||
+      isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+  if (log_code_creation || FLAG_log_function_events) {
+    String name = ReadOnlyRoots(isolate).empty_string();
+    Script script = Script::cast(result->script());
+    Handle<Script> script_handle(script, isolate);
+    if (script->name()->IsString()) name = String::cast(script->name());
+    if (FLAG_log_function_events) {
+      LOG(isolate,
+          FunctionEvent("deserialize", script->id(),
+                        timer.Elapsed().InMillisecondsF(),
+                        result->StartPosition(), result->EndPosition(), name));
+    }
+    if (log_code_creation) {
+      Script::InitLineEnds(Handle<Script>(script, isolate));
+      DisallowHeapAllocation no_gc;
+      SharedFunctionInfo::ScriptIterator iter(isolate, script);
+      for (i::SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (info->is_compiled()) {
+          int line_num = script->GetLineNumber(info->StartPosition()) + 1;
+          int column_num = script->GetColumnNumber(info->StartPosition()) + 1;
+          PROFILE(isolate, CodeCreateEvent(CodeEventListener::SCRIPT_TAG,
+                                           info->abstract_code(), info, name,
+                                           line_num, column_num));
+        }
+      }
+    }
+  }
+
+  if (isolate->NeedsSourcePositionsForProfiling()) {
+    Handle<Script> script(Script::cast(result->script()), isolate);
+    Script::InitLineEnds(script);
+  }
+}
+
+}  // namespace
+
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     Isolate* isolate, ScriptData* cached_data, Handle<String> source,
     ScriptOriginOptions origin_options) {
@@ -272,46 +319,99 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
   }
 
-  bool log_code_creation =
-      isolate->logger()->is_listening_to_code_events() ||
-      isolate->is_profiling() ||
-      isolate->code_event_dispatcher()->IsListeningToCodeEvents();
-  if (log_code_creation || FLAG_log_function_events) {
-    String name = ReadOnlyRoots(isolate).empty_string();
-    Script script = Script::cast(result->script());
-    Handle<Script> script_handle(script, isolate);
-    if (script->name()->IsString()) name = String::cast(script->name());
-    if (FLAG_log_function_events) {
-      LOG(isolate,
-          FunctionEvent("deserialize", script->id(),
-                        timer.Elapsed().InMillisecondsF(),
-                        result->StartPosition(), result->EndPosition(), name));
-    }
-    if (log_code_creation) {
-      Script::InitLineEnds(Handle<Script>(script, isolate));
-      DisallowHeapAllocation no_gc;
-      SharedFunctionInfo::ScriptIterator iter(isolate, script);
-      for (i::SharedFunctionInfo info = iter.Next(); !info.is_null();
-           info = iter.Next()) {
-        if (info->is_compiled()) {
-          int line_num = script->GetLineNumber(info->StartPosition()) + 1;
-          int column_num = script->GetColumnNumber(info->StartPosition()) + 1;
-          PROFILE(isolate, CodeCreateEvent(CodeEventListener::SCRIPT_TAG,
-                                           info->abstract_code(), info, name,
-                                           line_num, column_num));
-        }
-      }
-    }
+  FinalizeDeserialization(isolate, result, timer);
+  return scope.CloseAndEscape(result);
+}
+
+CodeCacheValidationTask::CodeCacheValidationTask(
+    Isolate* isolate, const ScriptCompiler::CachedData* cached_data)
+    : cached_data_(cached_data),
+      timer_(isolate->counters()->compile_validate_code_cache_on_background()),
+      worker_thread_runtime_call_stats_(
+          isolate->counters()->worker_thread_runtime_call_stats()) {}
+
+CodeCacheValidationTask::~CodeCacheValidationTask() = default;
+
+void CodeCacheValidationTask::Run() {
+  DCHECK(!script_data_);
+  TimedHistogramScope timer(timer_);
+  WorkerThreadRuntimeCallStatsScope runtime_call_stats_scope(
+      worker_thread_runtime_call_stats_);
+  RuntimeCallTimerScope runtimeTimer(
+      runtime_call_stats_scope.Get(),
+      RuntimeCallCounterId::kCompileBackgroundValidateCodeCache);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileValidateCodeCacheBackground");
+  base::ElapsedTimer elapsed;
+  elapsed.Start();
+  Validate();
+  background_time_ = elapsed.Elapsed();
+}
+
+void CodeCacheValidationTask::Validate() {
+  // ScriptData takes care of pointer-aligning the data.
+  script_data_.reset(new ScriptData(cached_data_->data, cached_data_->length));
+  const SerializedCodeData scd =
+      SerializedCodeData::FromCachedDataWithoutSource(script_data_.get(),
+                                                      &sanity_check_result_);
+  if (sanity_check_result_ == SerializedCodeData::CHECK_SUCCESS) {
+    deserializer_.reset(new ObjectDeserializer(&scd));
   }
+}
 
-  if (isolate->NeedsSourcePositionsForProfiling()) {
-    Handle<Script> script(Script::cast(result->script()), isolate);
-    Script::InitLineEnds(script);
+MaybeHandle<SharedFunctionInfo> CodeCacheValidationTask::Finish(
+    Isolate* isolate, Handle<String> source,
+    ScriptOriginOptions origin_options) {
+  if (finished_) {
+    if (FLAG_profile_deserialization) PrintF("[Cached code already used]\n");
+    script_data_->Reject();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  finished_ = true;
+
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization || FLAG_log_function_events) timer.Start();
+  // The embedder may pass the task without running it, in which case the
+  // validation is part of the main thread's work.
+  if (!script_data_) Validate();
+
+  HandleScope scope(isolate);
+  if (sanity_check_result_ == SerializedCodeData::CHECK_SUCCESS) {
+    SerializedCodeData::FromPartiallySanityCheckedCachedData(
+        script_data_.get(),
+        SerializedCodeData::SourceHash(source, origin_options),
+        &sanity_check_result_);
+  }
+  if (sanity_check_result_ != SerializedCodeData::CHECK_SUCCESS) {
+    if (FLAG_profile_deserialization) PrintF("[Cached code failed check]\n");
+    DCHECK(script_data_->rejected());
+    isolate->counters()->code_cache_reject_reason()->AddSample(
+        sanity_check_result_);
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  MaybeHandle<SharedFunctionInfo> maybe_result =
+      deserializer_->DeserializeSharedFunctionInfo(isolate, source);
+  deserializer_.reset();
+  Handle<SharedFunctionInfo> result;
+  if (!maybe_result.ToHandle(&result)) {
+    // Deserializing may fail if the reservations cannot be fulfilled.
+    if (FLAG_profile_deserialization) PrintF("[Deserializing failed]\n");
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF(
+        "[Deserializing from %d bytes took %0.3f ms on the main thread, "
+        "validating it took %0.3f ms in the background]\n",
+        cached_data_->length, ms, background_time_.InMillisecondsF());
   }
+
+  FinalizeDeserialization(isolate, result, timer);
   return scope.CloseAndEscape(result);
 }
 
-
 SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
                                        const CodeSerializer* cs) {
   DisallowHeapAllocation no_gc;
@@ -364,18 +464,30 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     Isolate* isolate, uint32_t expected_source_hash) const {
+  SanityCheckResult result = SanityCheckWithoutSource();
+  if (result != CHECK_SUCCESS) return result;
+  return SanityCheckJustSource(expected_source_hash);
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckJustSource(uint32_t expected_source_hash) const {
+  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
+  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
+  return CHECK_SUCCESS;
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutSource() const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != kMagicNumber) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
-  uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   uint32_t cpu_features = GetHeaderValue(kCpuFeaturesOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
   uint32_t c1 = GetHeaderValue(kChecksumPartAOffset);
   uint32_t c2 = GetHeaderValue(kChecksumPartBOffset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (cpu_features != static_cast<uint32_t>(CpuFeatures::SupportedFeatures())) {
     return CPU_FEATURES_MISMATCH;
   }
@@ -446,5 +558,31 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+SerializedCodeData SerializedCodeData::FromCachedDataWithoutSource(
+    ScriptData* cached_data, SanityCheckResult* rejection_result) {
+  DisallowHeapAllocation no_gc;
+  SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheckWithoutSource();
+  if (*rejection_result != CHECK_SUCCESS) {
+    cached_data->Reject();
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
+SerializedCodeData SerializedCodeData::FromPartiallySanityCheckedCachedData(
+    ScriptData* cached_data, uint32_t expected_source_hash,
+    SanityCheckResult* rejection_result) {
+  DisallowHeapAllocation no_gc;
+  // The rest of the data was checked by FromCachedDataWithoutSource.
+  SerializedCodeData scd(cached_data);
+  *rejection_result = scd.SanityCheckJustSource(expected_source_hash);
+  if (*rejection_result != CHECK_SUCCESS) {
+    cached_data->Reject();
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
 }  // namespace internal
 }  // namespace v8
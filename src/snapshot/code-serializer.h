@@ -5,11 +5,18 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <memory>
+
+#include "src/base/platform/time.h"
 #include "src/snapshot/serializer.h"
 
 namespace v8 {
 namespace internal {
 
+class ObjectDeserializer;
+class TimedHistogram;
+class WorkerThreadRuntimeCallStats;
+
 class ScriptData {
  public:
   ScriptData(const byte* data, int length);
@@ -127,6 +134,13 @@ class SerializedCodeData : public SerializedData {
                                            ScriptData* cached_data,
                                            uint32_t expected_source_hash,
                                            SanityCheckResult* rejection_result);
+  // Like FromCachedData, but split in two for consuming the data on a
+  // background thread, where the source is not available.
+  static SerializedCodeData FromCachedDataWithoutSource(
+      ScriptData* cached_data, SanityCheckResult* rejection_result);
+  static SerializedCodeData FromPartiallySanityCheckedCachedData(
+      ScriptData* cached_data, uint32_t expected_source_hash,
+      SanityCheckResult* rejection_result);
 
   // Used when producing.
   SerializedCodeData(const std::vector<byte>* payload,
@@ -152,6 +166,52 @@ class SerializedCodeData : public SerializedData {
 
   SanityCheckResult SanityCheck(Isolate* isolate,
                                 uint32_t expected_source_hash) const;
+  SanityCheckResult SanityCheckWithoutSource() const;
+  SanityCheckResult SanityCheckJustSource(uint32_t expected_source_hash) const;
+};
+
+// Consumes a code cache in two steps. Run validates the data: it checks that
+// the data is intact and was produced by this V8 version with the same flags,
+// and decodes its space reservations. None of this touches the heap, so it can
+// run on a background thread. Finish then checks the data against the source,
+// and does the actual deserialization on the main thread: it deserializes the
+// objects into the reserved space, internalizes their strings and registers
+// their scripts.
+class V8_EXPORT_PRIVATE CodeCacheValidationTask {
+ public:
+  // {cached_data} must stay alive until Finish returns.
+  CodeCacheValidationTask(Isolate* isolate,
+                          const ScriptCompiler::CachedData* cached_data);
+  ~CodeCacheValidationTask();
+
+  // Validates the data on a background thread.
+  void Run();
+
+  // Runs the remaining steps on the main thread, including the validation if
+  // Run did not run before. The deserializer is used up by the first call, so
+  // later calls reject the data.
+  MaybeHandle<SharedFunctionInfo> Finish(Isolate* isolate,
+                                         Handle<String> source,
+                                         ScriptOriginOptions origin_options);
+
+  const ScriptCompiler::CachedData* cached_data() const { return cached_data_; }
+  bool rejected() const { return script_data_ && script_data_->rejected(); }
+
+ private:
+  void Validate();
+
+  const ScriptCompiler::CachedData* cached_data_;
+  std::unique_ptr<ScriptData> script_data_;
+  SerializedCodeData::SanityCheckResult sanity_check_result_ =
+      SerializedCodeData::CHECK_SUCCESS;
+  std::unique_ptr<ObjectDeserializer> deserializer_;
+  bool finished_ = false;
+  // Time spent in Run, i.e. saved on the main thread.
+  base::TimeDelta background_time_;
+  TimedHistogram* timer_;
+  WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats_;
+
+  DISALLOW_COPY_AND_ASSIGN(CodeCacheValidationTask);
 };
 
 }  // namespace internal
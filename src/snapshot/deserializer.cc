@@ -321,7 +321,7 @@ HeapObject Deserializer::PostProcessNewObject(HeapObject obj, int space) {
     // fields in the serializer.
     BytecodeArray bytecode_array = BytecodeArray::cast(obj);
     bytecode_array->set_interrupt_budget(
-        interpreter::Interpreter::InterruptBudget());
+        interpreter::Interpreter::InitialInterruptBudget());
     bytecode_array->set_osr_loop_nesting_level(0);
   } else if (obj->IsDescriptorArray()) {
     // Reset the marking state of the descriptor array.
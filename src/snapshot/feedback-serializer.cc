@@ -0,0 +1,362 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/feedback-serializer.h"
+
+#include "src/feedback-vector-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/runtime-profiler.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/version.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The data header consists of uint32_t-sized entries:
+// [0] magic number
+// [1] version hash
+// [2] flag hash
+// [3] payload length
+// [4] payload checksum part A
+// [5] payload checksum part B
+// ...  serialized payload
+//
+// The payload is a sequence of uint32_t-sized function entries:
+// [0] script source hash
+// [1] start position
+// [2] end position
+// [3] feedback slot count
+// [4] whether the function got optimized
+// [5] profiler ticks
+// [6] deoptimization count
+// [7] number of hints
+// ...  hints, each consisting of slot index, slot kind and Smi value
+class SerializedFeedbackData : public SerializedData {
+ public:
+  static const uint32_t kFeedbackMagicNumber = 0xFEED0000;
+  static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
+  static const uint32_t kFlagHashOffset = kVersionHashOffset + kUInt32Size;
+  static const uint32_t kPayloadLengthOffset = kFlagHashOffset + kUInt32Size;
+  static const uint32_t kChecksumPartAOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kChecksumPartBOffset =
+      kChecksumPartAOffset + kUInt32Size;
+  static const uint32_t kUnalignedHeaderSize =
+      kChecksumPartBOffset + kUInt32Size;
+  static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
+
+  static const int kEntryHeaderWords = 8;
+  static const int kWordsPerHint = 3;
+
+  // Used when producing.
+  explicit SerializedFeedbackData(const std::vector<uint32_t>& payload) {
+    uint32_t payload_length =
+        static_cast<uint32_t>(payload.size()) * kUInt32Size;
+    uint32_t size = kHeaderSize + POINTER_SIZE_ALIGN(payload_length);
+    AllocateData(size);
+    memset(data_, 0, size);
+
+    SetHeaderValue(kMagicNumberOffset, kFeedbackMagicNumber);
+    SetHeaderValue(kVersionHashOffset, Version::Hash());
+    SetHeaderValue(kFlagHashOffset, FlagList::Hash());
+    SetHeaderValue(kPayloadLengthOffset, payload_length);
+    CopyBytes(data_ + kHeaderSize,
+              reinterpret_cast<const byte*>(payload.data()),
+              static_cast<size_t>(payload_length));
+
+    Checksum checksum(ChecksummedContent());
+    SetHeaderValue(kChecksumPartAOffset, checksum.a());
+    SetHeaderValue(kChecksumPartBOffset, checksum.b());
+  }
+
+  // Used when consuming.
+  SerializedFeedbackData(const byte* data, int size)
+      : SerializedData(const_cast<byte*>(data), size) {}
+
+  // Return the data and relinquish ownership over it to the caller.
+  ScriptCompiler::CachedData* GetCachedData() {
+    DCHECK(owns_data_);
+    ScriptCompiler::CachedData* result = new ScriptCompiler::CachedData(
+        data_, size_, ScriptCompiler::CachedData::BufferOwned);
+    owns_data_ = false;
+    data_ = nullptr;
+    return result;
+  }
+
+  PersistedFeedback::SanityCheckResult SanityCheck() const {
+    if (size_ < kHeaderSize) return PersistedFeedback::INVALID_HEADER;
+    if (GetMagicNumber() != kFeedbackMagicNumber) {
+      return PersistedFeedback::MAGIC_NUMBER_MISMATCH;
+    }
+    if (GetHeaderValue(kVersionHashOffset) != Version::Hash()) {
+      return PersistedFeedback::VERSION_MISMATCH;
+    }
+    if (GetHeaderValue(kFlagHashOffset) != FlagList::Hash()) {
+      return PersistedFeedback::FLAGS_MISMATCH;
+    }
+    if (GetHeaderValue(kPayloadLengthOffset) > size_ - kHeaderSize) {
+      return PersistedFeedback::LENGTH_MISMATCH;
+    }
+    if (!Checksum(ChecksummedContent())
+             .Check(GetHeaderValue(kChecksumPartAOffset),
+                    GetHeaderValue(kChecksumPartBOffset))) {
+      return PersistedFeedback::CHECKSUM_MISMATCH;
+    }
+    return PersistedFeedback::CHECK_SUCCESS;
+  }
+
+  Vector<const byte> Payload() const {
+    return Vector<const byte>(data_ + kHeaderSize,
+                              GetHeaderValue(kPayloadLengthOffset));
+  }
+
+ private:
+  Vector<const byte> ChecksummedContent() const {
+    return Vector<const byte>(data_ + kHeaderSize, size_ - kHeaderSize);
+  }
+};
+
+bool IsPersistedSlotKind(FeedbackSlotKind kind) {
+  // Only the slot kinds whose feedback is a plain Smi can be persisted.
+  return kind == FeedbackSlotKind::kBinaryOp ||
+         kind == FeedbackSlotKind::kCompareOp ||
+         kind == FeedbackSlotKind::kForIn;
+}
+
+bool WasOptimized(FeedbackVector vector) {
+  if (vector->has_optimized_code()) return true;
+  if (!vector->has_optimization_marker()) return false;
+  OptimizationMarker marker = vector->optimization_marker();
+  return marker == OptimizationMarker::kCompileOptimized ||
+         marker == OptimizationMarker::kCompileOptimizedConcurrent ||
+         marker == OptimizationMarker::kInOptimizationQueue;
+}
+
+int Hotness(FeedbackVector vector) {
+  return WasOptimized(vector) ? kMaxInt : vector->profiler_ticks();
+}
+
+void SerializeEntry(uint32_t script_hash, FeedbackVector vector,
+                    std::vector<uint32_t>* payload) {
+  SharedFunctionInfo shared = vector->shared_function_info();
+  FeedbackMetadata metadata = shared->feedback_metadata();
+  payload->push_back(script_hash);
+  payload->push_back(static_cast<uint32_t>(shared->StartPosition()));
+  payload->push_back(static_cast<uint32_t>(shared->EndPosition()));
+  payload->push_back(static_cast<uint32_t>(metadata->slot_count()));
+  payload->push_back(WasOptimized(vector) ? 1 : 0);
+  payload->push_back(static_cast<uint32_t>(vector->profiler_ticks()));
+  payload->push_back(static_cast<uint32_t>(vector->deopt_count()));
+  size_t hint_count_index = payload->size();
+  payload->push_back(0);
+
+  uint32_t hint_count = 0;
+  for (int i = 0; i < metadata->slot_count();) {
+    FeedbackSlot slot(i);
+    FeedbackSlotKind kind = metadata->GetKind(slot);
+    i += FeedbackMetadata::GetSlotSize(kind);
+    if (!IsPersistedSlotKind(kind)) continue;
+    Smi value;
+    if (!vector->Get(slot)->ToSmi(&value) || value->value() == 0) continue;
+    payload->push_back(static_cast<uint32_t>(slot.ToInt()));
+    payload->push_back(static_cast<uint32_t>(kind));
+    payload->push_back(static_cast<uint32_t>(value->value()));
+    hint_count++;
+  }
+  (*payload)[hint_count_index] = hint_count;
+}
+
+}  // namespace
+
+// static
+ScriptCompiler::CachedData* FeedbackSerializer::Serialize(Isolate* isolate) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  std::vector<uint32_t> payload;
+  int function_count = 0;
+  {
+    HeapIterator iterator(isolate->heap(), HeapIterator::kFilterUnreachable);
+    DisallowHeapAllocation no_gc;
+
+    // Closures of the same function created in different contexts have
+    // separate feedback vectors; only the hottest one is persisted.
+    std::unordered_map<Address, FeedbackVector> vectors;
+    for (HeapObject obj = iterator.next(); !obj.is_null();
+         obj = iterator.next()) {
+      if (!obj->IsFeedbackVector()) continue;
+      FeedbackVector vector = FeedbackVector::cast(obj);
+      SharedFunctionInfo shared = vector->shared_function_info();
+      if (!shared->IsUserJavaScript() || shared->optimization_disabled()) {
+        continue;
+      }
+      auto it = vectors.find(shared.ptr());
+      if (it == vectors.end()) {
+        vectors.insert({shared.ptr(), vector});
+      } else if (Hotness(vector) > Hotness(it->second)) {
+        it->second = vector;
+      }
+    }
+
+    std::unordered_map<int, uint32_t> script_hashes;
+    for (auto& entry : vectors) {
+      SharedFunctionInfo shared = entry.second->shared_function_info();
+      Script script = Script::cast(shared->script());
+      if (!script->source()->IsString()) continue;
+      auto hash = script_hashes.find(script->id());
+      if (hash == script_hashes.end()) {
+        hash = script_hashes.insert({script->id(), ScriptSourceHash(script)})
+                   .first;
+      }
+      SerializeEntry(hash->second, entry.second, &payload);
+      function_count++;
+    }
+  }
+
+  SerializedFeedbackData data(payload);
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Serializing feedback of %d functions to %d bytes took %0.3f ms]\n",
+           function_count, static_cast<int>(payload.size() * kUInt32Size),
+           ms);
+  }
+  return data.GetCachedData();
+}
+
+// static
+uint32_t FeedbackSerializer::ScriptSourceHash(Script script) {
+  DisallowHeapAllocation no_gc;
+  String source = String::cast(script->source());
+  size_t hash = base::hash_value(source->length());
+  StringCharacterStream stream(source);
+  while (stream.HasMore()) hash = base::hash_combine(hash, stream.GetNext());
+  return static_cast<uint32_t>(hash);
+}
+
+// static
+std::unique_ptr<PersistedFeedback> PersistedFeedback::Deserialize(
+    const byte* data, int length, SanityCheckResult* rejection_result) {
+  // Makes an aligned copy of {data} if necessary.
+  ScriptData script_data(data, length);
+  SerializedFeedbackData scd(script_data.data(), script_data.length());
+  *rejection_result = scd.SanityCheck();
+  if (*rejection_result != CHECK_SUCCESS) {
+    if (FLAG_profile_deserialization) PrintF("[Feedback failed check]\n");
+    return nullptr;
+  }
+
+  std::unique_ptr<PersistedFeedback> result(new PersistedFeedback());
+  if (!result->Parse(scd.Payload())) {
+    *rejection_result = LENGTH_MISMATCH;
+    return nullptr;
+  }
+  if (FLAG_profile_deserialization) {
+    PrintF("[Loaded feedback of %d functions]\n", result->function_count());
+  }
+  return result;
+}
+
+bool PersistedFeedback::Parse(Vector<const byte> payload) {
+  const uint32_t* words = reinterpret_cast<const uint32_t*>(payload.start());
+  size_t length = payload.length() / kUInt32Size;
+  size_t pos = 0;
+  while (pos < length) {
+    if (length - pos < SerializedFeedbackData::kEntryHeaderWords) return false;
+    uint32_t script_hash = words[pos++];
+    int start_position = static_cast<int>(words[pos++]);
+    Entry entry;
+    entry.end_position = static_cast<int>(words[pos++]);
+    entry.slot_count = static_cast<int>(words[pos++]);
+    entry.was_optimized = words[pos++] != 0;
+    entry.profiler_ticks = static_cast<int>(words[pos++]);
+    entry.deopt_count = static_cast<int>(words[pos++]);
+    entry.hint_count = words[pos++];
+    entry.first_hint = hints_.size();
+    if ((length - pos) / SerializedFeedbackData::kWordsPerHint <
+        entry.hint_count) {
+      return false;
+    }
+    for (size_t i = 0; i < entry.hint_count; i++) {
+      Hint hint;
+      hint.slot = static_cast<int>(words[pos++]);
+      hint.kind = static_cast<int>(words[pos++]);
+      hint.value = static_cast<int>(words[pos++]);
+      hints_.push_back(hint);
+    }
+    entries_.insert({Key(script_hash, start_position), entry});
+  }
+  return true;
+}
+
+bool PersistedFeedback::IsApplicable(const Entry& entry,
+                                     SharedFunctionInfo shared) const {
+  FeedbackMetadata metadata = shared->feedback_metadata();
+  if (entry.end_position != shared->EndPosition()) return false;
+  if (entry.slot_count != metadata->slot_count()) return false;
+  if (entry.profiler_ticks < 0 || entry.deopt_count < 0) return false;
+  for (size_t i = 0; i < entry.hint_count; i++) {
+    const Hint& hint = hints_[entry.first_hint + i];
+    if (hint.slot < 0 || hint.slot >= metadata->slot_count()) return false;
+    FeedbackSlotKind kind = metadata->GetKind(FeedbackSlot(hint.slot));
+    if (static_cast<int>(kind) != hint.kind) return false;
+    if (!IsPersistedSlotKind(kind) || !Smi::IsValid(hint.value)) return false;
+  }
+  return true;
+}
+
+void PersistedFeedback::Apply(SharedFunctionInfo shared,
+                              FeedbackVector vector) {
+  DisallowHeapAllocation no_gc;
+  if (!shared->IsUserJavaScript()) return;
+  Script script = Script::cast(shared->script());
+  if (!script->source()->IsString()) return;
+
+  auto hash = script_hashes_.find(script->id());
+  if (hash == script_hashes_.end()) {
+    hash = script_hashes_
+               .insert({script->id(),
+                        FeedbackSerializer::ScriptSourceHash(script)})
+               .first;
+  }
+  auto it = entries_.find(Key(hash->second, shared->StartPosition()));
+  if (it == entries_.end()) return;
+  const Entry& entry = it->second;
+  if (!IsApplicable(entry, shared)) {
+    // The function changed since the feedback was collected.
+    entries_.erase(it);
+    return;
+  }
+
+  // The hints only ever get more general, so seeding them up front merely
+  // skips the transitions the previous process went through.
+  for (size_t i = 0; i < entry.hint_count; i++) {
+    const Hint& hint = hints_[entry.first_hint + i];
+    vector->Set(FeedbackSlot(hint.slot), Smi::FromInt(hint.value),
+                SKIP_WRITE_BARRIER);
+  }
+
+  // Functions that got optimized and never deoptimized become candidates
+  // for optimization on the next profiler tick.
+  int ticks = entry.profiler_ticks;
+  if (entry.was_optimized && entry.deopt_count == 0) {
+    ticks = Max(ticks,
+                RuntimeProfiler::TicksForOptimization(
+                    shared->GetBytecodeArray()));
+  }
+  vector->set_profiler_ticks(ticks);
+
+  if (FLAG_trace_opt_verbose) {
+    PrintF("[warm starting ");
+    shared->ShortPrint();
+    PrintF(" with %d persisted hints and %d profiler ticks]\n",
+           static_cast<int>(entry.hint_count), ticks);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
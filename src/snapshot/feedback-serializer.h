@@ -0,0 +1,105 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_FEEDBACK_SERIALIZER_H_
+#define V8_SNAPSHOT_FEEDBACK_SERIALIZER_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/snapshot/serializer-common.h"
+
+namespace v8 {
+namespace internal {
+
+class FeedbackVector;
+class Script;
+class SharedFunctionInfo;
+
+// Summarizes the type feedback and the optimization decisions collected for
+// the functions in the heap into a blob that a later process running the
+// same scripts can load to warm up optimization. Only feedback that does not
+// refer to heap objects survives the round trip: the BinaryOp, CompareOp and
+// ForIn hints, the profiler ticks and whether the function got optimized.
+// Functions are identified by a hash of their script source together with
+// their source range.
+class FeedbackSerializer : public AllStatic {
+ public:
+  static ScriptCompiler::CachedData* Serialize(Isolate* isolate);
+
+  // Deterministic hash of the source of {script}, which unlike the string
+  // hash does not depend on the per-process hash seed.
+  static uint32_t ScriptSourceHash(Script script);
+};
+
+// Feedback loaded from a blob produced by the FeedbackSerializer. It seeds
+// feedback vectors as they are allocated for matching functions.
+class PersistedFeedback {
+ public:
+  enum SanityCheckResult {
+    CHECK_SUCCESS = 0,
+    MAGIC_NUMBER_MISMATCH = 1,
+    VERSION_MISMATCH = 2,
+    FLAGS_MISMATCH = 3,
+    CHECKSUM_MISMATCH = 4,
+    INVALID_HEADER = 5,
+    LENGTH_MISMATCH = 6
+  };
+
+  // Returns nullptr and sets {rejection_result} if the blob was produced by
+  // a different V8 version or with different flags, or is corrupt.
+  static std::unique_ptr<PersistedFeedback> Deserialize(
+      const byte* data, int length, SanityCheckResult* rejection_result);
+
+  // Seeds the freshly allocated {vector} of {shared} with the persisted
+  // feedback for that function, if any. Entries whose feedback layout no
+  // longer matches the function are dropped.
+  void Apply(SharedFunctionInfo shared, FeedbackVector vector);
+
+  int function_count() const { return static_cast<int>(entries_.size()); }
+
+ private:
+  struct Hint {
+    int slot;
+    int kind;
+    int value;
+  };
+
+  struct Entry {
+    int end_position;
+    int slot_count;
+    bool was_optimized;
+    int profiler_ticks;
+    int deopt_count;
+    size_t first_hint;
+    size_t hint_count;
+  };
+
+  typedef std::pair<uint32_t, int> Key;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return base::hash_combine(key.first, key.second);
+    }
+  };
+
+  PersistedFeedback() = default;
+
+  bool Parse(Vector<const byte> payload);
+  bool IsApplicable(const Entry& entry, SharedFunctionInfo shared) const;
+
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  std::vector<Hint> hints_;
+  // Source hashes of the scripts seen so far, by script id.
+  std::unordered_map<int, uint32_t> script_hashes_;
+
+  DISALLOW_COPY_AND_ASSIGN(PersistedFeedback);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_FEEDBACK_SERIALIZER_H_
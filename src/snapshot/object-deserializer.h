@@ -19,9 +19,17 @@ class ObjectDeserializer final : public Deserializer {
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
       Isolate* isolate, const SerializedCodeData* data, Handle<String> source);
 
- private:
+  // Only decodes {data}, without touching the heap, so that the deserializer
+  // can be created on a background thread. The underlying ScriptData must
+  // stay alive until the deserializer is done.
   explicit ObjectDeserializer(const SerializedCodeData* data);
 
+  // Deserializes the SharedFunctionInfo of the script with {source} from the
+  // decoded data.
+  MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
+      Isolate* isolate, Handle<String> source);
+
+ private:
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize(Isolate* isolate);
 
@@ -13,6 +13,10 @@
 namespace v8 {
 namespace internal {
 
+// Deoptimization exits are a single "call rel32" to the entry.
+const bool Deoptimizer::kSupportsFixedDeoptExitSize = true;
+const int Deoptimizer::kDeoptExitSize = 5;
+
 #define __ masm->
 
 void Deoptimizer::GenerateDeoptimizationEntries(MacroAssembler* masm,
@@ -63,8 +67,8 @@ void Deoptimizer::GenerateDeoptimizationEntries(MacroAssembler* masm,
   // this on linux), since it is another parameter passing register on windows.
   Register arg5 = r11;
 
-  // The bailout id is passed using r13 on the stack.
-  __ movq(arg_reg_3, r13);
+  // The bailout id is computed from the return address by the Deoptimizer.
+  __ Set(arg_reg_3, kFixedExitSizeMarker);
 
   // Get the address of the location in the code object
   // and compute the fp-to-sp delta in register arg5.
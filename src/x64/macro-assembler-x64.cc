@@ -2733,9 +2733,9 @@ void TurboAssembler::ResetSpeculationPoisonRegister() {
 }
 
 void TurboAssembler::CallForDeoptimization(Address target, int deopt_id) {
-  NoRootArrayScope no_root_array(this);
-  // Save the deopt id in r13 (we don't need the roots array from now on).
-  movq(r13, Immediate(deopt_id));
+  // The Deoptimizer computes the {deopt_id} from the return address, see
+  // Deoptimizer::kSupportsFixedDeoptExitSize.
+  USE(deopt_id);
   call(target, RelocInfo::RUNTIME_ENTRY);
 }
 
@@ -41,6 +41,10 @@ class InstructionSchedulerTester {
   }
   void CheckIsDeopt(Instruction* instr) { CHECK(instr->IsDeoptimizeCall()); }
 
+  int GetLatency(Instruction* instr) {
+    return InstructionScheduler::GetInstructionLatency(instr);
+  }
+
   void CheckInSuccessors(Instruction* instr, Instruction* successor) {
     InstructionScheduler::ScheduleGraphNode* node = GetNode(instr);
     InstructionScheduler::ScheduleGraphNode* succ_node = GetNode(successor);
@@ -108,6 +112,49 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+#if V8_TARGET_ARCH_X64
+TEST(X64InstructionLatencies) {
+  InstructionSchedulerTester tester;
+  Zone* zone = tester.zone();
+
+  InstructionOperand outputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 0)};
+  InstructionOperand inputs[] = {
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 1),
+      UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, 2)};
+  auto binop = [&](InstructionCode opcode) {
+    return Instruction::New(zone, opcode, 1, outputs, 2, inputs, 0, nullptr);
+  };
+
+  // Loads wait for the cache, register moves and stores do not.
+  Instruction* load = Instruction::New(
+      zone, kX64Movl | AddressingModeField::encode(kMode_MR), 1, outputs, 1,
+      inputs, 0, nullptr);
+  Instruction* move =
+      Instruction::New(zone, kX64Movl, 1, outputs, 1, inputs, 0, nullptr);
+  Instruction* store = Instruction::New(
+      zone, kX64Movl | AddressingModeField::encode(kMode_MR), 0, nullptr, 2,
+      inputs, 0, nullptr);
+  CHECK_LE(1, tester.GetLatency(load));
+  CHECK_EQ(1, tester.GetLatency(move));
+  CHECK_EQ(1, tester.GetLatency(store));
+
+  // Whatever the model, division is slower than multiplication, which is
+  // slower than addition.
+  CHECK_EQ(1, tester.GetLatency(binop(kX64Add32)));
+  CHECK_LT(tester.GetLatency(binop(kX64Add32)),
+           tester.GetLatency(binop(kX64Imul32)));
+  CHECK_LT(tester.GetLatency(binop(kX64Imul32)),
+           tester.GetLatency(binop(kX64Idiv32)));
+  CHECK_LE(tester.GetLatency(binop(kX64Idiv32)),
+           tester.GetLatency(binop(kX64Idiv)));
+  CHECK_LT(tester.GetLatency(binop(kSSEFloat64Mul)),
+           tester.GetLatency(binop(kSSEFloat64Div)));
+  CHECK_EQ(tester.GetLatency(binop(kSSEFloat64Mul)),
+           tester.GetLatency(binop(kAVXFloat64Mul)));
+}
+#endif  // V8_TARGET_ARCH_X64
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/js-context-specialization.h"
 #include "src/compiler/js-graph.h"
@@ -32,8 +33,9 @@ class ContextSpecializationTester : public HandleAndZoneScope {
                  &machine_),
         reducer_(main_zone(), graph()),
         js_heap_broker_(main_isolate(), main_zone()),
+        dependencies_(main_isolate(), main_zone()),
         spec_(&reducer_, jsgraph(), &js_heap_broker_, context,
-              MaybeHandle<JSFunction>()) {}
+              MaybeHandle<JSFunction>(), &dependencies_) {}
 
   JSContextSpecialization* spec() { return &spec_; }
   Factory* factory() { return main_isolate()->factory(); }
@@ -60,6 +62,7 @@ class ContextSpecializationTester : public HandleAndZoneScope {
   JSGraph jsgraph_;
   GraphReducer reducer_;
   JSHeapBroker js_heap_broker_;
+  CompilationDependencies dependencies_;
   JSContextSpecialization spec_;
 };
 
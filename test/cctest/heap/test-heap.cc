@@ -1323,6 +1323,122 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingUnderMemoryPressure) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_adaptive_bytecode_flushing = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+
+    // Under critical memory pressure bytecode that was not executed since
+    // the previous marking cycle is flushed, instead of surviving several.
+    isolate->MemoryPressureNotification(v8::MemoryPressureLevel::kCritical);
+    CcTest::CollectAllGarbage();
+    isolate->MemoryPressureNotification(v8::MemoryPressureLevel::kNone);
+    CHECK(!function->shared()->is_compiled());
+    CHECK(!function->is_compiled());
+
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
+TEST(TestBytecodeFlushingKeepsPreparseData) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_stress_flush_bytecode = true;
+  i::FLAG_flush_bytecode_keep_preparse_data = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function outer() {"
+        "  function inner() { return 42; }"
+        "  return inner();"
+        "};";
+    Handle<String> outer_name = factory->InternalizeUtf8String("outer");
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), outer_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    Handle<SharedFunctionInfo> shared(function->shared(), i_isolate);
+    CHECK(shared->HasUncompiledDataWithPreparseData());
+    Handle<PreparseData> preparse_data(
+        shared->uncompiled_data_with_preparse_data()->preparse_data(),
+        i_isolate);
+
+    // Compiling drops the preparse data from the function, but it is kept on
+    // the side.
+    CHECK_EQ(42, CompileRun("outer()")
+                     ->Int32Value(isolate->GetCurrentContext())
+                     .FromJust());
+    CHECK(shared->is_compiled());
+
+    // Flushing the bytecode gives the function its preparse data back.
+    CcTest::CollectAllGarbage();
+    CHECK(!shared->is_compiled());
+    CHECK(shared->HasUncompiledDataWithPreparseData());
+    CHECK_EQ(*preparse_data,
+             shared->uncompiled_data_with_preparse_data()->preparse_data());
+    CHECK_EQ(42, CompileRun("outer()")
+                     ->Int32Value(isolate->GetCurrentContext())
+                     .FromJust());
+    CHECK(shared->is_compiled());
+
+    // The data is kept again, so it survives the next flush as well.
+    CcTest::CollectAllGarbage();
+    CHECK(shared->HasUncompiledDataWithPreparseData());
+    CHECK_EQ(*preparse_data,
+             shared->uncompiled_data_with_preparse_data()->preparse_data());
+  }
+}
+
 #ifndef V8_LITE_MODE
 
 TEST(TestOptimizeAfterBytecodeFlushingCandidate) {
@@ -5030,6 +5030,48 @@ TEST(InterpreterWithNativeStack) {
 }
 #endif  // V8_TARGET_ARCH_ARM
 
+namespace {
+
+Handle<BytecodeArray> CompileShortStarSample(const char* name) {
+  // Block scoped variables of the script live in registers.
+  ScopedVector<char> source(1024);
+  SNPrintF(source,
+           "// %s\n"
+           "{"
+           "  let a = 1, b = 2;"
+           "  let x = a + b, y = a - b, z = a * b;"
+           "  for (let i = 0; i < 10; i++) {"
+           "    x = y + z; y = z + i; z = x + y;"
+           "  }"
+           "}",
+           name);
+  Handle<Object> o = v8::Utils::OpenHandle(*v8_compile(source.start()));
+  Handle<JSFunction> f = Handle<JSFunction>::cast(o);
+  return handle(f->shared()->GetBytecodeArray(), f->GetIsolate());
+}
+
+}  // namespace
+
+TEST(InterpreterShortStarBytecodeSize) {
+  HandleAndZoneScope handles;
+
+  bool old_flag = FLAG_ignition_short_star;
+  FLAG_ignition_short_star = false;
+  Handle<BytecodeArray> long_form = CompileShortStarSample("long");
+  FLAG_ignition_short_star = true;
+  Handle<BytecodeArray> short_form = CompileShortStarSample("short");
+  FLAG_ignition_short_star = old_flag;
+
+  // Each short Star saves the operand byte of a Star, and nothing else
+  // changes.
+  int short_stars = 0;
+  for (BytecodeArrayIterator it(short_form); !it.done(); it.Advance()) {
+    if (Bytecodes::IsShortStar(it.current_bytecode())) short_stars++;
+  }
+  CHECK_LT(0, short_stars);
+  CHECK_EQ(long_form->length() - short_stars, short_form->length());
+}
+
 TEST(InterpreterGetBytecodeHandler) {
   HandleAndZoneScope handles;
   Isolate* isolate = handles.main_isolate();
@@ -618,6 +618,27 @@ TEST(CharacterStreams) {
   TestCharacterStreams(buffer, arraysize(buffer) - 1, 576, 3298);
 }
 
+TEST(WidenedCharacterStreams) {
+  // One-byte sources are scanned in place by default. Also test the streams
+  // that widen them into a UTF-16 buffer.
+  i::FLAG_scan_one_byte_in_place = false;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handles(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+
+  TestCharacterStreams("abcdefghi", 9);
+  TestCharacterStreams("", 0);
+
+  char buffer[4096 + 1];
+  for (unsigned i = 0; i < arraysize(buffer); i++) {
+    buffer[i] = static_cast<char>(i & 0x7F);
+  }
+  buffer[arraysize(buffer) - 1] = '\0';
+  TestCharacterStreams(buffer, arraysize(buffer) - 1);
+  TestCharacterStreams(buffer, arraysize(buffer) - 1, 576, 3298);
+}
+
 // Regression test for crbug.com/651333. Read invalid utf-8.
 TEST(Regress651333) {
   const uint8_t bytes[] =
@@ -762,6 +783,44 @@ TEST(RelocatingCharacterStream) {
   CHECK_EQ('d', two_byte_string_stream->Advance());
 }
 
+TEST(RelocatingOneByteCharacterStream) {
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* string = "abcdef";
+  int length = static_cast<int>(strlen(string));
+  i::Handle<i::String> one_byte_string =
+      i_isolate->factory()
+          ->NewStringFromOneByte(i::OneByteVector(string, length),
+                                 i::NOT_TENURED)
+          .ToHandleChecked();
+  // Start in the middle of the string, like the stream for a lazily compiled
+  // function does.
+  std::unique_ptr<i::Utf16CharacterStream> one_byte_string_stream(
+      i::ScannerStream::For(i_isolate, one_byte_string, 1, length));
+  CHECK(one_byte_string_stream->is_one_byte());
+  CHECK_EQ('b', one_byte_string_stream->Advance());
+  CHECK_EQ('c', one_byte_string_stream->Advance());
+  CHECK_EQ(size_t{3}, one_byte_string_stream->pos());
+  i::String raw = *one_byte_string;
+  i_isolate->heap()->CollectGarbage(i::NEW_SPACE,
+                                    i::GarbageCollectionReason::kUnknown);
+  // GC moved the string.
+  CHECK_NE(raw, *one_byte_string);
+  CHECK_EQ(size_t{3}, one_byte_string_stream->pos());
+  CHECK_EQ('d', one_byte_string_stream->Advance());
+  one_byte_string_stream->Back();
+  one_byte_string_stream->Back();
+  CHECK_EQ('c', one_byte_string_stream->Advance());
+  CHECK_EQ('d', one_byte_string_stream->Advance());
+  CHECK_EQ('e', one_byte_string_stream->Advance());
+  CHECK_EQ('f', one_byte_string_stream->Advance());
+  CHECK_EQ(i::Utf16CharacterStream::kEndOfInput,
+           one_byte_string_stream->Advance());
+}
+
 TEST(CloneCharacterStreams) {
   v8::HandleScope handles(CcTest::isolate());
   v8::Local<v8::Context> context = v8::Context::New(CcTest::isolate());
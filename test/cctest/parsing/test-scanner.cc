@@ -103,5 +103,76 @@ TEST(AllThePushbacks) {
   }
 }
 
+namespace {
+
+struct ScannedToken {
+  Token::Value token;
+  Scanner::Location location;
+  bool after_line_terminator;
+  std::string literal;
+};
+
+std::vector<ScannedToken> ScanAll(Isolate* isolate, Handle<String> source) {
+  std::unique_ptr<Utf16CharacterStream> stream(
+      ScannerStream::For(isolate, source));
+  Scanner scanner(stream.get(), false);
+  scanner.Initialize();
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  std::vector<ScannedToken> tokens;
+  do {
+    bool after_line_terminator = scanner.HasLineTerminatorBeforeNext();
+    Token::Value token = scanner.Next();
+    std::string literal;
+    if (token == Token::IDENTIFIER || token == Token::STRING) {
+      literal = scanner.CurrentLiteralAsCString(&zone);
+    }
+    tokens.push_back(
+        {token, scanner.location(), after_line_terminator, literal});
+  } while (scanner.current_token() != Token::EOS);
+  return tokens;
+}
+
+}  // anonymous namespace
+
+TEST(VectorizedScanner) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+
+  // Runs of identifier, whitespace and string literal characters of all
+  // lengths, repeated so that some of them cross the blocks of the stream.
+  const std::string name = "aZ09_$bCdEfGhIjKlMnOpQrStUvWxYz_$1234567890";
+  std::string source;
+  for (int i = 0; i < 40; i++) {
+    source += "var " + name.substr(0, i + 1) + " = ";
+    source += "'" + std::string(i, 'x') + "\\n\"" + std::string(i, '.') + "'";
+    source += std::string(i, ' ') + (i % 3 == 0 ? "\n" : "") + "+ ";
+    source += "\"" + std::string(2 * i, '-') + "\";\t\v\f";
+    source += std::string(i, '\t') + (i % 2 == 0 ? "\r\n" : " ");
+    source += "if (a" + std::string(i, 'B') + " instanceof $) function_" +
+              std::to_string(i) + "(instanceof_, functions);\n";
+  }
+  Handle<String> string =
+      isolate->factory()->NewStringFromAsciiChecked(source.c_str());
+
+  FLAG_vectorized_scanner = false;
+  std::vector<ScannedToken> expected = ScanAll(isolate, string);
+  FLAG_vectorized_scanner = true;
+  std::vector<ScannedToken> actual = ScanAll(isolate, string);
+
+  CHECK_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); i++) {
+    CHECK_TOK(expected[i].token, actual[i].token);
+    CHECK_EQ(expected[i].location.beg_pos, actual[i].location.beg_pos);
+    CHECK_EQ(expected[i].location.end_pos, actual[i].location.end_pos);
+    CHECK_EQ(expected[i].after_line_terminator,
+             actual[i].after_line_terminator);
+    CHECK_EQ(expected[i].literal, actual[i].literal);
+  }
+  CHECK_TOK(Token::VAR, actual[0].token);
+  CHECK_TOK(Token::INSTANCEOF, actual[10].token);
+  CHECK_EQ(std::string("function_0"), actual[13].literal);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -26396,6 +26396,89 @@ TEST(StreamingScriptWithSourceMappingURLInTheMiddle) {
 }
 
 
+TEST(StreamingScriptWithParallelInnerFunctions) {
+  i::FLAG_parallel_streaming_compile = true;
+  // The parenthesized functions are compiled eagerly, and thus on worker
+  // threads, together with the functions they contain.
+  const char* chunks[] = {
+      "var a = (function(x) { return (function(y) { return x + y; })(1); });",
+      "var b = (function() { 'use strict'; return 4; });\n",
+      "var c = (function(o) { var s = 0; for (var k in o) s += o[k]; ",
+      "return s; });\n",
+      "var d = (function() { return (() => 2)() + ",
+      "(function() { return 1; })(); });\n",
+      "a(2) + b() + c({x: 1, y: 2}) + d();", nullptr};
+  RunStreamingTest(chunks);
+  RunStreamingTest(chunks, v8::ScriptCompiler::StreamedSource::UTF8);
+}
+
+
+TEST(StreamingScriptWithParallelInnerFunctionsAndParseError) {
+  i::FLAG_parallel_streaming_compile = true;
+  const char* chunks[] = {"var a = (function() { return 1; });\n",
+                          "var b = (function() { return 2 +; });\n", "13;",
+                          nullptr};
+  RunStreamingTest(chunks, v8::ScriptCompiler::StreamedSource::ONE_BYTE,
+                   false);
+}
+
+
+void RunStreamingModuleTest(const char** chunks) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  v8::ScriptCompiler::StreamedSource source(
+      new TestSourceStream(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingModule(isolate, &source);
+  task->Run();
+  delete task;
+  CHECK(!try_catch.HasCaught());
+
+  v8::ScriptOrigin origin(v8_str("http://foo.com/module.js"),
+                          Local<v8::Integer>(), Local<v8::Integer>(),
+                          Local<v8::Boolean>(), Local<v8::Integer>(),
+                          Local<v8::Value>(), Local<v8::Boolean>(),
+                          Local<v8::Boolean>(), True(isolate));
+  char* full_source = TestSourceStream::FullSourceString(chunks);
+  Local<Module> module =
+      v8::ScriptCompiler::CompileModule(env.local(), &source,
+                                        v8_str(full_source), origin)
+          .ToLocalChecked();
+  CHECK_EQ(0, module->GetModuleRequestsLength());
+  module->InstantiateModule(env.local(), UnexpectedModuleResolveCallback)
+      .ToChecked();
+  CHECK(!module->Evaluate(env.local()).IsEmpty());
+  CHECK(!try_catch.HasCaught());
+  Local<v8::Object> ns = module->GetModuleNamespace().As<v8::Object>();
+  CHECK_EQ(13, ns->Get(env.local(), v8_str("result"))
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+  delete[] full_source;
+}
+
+
+TEST(StreamingModule) {
+  const char* chunks[] = {"export let a = 6; function f",
+                          "oo() { return a + 7; }\n",
+                          "export const result = foo();", nullptr};
+  RunStreamingModuleTest(chunks);
+}
+
+
+TEST(StreamingModuleWithParallelInnerFunctions) {
+  i::FLAG_parallel_streaming_compile = true;
+  const char* chunks[] = {
+      "const f = (function(x) { return (function() { return x; })(); });\n",
+      "const g = (() => 6);\n", "export const result = f(7) + g();", nullptr};
+  RunStreamingModuleTest(chunks);
+}
+
+
 TEST(NewStringRangeError) {
   // This test uses a lot of memory and fails with flaky OOM when run
   // with --stress-incremental-marking on TSAN.
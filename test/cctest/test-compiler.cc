@@ -911,6 +911,97 @@ TEST(DeepEagerCompilationPeakMemory) {
   CHECK_LE(peak_mem_4 - peak_mem_3, peak_mem_3);
 }
 
+TEST(CompilationCacheFunctionConstructorAcrossContexts) {
+  if (!FLAG_compilation_cache) return;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::CompilationCacheStatistics before;
+  CHECK(isolate->GetCompilationCacheStatistics(&before));
+
+  // The first compilation only enters the hash of the source into the cache,
+  // the second one enters the code, and the third one finds it even though
+  // each of them runs in a native context of its own.
+  const int kContexts = 3;
+  Handle<SharedFunctionInfo> shared[kContexts];
+  for (int i = 0; i < kContexts; i++) {
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CompileRun("var f = new Function('a', 'return a + 1;');");
+    CHECK_EQ(2, CompileRun("f(1)")->Int32Value(context).FromJust());
+    Handle<JSFunction> f = Handle<JSFunction>::cast(GetGlobalProperty("f"));
+    shared[i] = handle(f->shared(), CcTest::i_isolate());
+  }
+  CHECK_NE(*shared[0], *shared[1]);
+  CHECK_EQ(*shared[1], *shared[2]);
+
+  v8::CompilationCacheStatistics after;
+  CHECK(isolate->GetCompilationCacheStatistics(&after));
+  CHECK_EQ(before.eval_hits() + 1, after.eval_hits());
+  CHECK_EQ(before.eval_misses() + 2, after.eval_misses());
+  CHECK_LT(0, after.eval_cache_size());
+}
+
+TEST(CompilationCacheEvalMaxSize) {
+  if (!FLAG_compilation_cache) return;
+  FLAG_compilation_cache_eval_max_size = 16;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  // Compile each source twice, so that the cache enters its code.
+  CompileRun(
+      "var indirect = eval;"
+      "var source;"
+      "for (var i = 0; i < 500; i++) {"
+      "  source = 'var x' + i + ' = [' + 'i, '.repeat(50) + '];';"
+      "  indirect(source);"
+      "  indirect(source);"
+      "}");
+  v8::CompilationCacheStatistics before;
+  CHECK(isolate->GetCompilationCacheStatistics(&before));
+  CHECK_LT(0, before.eval_cache_size());
+  CHECK_LE(before.eval_cache_size(), 16 * KB);
+
+  // The most recently added code is still there.
+  CompileRun("indirect(source);");
+  v8::CompilationCacheStatistics after;
+  CHECK(isolate->GetCompilationCacheStatistics(&after));
+  CHECK_EQ(before.eval_hits() + 1, after.eval_hits());
+}
+
+TEST(CompilationCacheEvalKeepsRecentlyUsed) {
+  if (!FLAG_compilation_cache) return;
+  FLAG_compilation_cache_eval_max_size = 16;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  LocalContext env;
+
+  // The code for {hot} is added first, but used in between the others, so
+  // that the others are evicted before it.
+  CompileRun(
+      "var indirect = eval;"
+      "var hot = 'var hot_x = 1;';"
+      "indirect(hot);"
+      "indirect(hot);"
+      "for (var i = 0; i < 500; i++) {"
+      "  var source = 'var x' + i + ' = [' + 'i, '.repeat(50) + '];';"
+      "  indirect(source);"
+      "  indirect(source);"
+      "  indirect(hot);"
+      "}");
+  v8::CompilationCacheStatistics before;
+  CHECK(isolate->GetCompilationCacheStatistics(&before));
+  CHECK_LE(before.eval_cache_size(), 16 * KB);
+
+  CompileRun("indirect(hot);");
+  v8::CompilationCacheStatistics after;
+  CHECK(isolate->GetCompilationCacheStatistics(&after));
+  CHECK_EQ(before.eval_hits() + 1, after.eval_hits());
+}
+
 // TODO(mslekova): Remove the duplication with test-heap.cc
 static int AllocationSitesCount(Heap* heap) {
   int count = 0;
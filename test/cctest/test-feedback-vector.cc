@@ -749,6 +749,45 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
 }
 
+TEST(LazyFeedbackAllocation) {
+  if (i::FLAG_always_opt || i::FLAG_lite_mode) return;
+  i::FLAG_lazy_feedback_allocation = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  CompileRun(
+      "function once(o) { return o.x; }"
+      "function hot(o) { return o.x; }"
+      "function outer() { return function inner(o) { return o.x; }; }"
+      "var inner = outer();"
+      "once({x: 1});"
+      "inner({x: 1});"
+      "for (var i = 0; i < 10000; ++i) hot({x: i});");
+  Handle<JSFunction> once = GetFunction("once");
+  Handle<JSFunction> hot = GetFunction("hot");
+  Handle<JSFunction> inner = GetFunction("inner");
+  // Functions that ran only a few times have no feedback vector yet.
+  CHECK(!once->has_feedback_vector());
+  CHECK(!inner->has_feedback_vector());
+  CHECK_EQ(inner->raw_feedback_cell(), CcTest::heap()->no_feedback_cell());
+  // The budget interrupt allocated one for the function that ran often.
+  CHECK(hot->has_feedback_vector());
+  Handle<FeedbackVector> feedback_vector(hot->feedback_vector(),
+                                         hot->GetIsolate());
+  FeedbackVectorHelper helper(feedback_vector);
+  CHECK_EQ(1, helper.slot_count());
+  CHECK_SLOT_KIND(helper, 0, FeedbackSlotKind::kLoadProperty);
+
+  // Allocating the vector of a closure created by a function without a
+  // feedback vector gives it a feedback cell of its own.
+  JSFunction::EnsureFeedbackVector(inner);
+  CHECK(inner->has_feedback_vector());
+  CHECK_NE(inner->raw_feedback_cell(), CcTest::heap()->no_feedback_cell());
+  CHECK(CcTest::heap()->no_feedback_cell()->value()->IsUndefined());
+}
+
 }  // namespace
 
 }  // namespace internal
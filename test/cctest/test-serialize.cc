@@ -44,7 +44,9 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/runtime-profiler.h"
 #include "src/runtime/runtime.h"
+#include "src/snapshot/code-cache-directory.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/partial-deserializer.h"
@@ -2481,6 +2483,122 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+class ValidateCodeCacheThread : public v8::base::Thread {
+ public:
+  explicit ValidateCodeCacheThread(
+      v8::ScriptCompiler::ValidateCodeCacheTask* task)
+      : Thread(Options("ValidateCodeCacheThread")), task_(task) {}
+
+  void Run() override { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ValidateCodeCacheTask* task_;
+};
+
+// Compiles {source} in a new isolate, consuming {cache} with a
+// ValidateCodeCacheTask that runs on a background thread if {run_task}.
+void CompileWithValidateCodeCacheTask(const char* source,
+                                      v8::ScriptCompiler::CachedData* cache,
+                                      bool run_task, bool expect_rejected) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::ValidateCodeCacheTask* task =
+        v8::ScriptCompiler::StartValidatingCodeCache(isolate2, cache);
+    if (run_task) {
+      ValidateCodeCacheThread thread(task);
+      thread.Start();
+      thread.Join();
+    }
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache, task);
+    v8::Local<v8::UnboundScript> script;
+    if (expect_rejected) {
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    } else {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK_EQ(expect_rejected, cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abcdef")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerValidateCodeCacheTask) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+  CompileWithValidateCodeCacheTask(source, cache, true, false);
+}
+
+TEST(CodeSerializerValidateCodeCacheTaskNotRun) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+  CompileWithValidateCodeCacheTask(source, cache, false, false);
+}
+
+TEST(CodeSerializerValidateCodeCacheTaskBitFlip) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  // Random bit flip, which the task detects in the background.
+  const_cast<uint8_t*>(cache->data)[337] ^= 0x40;
+  CompileWithValidateCodeCacheTask(source, cache, true, true);
+}
+
+TEST(CodeSerializerValidateCodeCacheTaskSourceMismatch) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  // Only the main thread knows the source the cache is consumed for.
+  CompileWithValidateCodeCacheTask(
+      "function f() { return 'abc'; }; f() + 'def' + ''", cache, true, true);
+}
+
+TEST(CodeSerializerValidateCodeCacheTaskFinishTwice) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+
+    CodeCacheValidationTask task(i_isolate, cache);
+    task.Run();
+    Handle<String> source_str =
+        i_isolate->factory()->NewStringFromAsciiChecked(source);
+    CHECK(!task.Finish(i_isolate, source_str, ScriptOriginOptions())
+               .is_null());
+    CHECK(!task.rejected());
+
+    // The deserializer is gone after the first call.
+    CHECK(task.Finish(i_isolate, source_str, ScriptOriginOptions()).is_null());
+    CHECK(task.rejected());
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   const char* source1 = "'use strict'; let x = 'X'";
   const char* source2 = "'use strict'; let y = 'Y'";
@@ -3923,5 +4041,216 @@ TEST(CachedCompileFunctionInContext) {
   }
 }
 
+namespace {
+
+const char* kTypeFeedbackSource = "function add(a, b) { return a + b; }";
+
+ScriptCompiler::CachedData* RunAndProduceTypeFeedbackCache() {
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun(kTypeFeedbackSource);
+  CompileRun(
+      "add(1.5, 2);"
+      "%OptimizeFunctionOnNextCall(add);"
+      "add(1.5, 2);");
+  return v8::ScriptCompiler::CreateTypeFeedbackCache(CcTest::isolate());
+}
+
+// Runs {source} and then add(1, 2) in a fresh isolate that loaded {cache},
+// and reports the BinaryOp feedback and the profiler ticks of add.
+void RunWithTypeFeedbackCache(ScriptCompiler::CachedData* cache,
+                              const char* source, bool expect_accepted,
+                              int* binary_op, int* ticks, int* threshold) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    CHECK_EQ(expect_accepted,
+             v8::ScriptCompiler::ConsumeTypeFeedbackCache(isolate2, cache));
+    CompileRun(source);
+    CompileRun("add(1, 2)");
+    Handle<JSFunction> add =
+        Handle<JSFunction>::cast(v8::Utils::OpenHandle(*CompileRun("add")));
+    FeedbackVector vector = add->feedback_vector();
+    FeedbackMetadata metadata = add->shared()->feedback_metadata();
+    *binary_op = BinaryOperationFeedback::kNone;
+    for (int i = 0; i < metadata->slot_count(); i++) {
+      FeedbackSlot slot(i);
+      if (metadata->GetKind(slot) != FeedbackSlotKind::kBinaryOp) continue;
+      *binary_op = vector->Get(slot)->ToSmi().value();
+    }
+    *ticks = vector->profiler_ticks();
+    *threshold = RuntimeProfiler::TicksForOptimization(
+        add->shared()->GetBytecodeArray());
+  }
+  isolate2->Dispose();
+}
+
+}  // namespace
+
+TEST(TypeFeedbackCacheIsolates) {
+  DisableAlwaysOpt();
+  FLAG_allow_natives_syntax = true;
+  FlagList::EnforceFlagImplications();
+  ScriptCompiler::CachedData* cache = RunAndProduceTypeFeedbackCache();
+
+  int binary_op, ticks, threshold;
+  RunWithTypeFeedbackCache(cache, kTypeFeedbackSource, true, &binary_op,
+                           &ticks, &threshold);
+  // The Number feedback from the first process is combined with the Smi
+  // feedback of the call in the second one.
+  CHECK_EQ(BinaryOperationFeedback::kNumber, binary_op);
+  if (FLAG_opt) CHECK_GE(ticks, threshold);
+
+  delete cache;
+}
+
+TEST(TypeFeedbackCacheSourceChange) {
+  DisableAlwaysOpt();
+  FLAG_allow_natives_syntax = true;
+  FlagList::EnforceFlagImplications();
+  ScriptCompiler::CachedData* cache = RunAndProduceTypeFeedbackCache();
+
+  // Same function positions, but a different script source.
+  int binary_op, ticks, threshold;
+  RunWithTypeFeedbackCache(cache, "function add(a, b) { return b + a; }",
+                           true, &binary_op, &ticks, &threshold);
+  CHECK_EQ(BinaryOperationFeedback::kSignedSmall, binary_op);
+  CHECK_EQ(0, ticks);
+
+  delete cache;
+}
+
+TEST(TypeFeedbackCacheBitFlip) {
+  DisableAlwaysOpt();
+  FLAG_allow_natives_syntax = true;
+  FlagList::EnforceFlagImplications();
+  ScriptCompiler::CachedData* cache = RunAndProduceTypeFeedbackCache();
+
+  // Random bit flip in the payload.
+  const_cast<uint8_t*>(cache->data)[cache->length - 1] ^= 0x40;
+
+  int binary_op, ticks, threshold;
+  RunWithTypeFeedbackCache(cache, kTypeFeedbackSource, false, &binary_op,
+                           &ticks, &threshold);
+  CHECK_EQ(BinaryOperationFeedback::kSignedSmall, binary_op);
+  CHECK_EQ(0, ticks);
+
+  delete cache;
+}
+
+TEST(CodeCacheDirectory) {
+  // The file is written when the first isolate is disposed, long before
+  // the warm-up delay ends.
+  FLAG_code_cache_dir = ".";
+  FLAG_code_cache_dir_warmup_delay = 1000;
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  std::string file_name;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (int run = 0; run < 2; run++) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope iscope(isolate);
+      v8::HandleScope scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+      CodeCacheDirectory* directory = i_isolate->code_cache_directory();
+      CHECK_NOT_NULL(directory);
+
+      v8::Local<v8::String> source_str = v8_str(source);
+      v8::Local<v8::String> name_str = v8_str("code-cache-directory");
+      file_name = directory->FileNameFor(
+          v8::Utils::OpenHandle(*source_str),
+          Compiler::ScriptDetails(v8::Utils::OpenHandle(*name_str)),
+          ScriptOriginOptions());
+      v8::ScriptCompiler::Source script_source(source_str,
+                                               v8::ScriptOrigin(name_str));
+      v8::Local<v8::Value> result;
+      if (run == 0) {
+        result = v8::ScriptCompiler::Compile(context, &script_source)
+                     .ToLocalChecked()
+                     ->Run(context)
+                     .ToLocalChecked();
+      } else {
+        // Both the script and the lazily compiled f come from the file.
+        DisallowCompilation no_compile(i_isolate);
+        result = v8::ScriptCompiler::Compile(context, &script_source)
+                     .ToLocalChecked()
+                     ->Run(context)
+                     .ToLocalChecked();
+      }
+      CHECK(result->Equals(context, v8_str("abcdef")).FromJust());
+      CHECK_EQ(run, directory->hits());
+      CHECK_EQ(1 - run, directory->misses());
+      CHECK_EQ(0, directory->rejects());
+      CHECK_EQ(0, directory->writes());
+    }
+    isolate->Dispose();
+  }
+
+  CHECK(base::OS::Remove(file_name.c_str()));
+  FLAG_code_cache_dir = nullptr;
+}
+
+TEST(CodeCacheDirectoryChecksSource) {
+  // A file that holds the code for a different source, as after a collision
+  // of the source hashes in the file name, is rejected.
+  FLAG_code_cache_dir = ".";
+  FLAG_code_cache_dir_warmup_delay = 1000;
+  const char* sources[] = {"'abc' + 'def'", "'ghi' + 'jkl'"};
+  const char* results[] = {"abcdef", "ghijkl"};
+  std::string file_names[2];
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (int run = 0; run < 2; run++) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope iscope(isolate);
+      v8::HandleScope scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+      CodeCacheDirectory* directory = i_isolate->code_cache_directory();
+      CHECK_NOT_NULL(directory);
+
+      v8::Local<v8::String> source_str = v8_str(sources[run]);
+      v8::Local<v8::String> name_str = v8_str("code-cache-directory");
+      file_names[run] = directory->FileNameFor(
+          v8::Utils::OpenHandle(*source_str),
+          Compiler::ScriptDetails(v8::Utils::OpenHandle(*name_str)),
+          ScriptOriginOptions());
+      if (run == 1) {
+        // Pretend that the file for the first source belongs to the second.
+        CHECK_EQ(0, std::rename(file_names[0].c_str(),
+                                file_names[1].c_str()));
+      }
+      v8::ScriptCompiler::Source script_source(source_str,
+                                               v8::ScriptOrigin(name_str));
+      v8::Local<v8::Value> result =
+          v8::ScriptCompiler::Compile(context, &script_source)
+              .ToLocalChecked()
+              ->Run(context)
+              .ToLocalChecked();
+      CHECK(result->Equals(context, v8_str(results[run])).FromJust());
+      CHECK_EQ(0, directory->hits());
+      CHECK_EQ(1 - run, directory->misses());
+      CHECK_EQ(run, directory->rejects());
+    }
+    isolate->Dispose();
+  }
+
+  CHECK(base::OS::Remove(file_names[1].c_str()));
+  FLAG_code_cache_dir = nullptr;
+}
+
 }  // namespace internal
 }  // namespace v8
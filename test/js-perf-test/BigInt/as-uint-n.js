@@ -0,0 +1,41 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// 64 bit FNV-1a hash, which wraps the product with BigInt.asUintN.
+const kFnvOffsetBasis = 0xcbf29ce484222325n;
+const kFnvPrime = 0x100000001b3n;
+const kBytes = [];
+for (let i = 0; i < 64; ++i) kBytes.push(BigInt((i * 37) & 0xff));
+
+function Fnv1a64() {
+  let hash = kFnvOffsetBasis;
+  for (let i = 0; i < kBytes.length; ++i) {
+    hash = BigInt.asUintN(64, (hash ^ kBytes[i]) * kFnvPrime);
+  }
+  return hash;
+}
+createSuite('AsUintN64', 1000, Fnv1a64, () => {});
+
+// Wrapping signed 64 bit accumulation.
+const kValues = [];
+for (let i = 0; i < 64; ++i) kValues.push(BigInt(i) << 57n);
+
+function WrappingSum() {
+  let sum = 0n;
+  for (let i = 0; i < kValues.length; ++i) {
+    sum = BigInt.asIntN(64, sum + kValues[i]);
+  }
+  return sum;
+}
+createSuite('AsIntN64', 1000, WrappingSum, () => {});
+
+// Values that already fit into 64 bits are returned as is.
+function AsUintN64Identity() {
+  let result = 0n;
+  for (let i = 0; i < kBytes.length; ++i) {
+    result = BigInt.asUintN(64, kBytes[i]);
+  }
+  return result;
+}
+createSuite('AsUintN64Identity', 1000, AsUintN64Identity, () => {});
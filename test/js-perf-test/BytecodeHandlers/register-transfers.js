@@ -0,0 +1,52 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test)
+      ]);
+}
+
+addBenchmark('Locals-Star', localsStar);
+addBenchmark('Temporaries-Star', temporariesStar);
+addBenchmark('PropertyLoad-Star', propertyLoadStar);
+
+// Most of the work in these loops is storing the accumulator to locals and
+// temporaries, which all live in the first registers.
+
+function localsStar() {
+  let a = 0, b = 1, c = 2, d = 3;
+  for (let i = 0; i < 1000; ++i) {
+    const t = a + b;
+    a = b;
+    b = c;
+    c = d;
+    d = t & 0xffff;
+  }
+  return a + b + c + d;
+}
+
+function sum3(x, y, z) { return x + y + z; }
+
+function temporariesStar() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) {
+    result = sum3(i, result & 0xff, sum3(1, 2, 3));
+  }
+  return result;
+}
+
+const point = {x: 1, y: 2, z: 3};
+
+function propertyLoadStar() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) {
+    const x = point.x;
+    const y = point.y;
+    const z = point.z;
+    result = (result + x * y + z) & 0xffff;
+  }
+  return result;
+}
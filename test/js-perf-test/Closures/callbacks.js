@@ -0,0 +1,55 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ClosureCallbacks', [1000], [
+  new Benchmark('ForEachCallback', false, false, 0,
+                ForEachCallback, CallbacksSetup, CallbacksTearDown),
+  new Benchmark('HandlerCallback', false, false, 0,
+                HandlerCallback, CallbacksSetup, CallbacksTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Every iteration creates a fresh closure for the callback, so the call
+// sites below see a different JSFunction on every call. All of these
+// closures share their SharedFunctionInfo and feedback cell though.
+
+var callbacksInput;
+var callbacksResult;
+
+function CallbacksSetup() {
+  callbacksInput = [];
+  for (var i = 0; i < 100; ++i) callbacksInput.push(i);
+  callbacksResult = 0;
+}
+
+function CallbacksTearDown() {
+  return callbacksResult === 4950 + 100 * 100;
+}
+
+function forEach(array, fn) {
+  for (var i = 0; i < array.length; ++i) fn(array[i]);
+}
+
+function ForEachCallback() {
+  var sum = 0;
+  for (var k = 0; k < 100; ++k) {
+    forEach(callbacksInput, x => { sum += x; });
+  }
+  callbacksResult = sum / 100 + 100 * 100;
+}
+
+function dispatch(request, handler) {
+  return handler(request.value);
+}
+
+function HandlerCallback() {
+  var sum = 0;
+  for (var k = 0; k < 100; ++k) {
+    var request = {value: callbacksInput[k]};
+    var offset = 100;
+    sum += dispatch(request, function(value) { return value + offset; });
+  }
+  callbacksResult = sum;
+}
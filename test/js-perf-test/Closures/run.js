@@ -5,6 +5,7 @@
 
 load('../base.js');
 load('closures.js');
+load('callbacks.js');
 
 var success = true;
 
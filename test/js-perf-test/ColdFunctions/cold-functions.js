@@ -0,0 +1,43 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ColdFunctions', [1000], [
+  new Benchmark('RunOnce', false, false, 0, RunOnce, RunOnceSetup)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Many functions in startup code run only once or twice. This benchmark
+// instantiates and calls a large number of such functions, which is where
+// allocating feedback vectors lazily pays off. The score only reflects time.
+// For the memory saved, compare V8.FeedbackVectorBytes from
+// d8 --dump-counters run.js with and without --lazy-feedback-allocation.
+
+var kFunctionCount = 200;
+var source;
+
+function RunOnceSetup() {
+  var parts = [];
+  for (var i = 0; i < kFunctionCount; ++i) {
+    parts.push(
+        'function f' + i + '(o) {' +
+        '  var r = o.a + o.b;' +
+        '  if (o.c) r += o.c.length;' +
+        '  return [r, {x: o.a}];' +
+        '}');
+  }
+  parts.push('var result = 0;');
+  for (var i = 0; i < kFunctionCount; ++i) {
+    parts.push('result += f' + i + '({a: ' + i + ', b: 1, c: "abc"})[0];');
+  }
+  parts.push('result;');
+  source = parts.join('\n');
+}
+
+function RunOnce() {
+  var expected = kFunctionCount * (kFunctionCount - 1) / 2 +
+                 kFunctionCount * 4;
+  var result = (0, eval)(source);
+  if (result != expected) throw new Error('Unexpected result ' + result);
+}
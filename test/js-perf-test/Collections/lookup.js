@@ -0,0 +1,124 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups in hot loops, which TurboFan inlines into the optimized code
+// instead of calling the builtins.
+
+new BenchmarkSuite('Set-Has', [1000], [
+  new Benchmark('Smi', false, false, 0, LookupSetHasSmi, LookupSetupSetSmi,
+                LookupTearDown),
+  new Benchmark('String', false, false, 0, LookupSetHasString,
+                LookupSetupSetString, LookupTearDown),
+  new Benchmark('Object', false, false, 0, LookupSetHasObject,
+                LookupSetupSetObject, LookupTearDown),
+]);
+
+new BenchmarkSuite('WeakMap-Get', [1000], [
+  new Benchmark('Get', false, false, 0, LookupWeakMapGet, LookupSetupWeakMap,
+                LookupTearDown),
+]);
+
+new BenchmarkSuite('WeakMap-Has', [1000], [
+  new Benchmark('Has', false, false, 0, LookupWeakMapHas, LookupSetupWeakMap,
+                LookupTearDown),
+]);
+
+new BenchmarkSuite('WeakSet-Has', [1000], [
+  new Benchmark('Has', false, false, 0, LookupWeakSetHas, LookupSetupWeakSet,
+                LookupTearDown),
+]);
+
+// ----------------------------------------------------------------------------
+
+var LookupN = 1000;
+var lookupCollection;
+var lookupResult;
+
+// Only every other key is in the collection, so that half of the lookups
+// miss.
+function LookupSetupSet(setupKeys) {
+  setupKeys(LookupN);
+  lookupCollection = new Set;
+  for (var i = 0; i < LookupN; i += 2) lookupCollection.add(keys[i]);
+  lookupResult = 0;
+}
+
+function LookupSetupSetSmi() { LookupSetupSet(SetupSmiKeys); }
+function LookupSetupSetString() { LookupSetupSet(SetupStringKeys); }
+function LookupSetupSetObject() { LookupSetupSet(SetupObjectKeys); }
+
+function LookupSetupWeakMap() {
+  SetupObjectKeys(LookupN);
+  lookupCollection = new WeakMap;
+  for (var i = 0; i < LookupN; i += 2) lookupCollection.set(keys[i], i);
+  lookupResult = 0;
+}
+
+function LookupSetupWeakSet() {
+  SetupObjectKeys(LookupN);
+  lookupCollection = new WeakSet;
+  for (var i = 0; i < LookupN; i += 2) lookupCollection.add(keys[i]);
+  lookupResult = 0;
+}
+
+function LookupTearDown() {
+  lookupCollection = null;
+  return lookupResult === LookupN / 2;
+}
+
+// The Set lookups are separate functions, so that each of them only sees
+// keys of one kind.
+function LookupSetHasSmi() {
+  var set = lookupCollection;
+  var count = 0;
+  for (var i = 0; i < LookupN; i++) {
+    if (set.has(keys[i])) count++;
+  }
+  lookupResult = count;
+}
+
+function LookupSetHasString() {
+  var set = lookupCollection;
+  var count = 0;
+  for (var i = 0; i < LookupN; i++) {
+    if (set.has(keys[i])) count++;
+  }
+  lookupResult = count;
+}
+
+function LookupSetHasObject() {
+  var set = lookupCollection;
+  var count = 0;
+  for (var i = 0; i < LookupN; i++) {
+    if (set.has(keys[i])) count++;
+  }
+  lookupResult = count;
+}
+
+function LookupWeakMapGet() {
+  var wm = lookupCollection;
+  var count = 0;
+  for (var i = 0; i < LookupN; i++) {
+    if (wm.get(keys[i]) !== undefined) count++;
+  }
+  lookupResult = count;
+}
+
+function LookupWeakMapHas() {
+  var wm = lookupCollection;
+  var count = 0;
+  for (var i = 0; i < LookupN; i++) {
+    if (wm.has(keys[i])) count++;
+  }
+  lookupResult = count;
+}
+
+function LookupWeakSetHas() {
+  var ws = lookupCollection;
+  var count = 0;
+  for (var i = 0; i < LookupN; i++) {
+    if (ws.has(keys[i])) count++;
+  }
+  lookupResult = count;
+}
@@ -0,0 +1,24 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the time spent in the first execution of a hot loop, which is
+// dominated by the interpreter until on-stack replacement kicks in. Every
+// run compiles a fresh function so that no OSR code can be reused.
+
+new BenchmarkSuite('OSR-HotLoop', [1000], [
+  new Benchmark('OSR-HotLoop', false, false, 0, HotLoop),
+]);
+
+var osrFunctionCount = 0;
+
+function HotLoop() {
+  const f = new Function('n', `
+    // ${osrFunctionCount++}
+    let sum = 0;
+    for (let i = 0; i < n; i++) {
+      sum = (sum + i * 7) % 1048573;
+    }
+    return sum;`);
+  if (f(200000) !== 124478) throw new Error('Unexpected result');
+}
@@ -4,6 +4,7 @@
 
 load('../base.js');
 load('for_loop.js');
+load('osr_loop.js');
 
 var success = true;
 
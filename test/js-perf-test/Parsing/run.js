@@ -11,6 +11,8 @@ let code;
 load("comments.js");
 load("strings.js");
 load("arrowfunctions.js")
+load("tokens.js");
+load("toplevelfunctions.js");
 
 var success = true;
 
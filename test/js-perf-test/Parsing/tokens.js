@@ -0,0 +1,65 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Scanner throughput on runs of identifier, whitespace and string literal
+// characters. Run with --no-vectorized-scanner to compare against the
+// scalar scanner, and with --no-scan-one-byte-in-place to compare against
+// widening the one-byte sources into UTF-16 before scanning them.
+
+new BenchmarkSuite("LongIdentifiers", [1000], [
+  new Benchmark("LongIdentifiers", false, true, iterations, Run, LongIdentifiersSetup)
+]);
+
+new BenchmarkSuite("IndentedCode", [1000], [
+  new Benchmark("IndentedCode", false, true, iterations, Run, IndentedCodeSetup)
+]);
+
+new BenchmarkSuite("MinifiedCode", [1000], [
+  new Benchmark("MinifiedCode", false, true, iterations, Run, MinifiedCodeSetup)
+]);
+
+new BenchmarkSuite("LargeAsciiScript", [1000], [
+  new Benchmark("LargeAsciiScript", false, true, iterations, Run, LargeAsciiScriptSetup)
+]);
+
+function LongIdentifiersSetup() {
+  code = "var someRatherLongVariableName = 0, anotherFairlyLongName = 1;\n" +
+      "someRatherLongVariableName += anotherFairlyLongName;\n".repeat(300);
+  %FlattenString(code);
+}
+
+function IndentedCodeSetup() {
+  code = "function f() {\n" +
+      "        if (true) {\n                return 'indented';\n        }\n"
+          .repeat(300) +
+      "}";
+  %FlattenString(code);
+}
+
+function LargeAsciiScriptSetup() {
+  var parts = [];
+  for (var i = 0; i < 500; ++i) {
+    parts.push(
+        "// Module " + i + " of a large script.\n" +
+        "function module" + i + "(exports, require) {\n" +
+        "  var options = {name: 'module" + i + "', retries: 3};\n" +
+        "  /* Functions are only preparsed, which is mostly scanning. */\n" +
+        "  function initialize(config) {\n" +
+        "    if (config.enabled && config.name !== \"disabled\") {\n" +
+        "      return config.retries * 2 + " + i + ";\n" +
+        "    }\n" +
+        "    return null;\n" +
+        "  }\n" +
+        "  exports.initialize = initialize;\n" +
+        "}\n");
+  }
+  code = parts.join("");
+  %FlattenString(code);
+}
+
+function MinifiedCodeSetup() {
+  code = ("var a=function(b,c){return b.d?c(\"minified string literal\"):" +
+      "b.e+'another string literal'};").repeat(300);
+  %FlattenString(code);
+}
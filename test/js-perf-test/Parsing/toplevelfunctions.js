@@ -0,0 +1,46 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Parsing a large script that consists of lazily compiled top-level
+// functions, like a bundle of modules. Run with --parallel-preparse to
+// preparse the functions on worker threads.
+
+new BenchmarkSuite("ToplevelFunctions", [1000], [
+  new Benchmark("ToplevelFunctions", false, true, iterations, RunScript,
+                ToplevelFunctionsSetup)
+]);
+
+let scriptCount = 0;
+
+function ToplevelFunctionsSetup() {
+  var parts = [];
+  for (var i = 0; i < 400; ++i) {
+    parts.push(
+        "function module" + i + "(exports, require) {\n" +
+        "  var cache = new Map();\n" +
+        "  function lookup(key, compute) {\n" +
+        "    if (cache.has(key)) return cache.get(key);\n" +
+        "    var value = compute(key, function(x) { return x + " + i +
+        "; });\n" +
+        "    cache.set(key, value);\n" +
+        "    return value;\n" +
+        "  }\n" +
+        "  for (var j = 0; j < 10; ++j) {\n" +
+        "    exports['entry' + j] = { index: j, kind: /^entry\\d+$/ };\n" +
+        "  }\n" +
+        "  exports.lookup = lookup;\n" +
+        "  return `module ${" + i + "} ready`;\n" +
+        "}\n");
+  }
+  code = parts.join("");
+}
+
+function RunScript() {
+  if (code == undefined) {
+    throw new Error("No test data");
+  }
+  // A unique comment keeps the script from being found in the isolate's
+  // compilation cache.
+  Realm.eval(Realm.current(), "// " + scriptCount++ + "\n" + code);
+}
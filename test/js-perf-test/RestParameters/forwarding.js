@@ -0,0 +1,106 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ForwardApplyRest', [1000], [
+  new Benchmark('ForwardApplyRest', false, false, 0,
+                ForwardApplyRest, ForwardSetup, ForwardTearDown)
+]);
+
+new BenchmarkSuite('ForwardApplyArguments', [1000], [
+  new Benchmark('ForwardApplyArguments', false, false, 0,
+                ForwardApplyArguments, ForwardSetup, ForwardTearDown)
+]);
+
+new BenchmarkSuite('ForwardReflectApply', [1000], [
+  new Benchmark('ForwardReflectApply', false, false, 0,
+                ForwardReflectApply, ForwardSetup, ForwardTearDown)
+]);
+
+new BenchmarkSuite('ForwardCall', [1000], [
+  new Benchmark('ForwardCall', false, false, 0,
+                ForwardCall, ForwardSetup, ForwardTearDown)
+]);
+
+new BenchmarkSuite('Middleware', [1000], [
+  new Benchmark('Middleware', false, false, 0,
+                Middleware, ForwardSetup, ForwardTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+var result;
+var iterations = 1000;
+
+function add3(a, b, c) { return a + b + c; }
+
+function wrapApplyRest(fn) {
+  return function(...args) { return fn.apply(this, args); };
+}
+
+function wrapApplyArguments(fn) {
+  return function() { return fn.apply(this, arguments); };
+}
+
+function wrapReflectApply(fn) {
+  return function(...args) { return Reflect.apply(fn, this, args); };
+}
+
+function wrapCall(fn) {
+  return function(a, b, c) { return fn.call(this, a, b, c); };
+}
+
+var forwardApplyRest = wrapApplyRest(add3);
+var forwardApplyArguments = wrapApplyArguments(add3);
+var forwardReflectApply = wrapReflectApply(add3);
+var forwardCall = wrapCall(add3);
+
+// A chain of middleware, each of which forwards its arguments to the next.
+function compose(handler, ...middleware) {
+  return middleware.reduceRight(function(next, layer) {
+    return function(...args) { return layer.call(this, next, args); };
+  }, handler);
+}
+
+function logLayer(next, args) { return next.apply(this, args); }
+function countLayer(next, args) { return next.apply(this, args) + 1; }
+
+var middleware = compose(add3, logLayer, countLayer, logLayer);
+
+function ForwardSetup() {
+  result = 0;
+}
+
+function ForwardApplyRest() {
+  for (var i = 0; i < iterations; ++i) {
+    result += forwardApplyRest(i, 1, 2);
+  }
+}
+
+function ForwardApplyArguments() {
+  for (var i = 0; i < iterations; ++i) {
+    result += forwardApplyArguments(i, 1, 2);
+  }
+}
+
+function ForwardReflectApply() {
+  for (var i = 0; i < iterations; ++i) {
+    result += forwardReflectApply(i, 1, 2);
+  }
+}
+
+function ForwardCall() {
+  for (var i = 0; i < iterations; ++i) {
+    result += forwardCall(i, 1, 2);
+  }
+}
+
+function Middleware() {
+  for (var i = 0; i < iterations; ++i) {
+    result += middleware(i, 1, 2) - 1;
+  }
+}
+
+function ForwardTearDown() {
+  return result > 0;
+}
@@ -5,6 +5,7 @@
 
 load('../base.js');
 load('rest.js');
+load('forwarding.js');
 
 var success = true;
 
@@ -5,6 +5,7 @@
 
 load('../base.js');
 load('with.js');
+load('script-context.js');
 
 var success = true;
 
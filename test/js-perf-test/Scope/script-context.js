@@ -0,0 +1,58 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ScriptContext', [1000], [
+  new Benchmark('ConstBinding', false, false, 0,
+                ConstBinding, ScriptContextSetup, ScriptContextTearDown),
+  new Benchmark('UnmodifiedLetBinding', false, false, 0,
+                UnmodifiedLetBinding, ScriptContextSetup,
+                ScriptContextTearDown),
+  new Benchmark('ModifiedLetBinding', false, false, 0,
+                ModifiedLetBinding, ScriptContextSetup,
+                ScriptContextTearDown)
+]);
+
+const kConstTable = [1, 2, 3, 5, 8, 13, 21, 34];
+let unmodifiedTable = [1, 2, 3, 5, 8, 13, 21, 34];
+let modifiedTable = [];
+modifiedTable = [1, 2, 3, 5, 8, 13, 21, 34];
+
+let scriptContextResult;
+const kExpectedSum = 8700;
+
+// ----------------------------------------------------------------------------
+
+function ScriptContextSetup() {
+  scriptContextResult = 0;
+}
+
+function ScriptContextTearDown() {
+  return scriptContextResult === kExpectedSum;
+}
+
+function ConstBinding() {
+  let sum = 0;
+  for (let i = 0; i < 100; ++i) {
+    for (let j = 0; j < kConstTable.length; ++j) sum += kConstTable[j];
+  }
+  scriptContextResult = sum;
+}
+
+function UnmodifiedLetBinding() {
+  let sum = 0;
+  for (let i = 0; i < 100; ++i) {
+    for (let j = 0; j < unmodifiedTable.length; ++j) {
+      sum += unmodifiedTable[j];
+    }
+  }
+  scriptContextResult = sum;
+}
+
+function ModifiedLetBinding() {
+  let sum = 0;
+  for (let i = 0; i < 100; ++i) {
+    for (let j = 0; j < modifiedTable.length; ++j) sum += modifiedTable[j];
+  }
+  scriptContextResult = sum;
+}
@@ -0,0 +1,53 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('StreamingCompile', [1000], [
+  new Benchmark('Bundle', false, false, 0, CompileBundle, CompileBundleSetup)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Compiles a bundle of a few megabytes the way a page loads its scripts. Run with
+// --streaming-compile, d8 compiles the source passed to Realm.eval through
+// the streaming API on a background thread. Every module of the bundle is
+// wrapped in parentheses, so its function is compiled eagerly together with
+// the top-level code, which is what --parallel-streaming-compile spreads
+// across worker threads.
+
+var kModuleCount = 4000;
+var source;
+
+function CompileBundleSetup() {
+  var parts = ['var modules = [];'];
+  for (var i = 0; i < kModuleCount; ++i) {
+    parts.push(
+        'modules.push((function(exports) {' +
+        '  var cache = {};' +
+        '  function helper' + i + '(a, b) {' +
+        '    if (cache[a] !== undefined) return cache[a];' +
+        '    var r = [];' +
+        '    for (var j = 0; j < b; ++j) r.push({key: a + j, value: j * 2});' +
+        '    return cache[a] = r;' +
+        '  }' +
+        '  var table = [' + i + ', 1, 2, 3, 5, 8, 13, 21, 34, 55];' +
+        '  var names = {first: "a' + i + '", second: "b", third: "c"};' +
+        '  for (var k = 0; k < table.length; ++k) {' +
+        '    if (table[k] % 2 == 0) names["even" + k] = table[k];' +
+        '    else names["odd" + k] = table[k] * 3;' +
+        '  }' +
+        '  exports.run = function(x) {' +
+        '    return helper' + i + '(x, table.length).length + names.first;' +
+        '  };' +
+        '  exports.id = ' + i + ';' +
+        '  return exports;' +
+        '}));');
+  }
+  parts.push('modules.length;');
+  source = parts.join('\n');
+}
+
+function CompileBundle() {
+  var result = Realm.eval(Realm.current(), source);
+  if (result != kModuleCount) throw new Error('Unexpected result ' + result);
+}
@@ -0,0 +1,84 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Request routing and header parsing, which lean on startsWith, endsWith,
+// includes, split and trim.
+
+new BenchmarkSuite('StringProcessingRouting', [5], [
+  new Benchmark('StringProcessingRouting', true, false, 0, Routing),
+]);
+
+new BenchmarkSuite('StringProcessingHeaders', [5], [
+  new Benchmark('StringProcessingHeaders', true, false, 0, Headers),
+]);
+
+new BenchmarkSuite('StringProcessingTrim', [5], [
+  new Benchmark('StringProcessingTrim', true, false, 0, Trim),
+]);
+
+const paths = [
+  "/api/v1/users/42",
+  "/api/v1/orders?limit=10",
+  "/static/css/site.css",
+  "/static/js/app.js",
+  "/index.html",
+  "/favicon.ico",
+  "/api/v2/search?q=v8",
+  "/healthz",
+];
+
+const request = [
+  "Host: example.com",
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64)",
+  "Accept: text/html,application/xhtml+xml",
+  "Accept-Encoding: gzip, deflate, br",
+  "Connection: keep-alive",
+  "Cache-Control: max-age=0",
+  "Content-Type: application/json; charset=utf-8",
+  "X-Request-Id: 4f1e2a9c",
+];
+
+const padded = [
+  "  value  ",
+  "\tkeep-alive\r\n",
+  "no-padding",
+  "   ",
+  " gzip, deflate",
+  "text/html \n",
+];
+
+function Routing() {
+  let api = 0, assets = 0, queries = 0;
+  for (let i = 0; i < 100; ++i) {
+    for (let j = 0; j < paths.length; ++j) {
+      const path = paths[j];
+      if (path.startsWith("/api/")) ++api;
+      if (path.endsWith(".js") || path.endsWith(".css")) ++assets;
+      if (path.includes("?")) ++queries;
+    }
+  }
+  return api + assets + queries;
+}
+
+function Headers() {
+  let length = 0;
+  for (let i = 0; i < 50; ++i) {
+    for (let j = 0; j < request.length; ++j) {
+      const parts = request[j].split(": ");
+      if (parts[0].startsWith("Content")) length += parts[1].length;
+      length += parts[1].split(",").length;
+    }
+  }
+  return length;
+}
+
+function Trim() {
+  let length = 0;
+  for (let i = 0; i < 100; ++i) {
+    for (let j = 0; j < padded.length; ++j) {
+      length += padded[j].trim().length;
+    }
+  }
+  return length;
+}
@@ -0,0 +1,32 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function minMax(a, b) {
+  return a < b ? [a, b] : [b, a];
+}
+
+function ArrayDestructuring() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) {
+    const [min, max] = minMax(i, 1000 - i);
+    result += max - min;
+  }
+  return result;
+}
+
+function divMod(a, b, c) {
+  return [a / b | 0, a % b, c];
+}
+
+function TupleReturn() {
+  let result = 0;
+  for (let i = 0; i < 1000; ++i) {
+    const t = divMod(i, 7, 3);
+    result += t[i % 3];
+  }
+  return result;
+}
+
+createSuite('ArrayDestructuring', 1000, ArrayDestructuring);
+createSuite('TupleReturn', 1000, TupleReturn);
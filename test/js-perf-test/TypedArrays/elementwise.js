@@ -0,0 +1,52 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Float32Scale', [1000], [
+  new Benchmark('Float32Scale', false, false, 0, Float32Scale),
+]);
+new BenchmarkSuite('Float32Add', [1000], [
+  new Benchmark('Float32Add', false, false, 0, Float32Add),
+]);
+new BenchmarkSuite('Int32Add', [1000], [
+  new Benchmark('Int32Add', false, false, 0, Int32Add),
+]);
+new BenchmarkSuite('Int32Sum', [1000], [
+  new Benchmark('Int32Sum', false, false, 0, Int32Sum),
+]);
+
+const kLength = 4096;
+
+let f32_a = new Float32Array(kLength);
+let f32_b = new Float32Array(kLength);
+let f32_out = new Float32Array(kLength);
+let i32_a = new Int32Array(kLength);
+let i32_b = new Int32Array(kLength);
+let i32_out = new Int32Array(kLength);
+
+for (let i = 0; i < kLength; ++i) {
+  f32_a[i] = i * 0.5;
+  f32_b[i] = kLength - i;
+  i32_a[i] = i;
+  i32_b[i] = kLength - i;
+}
+
+function Float32Scale() {
+  for (let i = 0; i < kLength; ++i) f32_out[i] = f32_a[i] * 1.5;
+}
+
+function Float32Add() {
+  for (let i = 0; i < kLength; ++i) f32_out[i] = f32_a[i] + f32_b[i];
+}
+
+function Int32Add() {
+  for (let i = 0; i < kLength; ++i) i32_out[i] = i32_a[i] + i32_b[i];
+}
+
+function Int32Sum() {
+  let sum = 0;
+  for (let i = 0; i < kLength; ++i) sum = (sum + i32_a[i]) | 0;
+  if (sum !== ((kLength * (kLength - 1) / 2) | 0)) {
+    throw new Error("Unexpected result: " + sum);
+  }
+}
@@ -0,0 +1,54 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the first run of a numeric workload, which is dominated by
+// collecting type feedback before TurboFan kicks in. Run it repeatedly with
+// d8 --type-feedback-cache=<file> to compare a cold start with a warm start
+// from the feedback persisted by the previous run.
+
+new BenchmarkSuite('WarmStart', [1000], [
+  new Benchmark('WarmStart', false, true, 1, WarmStart),
+]);
+
+function Vec(x, y, z) {
+  this.x = x;
+  this.y = y;
+  this.z = z;
+}
+
+function dot(a, b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+function scale(a, s) {
+  return new Vec(a.x * s, a.y * s, a.z * s);
+}
+
+function add(a, b) {
+  return new Vec(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+
+function step(particles, dt) {
+  var energy = 0;
+  for (var i = 0; i < particles.length; i++) {
+    var p = particles[i];
+    p.pos = add(p.pos, scale(p.vel, dt));
+    if (p.pos.y < 0) p.vel = new Vec(p.vel.x, -p.vel.y, p.vel.z);
+    energy += dot(p.vel, p.vel) / 2;
+  }
+  return energy;
+}
+
+function WarmStart() {
+  var particles = [];
+  for (var i = 0; i < 100; i++) {
+    particles.push({
+      pos: new Vec(i, i % 7, i % 3),
+      vel: new Vec(0.5, -0.25 * (i % 5), 0.125)
+    });
+  }
+  var energy = 0;
+  for (var t = 0; t < 500; t++) energy += step(particles, 0.01);
+  if (!(energy > 0)) throw new Error('Unexpected energy ' + energy);
+}
@@ -0,0 +1,142 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Inlined functions have no frame of their own, so %GetOptimizationStatus
+// only reports add3 as executing when it was called rather than inlined.
+var inlined = false;
+function add3(a, b, c) {
+  inlined = (%GetOptimizationStatus(add3) &
+             V8OptimizationStatus.kIsExecuting) === 0;
+  return a + b + c;
+}
+
+// Test Function.prototype.apply forwarding a rest parameter.
+(function() {
+  function wrap(fn) {
+    return function(...args) { return fn.apply(this, args); };
+  }
+  const forward = wrap(add3);
+  function foo(a) { return forward(a, 1, 2); }
+
+  assertEquals(3, foo(0));
+  assertEquals(4, foo(1));
+  assertFalse(inlined);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(5, foo(2));
+  assertOptimized(foo);
+  assertTrue(inlined);
+})();
+
+// Test Function.prototype.apply forwarding the arguments object.
+(function() {
+  function wrap(fn) {
+    return function() { return fn.apply(this, arguments); };
+  }
+  const forward = wrap(add3);
+  function foo(a) { return forward(a, 1, 2); }
+
+  assertEquals(3, foo(0));
+  assertEquals(4, foo(1));
+  assertFalse(inlined);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(5, foo(2));
+  assertOptimized(foo);
+  assertTrue(inlined);
+})();
+
+// Test Reflect.apply forwarding a rest parameter.
+(function() {
+  function wrap(fn) {
+    return function(...args) { return Reflect.apply(fn, this, args); };
+  }
+  const forward = wrap(add3);
+  function foo(a) { return forward(a, 1, 2); }
+
+  assertEquals(3, foo(0));
+  assertEquals(4, foo(1));
+  assertFalse(inlined);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(5, foo(2));
+  assertOptimized(foo);
+  assertTrue(inlined);
+})();
+
+// Test Function.prototype.call forwarding its parameters and the receiver.
+(function() {
+  function wrap(fn) {
+    return function(a, b, c) { return fn.call(this, a, b, c); };
+  }
+  const o = {x: 1, f: wrap(function(a, b, c) { return this.x + a + b + c; })};
+  function foo(a) { return o.f(a, 1, 2); }
+
+  assertEquals(4, foo(0));
+  assertEquals(5, foo(1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo(2));
+  assertOptimized(foo);
+})();
+
+// Test that a forwarder whose target changes deoptimizes and then keeps
+// working with the other target.
+(function() {
+  function forward(fn, ...args) { return fn.apply(undefined, args); }
+  function sub3(a, b, c) { return a - b - c; }
+  function foo(fn, a) { return forward(fn, a, 1, 2); }
+
+  assertEquals(3, foo(add3, 0));
+  assertEquals(4, foo(add3, 1));
+  assertFalse(inlined);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(5, foo(add3, 2));
+  assertOptimized(foo);
+  assertTrue(inlined);
+  assertEquals(-3, foo(sub3, 0));
+  assertUnoptimized(foo);
+  assertEquals(-2, foo(sub3, 1));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo(add3, 3));
+  assertEquals(0, foo(sub3, 3));
+  assertOptimized(foo);
+})();
+
+// Test a chain of middleware that forwards its arguments.
+(function() {
+  function compose(handler, ...middleware) {
+    return middleware.reduceRight(function(next, layer) {
+      return function(...args) { return layer.call(this, next, args); };
+    }, handler);
+  }
+  function pass(next, args) { return next.apply(this, args); }
+  function inc(next, args) { return next.apply(this, args) + 1; }
+  const chain = compose(add3, pass, inc, pass);
+  function foo(a) { return chain(a, 1, 2); }
+
+  assertEquals(4, foo(0));
+  assertEquals(5, foo(1));
+  assertFalse(inlined);
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo(2));
+  assertOptimized(foo);
+  assertTrue(inlined);
+})();
+
+// Test that the receiver and missing arguments are forwarded correctly.
+(function() {
+  function wrap(fn) {
+    return function(...args) { return fn.apply(this, args); };
+  }
+  const o = {
+    x: 10,
+    f: wrap(function(a, b) { return [this.x, a, b, arguments.length]; })
+  };
+  function foo() { return o.f(1); }
+
+  assertEquals([10, 1, undefined, 1], foo());
+  assertEquals([10, 1, undefined, 1], foo());
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals([10, 1, undefined, 1], foo());
+  assertOptimized(foo);
+})();
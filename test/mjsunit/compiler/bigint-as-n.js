@@ -0,0 +1,93 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Test BigInt.asUintN(64, x).
+(function() {
+  function f(x) { return BigInt.asUintN(64, x); }
+
+  function test() {
+    assertEquals(0n, f(0n));
+    assertEquals(1n, f(1n));
+    assertEquals(2n ** 64n - 1n, f(-1n));
+    assertEquals(2n ** 63n, f(-(2n ** 63n)));
+    assertEquals(2n ** 64n - 1n, f(2n ** 64n - 1n));
+    assertEquals(0n, f(2n ** 64n));
+    assertEquals(0n, f(-(2n ** 64n)));
+    assertEquals(1n, f(2n ** 64n + 1n));
+    assertEquals(2n ** 64n - 1n, f(-(2n ** 64n) - 1n));
+    assertEquals(5n, f(2n ** 128n + 5n));
+    assertEquals(2n ** 64n - 5n, f(-(2n ** 128n) - 5n));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(f);
+  test();
+  assertOptimized(f);
+
+  // Values that fit are returned unchanged.
+  const big = 2n ** 64n - 2n;
+  assertSame(big, f(big));
+
+  // Non-BigInt inputs deoptimize.
+  assertEquals(1n, f(true));
+  assertUnoptimized(f);
+})();
+
+// Test BigInt.asIntN(64, x).
+(function() {
+  function f(x) { return BigInt.asIntN(64, x); }
+
+  function test() {
+    assertEquals(0n, f(0n));
+    assertEquals(1n, f(1n));
+    assertEquals(-1n, f(-1n));
+    assertEquals(2n ** 63n - 1n, f(2n ** 63n - 1n));
+    assertEquals(-(2n ** 63n), f(2n ** 63n));
+    assertEquals(-(2n ** 63n), f(-(2n ** 63n)));
+    assertEquals(2n ** 63n - 1n, f(-(2n ** 63n) - 1n));
+    assertEquals(-1n, f(2n ** 64n - 1n));
+    assertEquals(1n, f(-(2n ** 64n) + 1n));
+    assertEquals(0n, f(2n ** 64n));
+    assertEquals(0n, f(-(2n ** 64n)));
+    assertEquals(-5n, f(2n ** 128n - 5n));
+    assertEquals(5n, f(-(2n ** 128n) + 5n));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(f);
+  test();
+  assertOptimized(f);
+
+  const min = -(2n ** 63n);
+  assertSame(min, f(min));
+})();
+
+// Test that other widths keep calling the builtin.
+(function() {
+  function f(x) { return BigInt.asUintN(32, x); }
+
+  assertEquals(2n ** 32n - 1n, f(-1n));
+  assertEquals(2n ** 32n - 1n, f(-1n));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2n ** 32n - 1n, f(-1n));
+  assertEquals(1n, f(true));
+  assertOptimized(f);
+})();
+
+// Test wrapping arithmetic.
+(function() {
+  function add(a, b) { return BigInt.asUintN(64, a + b); }
+
+  assertEquals(0n, add(2n ** 64n - 1n, 1n));
+  assertEquals(0n, add(2n ** 64n - 1n, 1n));
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(0n, add(2n ** 64n - 1n, 1n));
+  assertEquals(2n ** 64n - 2n, add(2n ** 64n - 1n, 2n ** 64n - 1n));
+  assertEquals(3n, add(1n, 2n));
+  assertOptimized(add);
+})();
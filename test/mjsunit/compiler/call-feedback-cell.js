@@ -0,0 +1,85 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Test that calls to different closures created by the same closure
+// instantiation site are optimized and inlined.
+(function() {
+  function apply(fn, x) { return fn(x); }
+
+  function make(offset) { return x => x + offset; }
+
+  assertEquals(1, apply(make(1), 0));
+  assertEquals(2, apply(make(2), 0));
+  assertEquals(3, apply(make(3), 0));
+  %OptimizeFunctionOnNextCall(apply);
+  assertEquals(4, apply(make(4), 0));
+  assertOptimized(apply);
+  assertEquals(15, apply(make(5), 10));
+  assertOptimized(apply);
+
+  // A closure from a different instantiation site deopts.
+  assertEquals(20, apply(x => x * 2, 10));
+  assertUnoptimized(apply);
+  assertEquals(16, apply(make(6), 10));
+})();
+
+// Test closures created in a loop within the optimized function.
+(function() {
+  function each(array, fn) {
+    for (let i = 0; i < array.length; ++i) fn(array[i]);
+  }
+
+  function sum(array) {
+    let result = 0;
+    for (let i = 0; i < array.length; ++i) {
+      const scale = i;
+      each(array, x => { result += x * scale; });
+    }
+    return result;
+  }
+
+  assertEquals(3, sum([1, 2]));
+  assertEquals(3, sum([1, 2]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(3, sum([1, 2]));
+  assertEquals(18, sum([1, 2, 3]));
+  assertOptimized(sum);
+})();
+
+// Test that non-function targets still throw.
+(function() {
+  function call(fn) { return fn(); }
+
+  function make(value) { return () => value; }
+
+  assertEquals(1, call(make(1)));
+  assertEquals(2, call(make(2)));
+  %OptimizeFunctionOnNextCall(call);
+  assertEquals(3, call(make(3)));
+  assertThrows(() => call(1), TypeError);
+  assertThrows(() => call({}), TypeError);
+  assertEquals(4, call(make(4)));
+})();
+
+// Test that instanceof with several closures of the same function does not
+// record their shared feedback cell.
+(function() {
+  function make() { return function C() {}; }
+
+  function test(o, C) { return o instanceof C; }
+
+  const C1 = make();
+  const C2 = make();
+  const C3 = make();
+  assertTrue(test(new C1, C1));
+  assertFalse(test(new C1, C2));
+  assertTrue(test(new C2, C2));
+  %OptimizeFunctionOnNextCall(test);
+  assertTrue(test(new C3, C3));
+  assertFalse(test(new C3, C1));
+  assertFalse(test({}, C2));
+  assertTrue(test(new C1, C1));
+})();
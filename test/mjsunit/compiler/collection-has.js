@@ -0,0 +1,142 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+
+// Test Set.prototype.has with small integer keys, which takes the inlined
+// Int32 hash lookup, and with other keys, which call into the builtin.
+(function() {
+  const set = new Set([1, 2, -0, 3.5, "a", NaN]);
+  const o = {};
+  set.add(o);
+
+  function has(s, k) { return s.has(k); }
+
+  function test() {
+    assertTrue(has(set, 1));
+    assertTrue(has(set, 2));
+    assertTrue(has(set, 0));
+    assertTrue(has(set, -0));
+    assertTrue(has(set, 3.5));
+    assertTrue(has(set, "a"));
+    assertTrue(has(set, NaN));
+    assertTrue(has(set, o));
+    assertFalse(has(set, 4));
+    assertFalse(has(set, "b"));
+    assertFalse(has(set, {}));
+    assertFalse(has(set, undefined));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(has);
+  test();
+  assertOptimized(has);
+})();
+
+(function() {
+  const set = new Set();
+  for (let i = 0; i < 100; ++i) set.add(i * 3);
+
+  function count(s, n) {
+    let result = 0;
+    for (let i = 0; i < n; ++i) {
+      if (s.has(i)) ++result;
+    }
+    return result;
+  }
+
+  assertEquals(34, count(set, 100));
+  assertEquals(34, count(set, 100));
+  %OptimizeFunctionOnNextCall(count);
+  assertEquals(34, count(set, 100));
+  assertEquals(100, count(set, 400));
+  assertOptimized(count);
+})();
+
+// Test Map.prototype.get and Set.prototype.has with constant string keys,
+// which take the inlined string hash lookup. Keys that are not internalized
+// are compared by the builtin.
+(function() {
+  const cons = ["fo", "o"].join("");
+  const map = new Map([["a", 1], [cons, 2], [1, "one"]]);
+  const set = new Set(["a", cons, Symbol.iterator]);
+
+  function getA(m) { return m.get("a"); }
+  function getFoo(m) { return m.get("foo"); }
+  function getBar(m) { return m.get("bar"); }
+  function hasA(s) { return s.has("a"); }
+  function hasFoo(s) { return s.has("foo"); }
+  function hasBar(s) { return s.has("bar"); }
+
+  function test() {
+    assertEquals(1, getA(map));
+    assertEquals(2, getFoo(map));
+    assertEquals(undefined, getBar(map));
+    assertTrue(hasA(set));
+    assertTrue(hasFoo(set));
+    assertFalse(hasBar(set));
+  }
+
+  test();
+  test();
+  for (const f of [getA, getFoo, getBar, hasA, hasFoo, hasBar]) {
+    %OptimizeFunctionOnNextCall(f);
+  }
+  test();
+  for (const f of [getA, getFoo, getBar, hasA, hasFoo, hasBar]) {
+    assertOptimized(f);
+  }
+
+  // Mutations after optimization are observed.
+  map.delete("a");
+  set.delete(cons);
+  map.set("bar", 3);
+  assertEquals(undefined, getA(map));
+  assertFalse(hasFoo(set));
+  assertEquals(3, getBar(map));
+})();
+
+// Test WeakMap.prototype.get / has and WeakSet.prototype.has.
+(function() {
+  const k1 = {}, k2 = {}, k3 = [];
+  const wm = new WeakMap([[k1, 1], [k2, "two"]]);
+  const ws = new WeakSet([k1, k3]);
+
+  function get(m, k) { return m.get(k); }
+  function mhas(m, k) { return m.has(k); }
+  function shas(s, k) { return s.has(k); }
+
+  function test() {
+    assertEquals(1, get(wm, k1));
+    assertEquals("two", get(wm, k2));
+    assertEquals(undefined, get(wm, k3));
+    assertEquals(undefined, get(wm, 1));
+    assertEquals(undefined, get(wm, "a"));
+    assertTrue(mhas(wm, k1));
+    assertFalse(mhas(wm, k3));
+    assertFalse(mhas(wm, 1));
+    assertTrue(shas(ws, k1));
+    assertTrue(shas(ws, k3));
+    assertFalse(shas(ws, k2));
+    assertFalse(shas(ws, null));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(get);
+  %OptimizeFunctionOnNextCall(mhas);
+  %OptimizeFunctionOnNextCall(shas);
+  test();
+  assertOptimized(get);
+  assertOptimized(mhas);
+  assertOptimized(shas);
+
+  // Mutations after optimization are observed.
+  wm.set(k3, 3);
+  ws.delete(k1);
+  assertEquals(3, get(wm, k3));
+  assertTrue(mhas(wm, k3));
+  assertFalse(shas(ws, k1));
+})();
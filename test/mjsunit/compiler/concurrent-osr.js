@@ -0,0 +1,99 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+
+// The loops keep running in the interpreter while the OSR code is compiled
+// in the background, and enter it at the back edge once it is ready.
+function simple(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    sum = (sum + i * 7) % 1048573;
+  }
+  return sum;
+}
+
+assertEquals(124478, simple(200000));
+assertEquals(124478, simple(200000));
+
+function nested(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    for (var j = 0; j < 100; j++) {
+      sum = (sum + i * j) % 65521;
+    }
+  }
+  return sum;
+}
+
+var expected = 0;
+for (var i = 0; i < 5000; i++) {
+  for (var j = 0; j < 100; j++) expected = (expected + i * j) % 65521;
+}
+assertEquals(expected, nested(5000));
+assertEquals(expected, nested(5000));
+
+// Multiple OSR requests from different closures of the same function.
+function makeCounter(step) {
+  return function(n) {
+    var count = 0;
+    for (let i = 0; i < n; i += step) count++;
+    return count;
+  };
+}
+
+for (var step = 1; step <= 4; step++) {
+  assertEquals(Math.ceil(300000 / step), makeCounter(step)(300000));
+}
+
+// Explicitly requested OSR goes through the same concurrent path.
+function manual() {
+  var sum = 0;
+  for (var i = 0; i < 100000; i++) {
+    sum += i & 0xff;
+    if (i == 50) %OptimizeOsr();
+  }
+  return sum;
+}
+
+assertEquals(12742320, manual());
+assertEquals(12742320, manual());
+
+// Entering the loop again picks up the OSR code cached in the native
+// context instead of compiling it again.
+function reentered(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    sum = (sum + (i ^ 0x55)) % 65521;
+  }
+  return sum;
+}
+
+var reentered_expected = reentered(100000);
+for (var k = 0; k < 5; k++) {
+  assertEquals(reentered_expected, reentered(100000));
+}
+
+// The OSR code is compiled concurrently: the loop is still interpreted right
+// after the request and only enters the OSR code once the job has finished.
+function observed() {
+  var interpreted_after_request;
+  var osr_entered = false;
+  for (var i = 0; i < 10000000 && !osr_entered; i++) {
+    var status = %GetOptimizationStatus(observed, "no sync");
+    var topmost_turbofanned =
+        (status & V8OptimizationStatus.kTopmostFrameIsTurboFanned) !== 0;
+    if (i == 50) %OptimizeOsr();
+    if (i == 51) interpreted_after_request = !topmost_turbofanned;
+    if (i > 51) osr_entered = topmost_turbofanned;
+  }
+  return {interpreted_after_request, osr_entered};
+}
+
+if (%IsConcurrentRecompilationSupported() && !isAlwaysOptimize() &&
+    !isNeverOptimizeLiteMode() && !isNeverOptimize()) {
+  var result = observed();
+  assertTrue(result.interpreted_after_request);
+  assertTrue(result.osr_entered);
+}
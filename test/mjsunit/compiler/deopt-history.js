@@ -0,0 +1,51 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt --max-deopts-per-site=1
+
+// Test that deopts are recorded per site, and that TurboFan stops
+// speculating at a site that deopted before.
+(function() {
+  function add(a, b) { return a + b; }
+
+  assertEquals(0, %GetDeoptHistory(add).length);
+  assertEquals(3, add(1, 2));
+  assertEquals(3, add(1, 2));
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(3, add(1, 2));
+  assertOptimized(add);
+
+  // Passing a double fails the Smi speculation on the addition.
+  assertEquals(3.5, add(1.5, 2));
+  assertUnoptimized(add);
+  const history = %GetDeoptHistory(add);
+  assertEquals(1, history.length);
+  assertEquals("number", typeof history[0][0]);
+  assertEquals("string", typeof history[0][1]);
+  assertEquals("eager", history[0][2]);
+  assertEquals(1, history[0][3]);
+
+  // The reoptimized code uses the generic addition at that site, so passing
+  // strings no longer deopts.
+  %OptimizeFunctionOnNextCall(add);
+  assertEquals(3, add(1, 2));
+  assertOptimized(add);
+  assertEquals("ab", add("a", "b"));
+  assertOptimized(add);
+  assertEquals(1, %GetDeoptHistory(add).length);
+})();
+
+// Test that deopts in inlined code are attributed to the inlined function.
+(function() {
+  function mul(a, b) { return a * b; }
+  function caller(a, b) { return mul(a, b); }
+
+  assertEquals(6, caller(2, 3));
+  assertEquals(6, caller(2, 3));
+  %OptimizeFunctionOnNextCall(caller);
+  assertEquals(6, caller(2, 3));
+  assertEquals(0.75, caller(0.5, 1.5));
+  assertEquals(1, %GetDeoptHistory(mul).length);
+  assertEquals(0, %GetDeoptHistory(caller).length);
+})();
@@ -30,3 +30,46 @@
   assertEquals("first", f(0));
   assertEquals("second", f(1));
 })();
+
+// Test variable index access to arrays with a few more elements.
+(function testSmallArrayVariableIndex() {
+  function f(i) {
+    const a = ["first", "second", "third", "fourth", "fifth"];
+    return a[i];
+  }
+
+  assertEquals("first", f(0));
+  assertEquals("third", f(2));
+  %OptimizeFunctionOnNextCall(f);
+  for (let i = 0; i < 5; ++i) {
+    assertEquals(["first", "second", "third", "fourth", "fifth"][i], f(i));
+  }
+  assertEquals(undefined, f(5));
+})();
+
+// Test variable index access to an array too big to be scalar replaced.
+(function testBigArrayVariableIndex() {
+  function f(i) {
+    const a = [0, 1, 2, 3, 4, 5, 6, 7, 8];
+    return a[i];
+  }
+
+  assertEquals(0, f(0));
+  assertEquals(8, f(8));
+  %OptimizeFunctionOnNextCall(f);
+  for (let i = 0; i < 9; ++i) assertEquals(i, f(i));
+})();
+
+// Test array destructuring of a tuple returned by an inlined helper.
+(function testTupleDestructuring() {
+  function tuple(x) { return [x, x + 1, x + 2]; }
+  function f(x) {
+    const [a, b, c] = tuple(x);
+    return a * 100 + b * 10 + c;
+  }
+
+  assertEquals(123, f(1));
+  assertEquals(234, f(2));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(345, f(3));
+})();
@@ -0,0 +1,25 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Test materialization of a scalar replaced array on deopt.
+(function testMaterializationOnDeopt() {
+  function f(i, deopt) {
+    const a = [i, i + 1, i + 2, i + 3];
+    const x = a[i & 3];
+    if (deopt) %DeoptimizeNow();
+    // Only values loaded from {a} leave the function, so {a} doesn't escape
+    // and has to be materialized from its elements on deopt.
+    return x + ":" + a[0] + "," + a[1] + "," + a[2] + "," + a[3];
+  }
+
+  assertEquals("2:1,2,3,4", f(1, false));
+  assertEquals("4:2,3,4,5", f(2, false));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals("6:3,4,5,6", f(3, false));
+  assertOptimized(f);
+  assertEquals("4:4,5,6,7", f(4, true));
+  assertUnoptimized(f);
+})();
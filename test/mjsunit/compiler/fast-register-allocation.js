@@ -0,0 +1,31 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --turbo-fast-register-allocation
+
+// Test that code compiled with the fast register allocation mode computes the
+// same results with more live values than there are registers, across loops
+// and deferred code.
+(function() {
+  function foo(a, b, n) {
+    let x0 = a + 1, x1 = a + 2, x2 = a + 3, x3 = a + 4, x4 = a + 5;
+    let x5 = b + 1, x6 = b + 2, x7 = b + 3, x8 = b + 4, x9 = b + 5;
+    let y0 = a * 0.5, y1 = b * 0.25, y2 = a * b, y3 = a - b;
+    let sum = 0;
+    for (let i = 0; i < n; ++i) {
+      sum += x0 * i + x1 - x2 + x3 * x4 - x5 + x6 * x7 - x8 + x9;
+      sum += y0 * y1 - y2 + y3;
+      if (i === 1000) throw new Error("unreachable");
+    }
+    return sum + x0 + x1 + x2 + x3 + x4 + x5 + x6 + x7 + x8 + x9 +
+        y0 + y1 + y2 + y3;
+  }
+
+  const expected = [foo(1, 2, 10), foo(3, 4, 20), foo(0.5, -1, 5)];
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(expected[0], foo(1, 2, 10));
+  assertEquals(expected[1], foo(3, 4, 20));
+  assertEquals(expected[2], foo(0.5, -1, 5));
+  assertOptimized(foo);
+})();
@@ -0,0 +1,83 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --script-context-const-tracking
+
+let scale = 3;
+let counter = 0;
+let late;
+
+// Test that a top-level let binding that is never reassigned is
+// constant-folded, and that reassigning it deoptimizes the code.
+(function() {
+  function mul(x) { return x * scale; }
+
+  assertEquals(6, mul(2));
+  assertEquals(6, mul(2));
+  %OptimizeFunctionOnNextCall(mul);
+  assertEquals(6, mul(2));
+  assertOptimized(mul);
+
+  // Any assignment makes the binding mutable, even of the same value.
+  scale = 3;
+  assertUnoptimized(mul);
+  assertEquals(9, mul(3));
+
+  scale = 4;
+  assertEquals(8, mul(2));
+
+  // The reoptimized code loads the binding, so later writes are observed.
+  %OptimizeFunctionOnNextCall(mul);
+  assertEquals(8, mul(2));
+  assertOptimized(mul);
+  scale = 5;
+  assertOptimized(mul);
+  assertEquals(10, mul(2));
+})();
+
+// Test writes from optimized code.
+(function() {
+  function inc() { return ++counter; }
+
+  assertEquals(1, inc());
+  assertEquals(2, inc());
+  %OptimizeFunctionOnNextCall(inc);
+  assertEquals(3, inc());
+  assertEquals(3, counter);
+  counter = 10;
+  assertEquals(11, inc());
+})();
+
+// Test that bindings are not folded before their first assignment, and that
+// the first assignment to a binding declared without initializer makes it
+// mutable.
+(function() {
+  function get() { return late; }
+
+  assertEquals(undefined, get());
+  %OptimizeFunctionOnNextCall(get);
+  assertEquals(undefined, get());
+  late = 1;
+  assertEquals(1, get());
+  %OptimizeFunctionOnNextCall(get);
+  assertEquals(1, get());
+  assertOptimized(get);
+  late = 2;
+  assertOptimized(get);
+  assertEquals(2, get());
+})();
+
+// Test writes from eval and compound assignments.
+(function() {
+  function mul(x) { return x * scale; }
+
+  scale = 2;
+  %OptimizeFunctionOnNextCall(mul);
+  assertEquals(4, mul(2));
+  eval("scale = 6");
+  assertEquals(12, mul(2));
+  scale += 1;
+  assertEquals(14, mul(2));
+})();
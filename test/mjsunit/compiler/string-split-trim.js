@@ -0,0 +1,58 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+
+// Test String.prototype.trim.
+(function() {
+  function trim(s) { return s.trim(); }
+
+  function test() {
+    assertEquals("value", trim("  value  "));
+    assertEquals("keep-alive", trim("\tkeep-alive\r\n"));
+    assertEquals("", trim("   "));
+    assertEquals("", trim(""));
+    assertEquals("a b", trim("a b"));
+    assertEquals("\u1234", trim("\u00a0\u1234\u2028"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(trim);
+  test();
+  assertOptimized(trim);
+})();
+
+// Test String.prototype.split with String separators.
+(function() {
+  function split(s, t) { return s.split(t); }
+
+  function test() {
+    assertEquals(["Host", "example.com"], split("Host: example.com", ": "));
+    assertEquals(["a", "b", "c"], split("a,b,c", ","));
+    assertEquals(["a", "b", "c"], split("abc", ""));
+    assertEquals([], split("", ""));
+    assertEquals([""], split("", ","));
+    assertEquals(["abc"], split("abc", ";"));
+    assertEquals(["\u1234", "\u5678"], split("\u1234-\u5678", "-"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(split);
+  test();
+  assertOptimized(split);
+
+  // The result is a fresh array every time.
+  const a = split("a,b", ",");
+  a.push("c");
+  assertEquals(["a", "b"], split("a,b", ","));
+
+  // Installing a @@split method on String.prototype deoptimizes.
+  String.prototype[Symbol.split] = function(s) { return "custom"; };
+  assertEquals("custom", split("a,b", ","));
+  assertUnoptimized(split);
+  delete String.prototype[Symbol.split];
+  assertEquals(["a", "b"], split("a,b", ","));
+})();
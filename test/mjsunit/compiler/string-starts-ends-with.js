@@ -0,0 +1,143 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt
+
+// Test String.prototype.startsWith and endsWith with short constant search
+// strings. TurboFan matches the constant before checking that it is a String
+// and compares the receiver with it character by character.
+(function() {
+  function starts(s) { return s.startsWith("ab"); }
+  function ends(s) { return s.endsWith("ab"); }
+
+  function test() {
+    assertTrue(starts("ab"));
+    assertTrue(starts("abc"));
+    assertFalse(starts("a"));
+    assertFalse(starts(""));
+    assertFalse(starts("cab"));
+    assertTrue(ends("ab"));
+    assertTrue(ends("cab"));
+    assertFalse(ends("b"));
+    assertFalse(ends(""));
+    assertFalse(ends("abc"));
+    assertTrue(starts("ab\u1234"));
+    assertTrue(ends("\u1234ab"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(starts);
+  %OptimizeFunctionOnNextCall(ends);
+  test();
+  assertOptimized(starts);
+  assertOptimized(ends);
+})();
+
+// Test the edges of the character by character comparison: the empty
+// string, which needs no comparison at all, two-byte characters in the
+// search string, and search strings of three and four characters, the
+// latter of which compares a substring instead.
+(function() {
+  function startsEmpty(s) { return s.startsWith(""); }
+  function endsEmpty(s) { return s.endsWith(""); }
+  function startsTwoByte(s) { return s.startsWith("\u1234b"); }
+  function endsTwoByte(s) { return s.endsWith("a\u1234"); }
+  function startsThree(s) { return s.startsWith("abc"); }
+  function endsFour(s) { return s.endsWith("abcd"); }
+
+  function test() {
+    assertTrue(startsEmpty(""));
+    assertTrue(startsEmpty("abc"));
+    assertTrue(endsEmpty(""));
+    assertTrue(endsEmpty("abc"));
+    assertTrue(startsTwoByte("\u1234bc"));
+    assertFalse(startsTwoByte("\u1235bc"));
+    assertFalse(startsTwoByte("\u1234"));
+    assertTrue(endsTwoByte("xa\u1234"));
+    assertFalse(endsTwoByte("xb\u1234"));
+    assertFalse(endsTwoByte("a"));
+    assertTrue(startsThree("abc"));
+    assertTrue(startsThree("abcd"));
+    assertFalse(startsThree("abd"));
+    assertFalse(startsThree("xbc"));
+    assertFalse(startsThree("ab"));
+    assertTrue(endsFour("abcd"));
+    assertTrue(endsFour("xabcd"));
+    assertFalse(endsFour("abce"));
+    assertFalse(endsFour("bcd"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(startsEmpty);
+  %OptimizeFunctionOnNextCall(endsEmpty);
+  %OptimizeFunctionOnNextCall(startsTwoByte);
+  %OptimizeFunctionOnNextCall(endsTwoByte);
+  %OptimizeFunctionOnNextCall(startsThree);
+  %OptimizeFunctionOnNextCall(endsFour);
+  test();
+  assertOptimized(startsEmpty);
+  assertOptimized(endsEmpty);
+  assertOptimized(startsTwoByte);
+  assertOptimized(endsTwoByte);
+  assertOptimized(startsThree);
+  assertOptimized(endsFour);
+})();
+
+// Test String.prototype.startsWith and endsWith with non-constant search
+// strings, which compare a substring of the receiver.
+(function() {
+  function starts(s, t) { return s.startsWith(t); }
+  function ends(s, t) { return s.endsWith(t); }
+
+  function test() {
+    assertTrue(starts("/api/v1/users", "/api/"));
+    assertFalse(starts("/static/app.js", "/api/"));
+    assertTrue(starts("abc", ""));
+    assertTrue(starts("abc", "abc"));
+    assertFalse(starts("abc", "abcd"));
+    assertTrue(ends("/static/app.js", ".js"));
+    assertFalse(ends("/static/app.css", ".js"));
+    assertTrue(ends("abc", ""));
+    assertTrue(ends("abc", "abc"));
+    assertFalse(ends("abc", "zabc"));
+    assertTrue(ends("\u1234\u5678x", "\u5678x"));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(starts);
+  %OptimizeFunctionOnNextCall(ends);
+  test();
+  assertOptimized(starts);
+  assertOptimized(ends);
+
+  // RegExp search strings still throw after deoptimization.
+  assertThrows(() => starts("abc", /a/), TypeError);
+  assertThrows(() => ends("abc", /c/), TypeError);
+})();
+
+// Test String.prototype.includes.
+(function() {
+  function includes(s, t) { return s.includes(t); }
+  function includesFrom(s, t, i) { return s.includes(t, i); }
+
+  function test() {
+    assertTrue(includes("keep-alive", "-"));
+    assertFalse(includes("keep-alive", "?"));
+    assertTrue(includes("abc", ""));
+    assertTrue(includesFrom("abcabc", "a", 1));
+    assertFalse(includesFrom("abcabc", "a", 4));
+    assertTrue(includesFrom("abc", "a", -5));
+  }
+
+  test();
+  test();
+  %OptimizeFunctionOnNextCall(includes);
+  %OptimizeFunctionOnNextCall(includesFrom);
+  test();
+  assertOptimized(includes);
+  assertOptimized(includesFrom);
+})();
@@ -0,0 +1,58 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-short-star --allow-natives-syntax --opt
+
+// Test that stores to the first registers, which use the single-byte Star
+// bytecodes, are observed by the interpreter, TurboFan and OSR.
+(function() {
+  function f(n) {
+    let a = 0, b = 1, c = 2, d = 3, e = 4, g = 5, h = 6, i = 7;
+    let j = 8, k = 9, l = 10, m = 11, o = 12, p = 13, q = 14, r = 15;
+    let s = 16, t = 17;
+    for (let x = 0; x < n; ++x) {
+      const tmp = a;
+      a = b; b = c; c = d; d = e; e = g; g = h; h = i; i = j;
+      j = k; k = l; l = m; m = o; o = p; p = q; q = r; r = s; s = t;
+      t = tmp;
+    }
+    return [a, b, c, d, e, g, h, i, j, k, l, m, o, p, q, r, s, t].join();
+  }
+
+  const expected = "3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,0,1,2";
+  assertEquals(expected, f(3));
+  assertEquals(expected, f(3));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f(3));
+  assertEquals(expected, f(18 * 100 + 3));
+})();
+
+(function() {
+  function osr() {
+    let sum = 0;
+    for (let i = 0; i < 10; ++i) {
+      const a = i, b = a + 1, c = b + 1;
+      sum += a + b + c;
+      if (i == 5) %OptimizeOsr();
+    }
+    return sum;
+  }
+  assertEquals(165, osr());
+})();
+
+// Generators save and restore the register file across suspends.
+(function() {
+  function* gen() {
+    let a = 1, b = 2, c = 3;
+    a = yield a;
+    b = yield a + b;
+    c = yield a + b + c;
+    return a + b + c;
+  }
+  const it = gen();
+  assertEquals(1, it.next().value);
+  assertEquals(12, it.next(10).value);
+  assertEquals(33, it.next(20).value);
+  assertEquals(60, it.next(30).value);
+})();
@@ -0,0 +1,120 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --stress-parallel-preparse
+
+// Compiles {source} as a script of its own, so that its lazy top-level
+// functions are preparsed on worker threads.
+function run(source) {
+  return Realm.eval(Realm.current(), source);
+}
+
+// Test the kinds of functions at the top level.
+(function() {
+  const t = run(`
+      function normal(a, b) { return a + b; }
+      function* generator() { yield 1; yield 2; }
+      async function asyncFunction(x) { return await x; }
+      async function* asyncGenerator() { yield 3; }
+      var expression = function(x) { return x * 2; };
+      var named = function inner(n) { return n ? inner(n - 1) + 1 : 0; };
+      var object = { f: function() { return 5; } };
+      var array = [function() { return 6; }];
+      ({
+        normal, generator, asyncFunction, asyncGenerator, expression, named,
+        object, array
+      });
+  `);
+  assertEquals(3, t.normal(1, 2));
+  assertEquals(2, t.normal.length);
+  assertEquals([1, 2], [...t.generator()]);
+  assertEquals(4, t.expression(2));
+  assertEquals(3, t.named(3));
+  assertEquals("inner", t.named.name);
+  assertEquals(5, t.object.f());
+  assertEquals(6, t.array[0]());
+  let async_result;
+  t.asyncFunction(7).then(v => async_result = v);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(7, async_result);
+  t.asyncGenerator().next().then(v => async_result = v.value);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(3, async_result);
+})();
+
+// Test functions next to regular expressions, templates and blocks, which
+// the scan for top-level functions has to tell apart from other tokens.
+(function() {
+  const result = run(`
+      var re = /{[}]/g; var quotient = 4 / 2 / 1;
+      var template = \`\${ { a: 1 }.a }\${ \`{\${'}'}\` }\`;
+      { function inBlock() { return 1; } }
+      if (true) { var fromIf = function() { return 2; }; }
+      function afterAll() { return re.source + quotient + template; }
+      afterAll() + inBlock() + fromIf();
+  `);
+  assertEquals("{[}]21{}12", result);
+})();
+
+// Test that the scope information of preparsed functions is kept.
+(function() {
+  const result = run(`
+      var counter = 0;
+      function makeCounter() {
+        var count = 0;
+        return function() { counter++; return ++count; };
+      }
+      function usesEval(s) { var local = 3; return eval(s); }
+      function usesArguments() { return arguments.length; }
+      var c = makeCounter();
+      c(); c();
+      [c(), counter, usesEval("local * 2"), usesArguments(1, 2, 3)];
+  `);
+  assertEquals([3, 3, 6, 3], result);
+})();
+
+// Test strict mode, both for the script and for a function.
+(function() {
+  const result = run(`
+      "use strict";
+      function strict() { return this; }
+      strict() === undefined;
+  `);
+  assertTrue(result);
+  const result2 = run(`
+      function sloppy() { return typeof this; }
+      function strict() { "use strict"; return this; }
+      [sloppy(), strict()];
+  `);
+  assertEquals(["object", undefined], result2);
+  assertThrows(() => run(`
+      function f() { "use strict"; return 010; }
+  `), SyntaxError);
+  assertThrows(() => run(`
+      "use strict";
+      function f(a, a) {}
+  `), SyntaxError);
+})();
+
+// Test that errors in lazy functions are reported.
+(function() {
+  assertThrows(() => run(`
+      function ok() {}
+      function broken() { return ); }
+  `), SyntaxError);
+  assertThrows(() => run(`
+      function f() { let x; let x; }
+  `), SyntaxError);
+  assertThrows(() => run(`
+      function f() { function g() { return this.#x; } }
+  `), SyntaxError);
+})();
+
+// Test that the source of preparsed functions is kept.
+(function() {
+  const source = "function toStringTest(a, /* b */ c) { return `}`; }";
+  const f = run(source + "\ntoStringTest;");
+  assertEquals(source, f.toString());
+  assertEquals("}", f());
+})();
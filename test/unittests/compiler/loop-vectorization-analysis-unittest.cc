@@ -0,0 +1,168 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorization-analysis.h"
+#include "src/compiler/graph-visualizer.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVectorizationAnalysisTest : public GraphTest {
+ public:
+  LoopVectorizationAnalysisTest()
+      : GraphTest(6), machine_(zone()), simplified_(zone()) {}
+  ~LoopVectorizationAnalysisTest() override = default;
+
+ protected:
+  enum ArrayKind { kDistinctArrays, kSameArray, kSameBufferDistinctBase };
+  enum IndexKind { kInductionIndex, kShiftedIndex };
+  enum ConditionKind { kBelowBound, kAboveBound };
+
+  MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds the lowered graph for
+  //
+  //   for (let i = 0; i < n; ++i) out[index] = in[index] * factor;
+  //
+  // where {out} and {in} are typed arrays with element type {type}. With
+  // {kAboveBound} the loop condition is {n < i} instead.
+  void BuildElementwiseLoop(ExternalArrayType type, ArrayKind arrays,
+                            IndexKind index_kind, double factor = 2.0,
+                            ConditionKind condition = kBelowBound) {
+    Node* in = Parameter(0);
+    Node* out = arrays == kDistinctArrays ? Parameter(1) : in;
+    Node* in_base = Parameter(2);
+    Node* out_base = arrays == kSameBufferDistinctBase ? Parameter(5) : in_base;
+    Node* external = Parameter(3);
+    Node* n = Parameter(4);
+
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* zero = Int32Constant(0);
+    Node* phi = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kWord32, 2), zero, zero, loop);
+    Node* index = phi;
+    if (index_kind == kShiftedIndex) {
+      index = graph()->NewNode(machine()->Int32Add(), phi, Int32Constant(1));
+    }
+    Node* load =
+        graph()->NewNode(simplified()->LoadTypedElement(type), in, in_base,
+                         external, index, effect_phi, loop);
+    Node* value = graph()->NewNode(
+        machine()->Float64Mul(),
+        graph()->NewNode(machine()->ChangeFloat32ToFloat64(), load),
+        Float64Constant(factor));
+    value = graph()->NewNode(machine()->TruncateFloat64ToFloat32(), value);
+    Node* store =
+        graph()->NewNode(simplified()->StoreTypedElement(type), out,
+                         out_base, external, index, value, load, loop);
+    Node* add = graph()->NewNode(machine()->Int32Add(), phi, Int32Constant(1));
+    Node* cond = condition == kBelowBound
+                     ? graph()->NewNode(machine()->Int32LessThan(), add, n)
+                     : graph()->NewNode(machine()->Int32LessThan(), n, add);
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+
+    loop->ReplaceInput(1, if_true);
+    effect_phi->ReplaceInput(1, store);
+    phi->ReplaceInput(1, add);
+
+    Node* ret = graph()->NewNode(common()->Return(), zero, zero, effect_phi,
+                                 if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  const ZoneVector<LoopVectorizationAnalysis::Candidate>& Analyze() {
+    if (FLAG_trace_turbo_graph) {
+      StdoutStream{} << AsRPO(*graph());
+    }
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), zone());
+    analysis_ = new (zone())
+        LoopVectorizationAnalysis(graph(), loop_tree, zone());
+    analysis_->Run();
+    return analysis_->candidates();
+  }
+
+ private:
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+  LoopVectorizationAnalysis* analysis_ = nullptr;
+};
+
+TEST_F(LoopVectorizationAnalysisTest, LanesFor) {
+  EXPECT_EQ(16, LoopVectorizationAnalysis::LanesFor(kExternalUint8Array));
+  EXPECT_EQ(8, LoopVectorizationAnalysis::LanesFor(kExternalInt16Array));
+  EXPECT_EQ(4, LoopVectorizationAnalysis::LanesFor(kExternalInt32Array));
+  EXPECT_EQ(4, LoopVectorizationAnalysis::LanesFor(kExternalFloat32Array));
+  EXPECT_EQ(0, LoopVectorizationAnalysis::LanesFor(kExternalFloat64Array));
+  EXPECT_EQ(0,
+            LoopVectorizationAnalysis::LanesFor(kExternalUint8ClampedArray));
+}
+
+TEST_F(LoopVectorizationAnalysisTest, ElementwiseFloat32Loop) {
+  BuildElementwiseLoop(kExternalFloat32Array, kDistinctArrays,
+                       kInductionIndex);
+  const auto& candidates = Analyze();
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_EQ(kExternalFloat32Array, candidates[0].element_type);
+  EXPECT_EQ(4, candidates[0].lanes);
+  EXPECT_EQ(1, candidates[0].loads);
+  EXPECT_EQ(1, candidates[0].stores);
+  EXPECT_EQ(0, candidates[0].reductions);
+  EXPECT_TRUE(candidates[0].needs_alias_check);
+}
+
+TEST_F(LoopVectorizationAnalysisTest, InPlaceLoopNeedsNoAliasCheck) {
+  BuildElementwiseLoop(kExternalFloat32Array, kSameArray, kInductionIndex);
+  const auto& candidates = Analyze();
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_FALSE(candidates[0].needs_alias_check);
+}
+
+TEST_F(LoopVectorizationAnalysisTest, DistinctBaseNeedsAliasCheck) {
+  BuildElementwiseLoop(kExternalFloat32Array, kSameBufferDistinctBase,
+                       kInductionIndex);
+  const auto& candidates = Analyze();
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_TRUE(candidates[0].needs_alias_check);
+}
+
+TEST_F(LoopVectorizationAnalysisTest, Float64ConstantIsNotVectorizable) {
+  // Multiplying by the float64 0.1 rounds differently than multiplying by
+  // its float32 approximation.
+  BuildElementwiseLoop(kExternalFloat32Array, kDistinctArrays,
+                       kInductionIndex, 0.1);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+TEST_F(LoopVectorizationAnalysisTest, Float64LoopIsNotVectorizable) {
+  BuildElementwiseLoop(kExternalFloat64Array, kDistinctArrays,
+                       kInductionIndex);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+TEST_F(LoopVectorizationAnalysisTest, ShiftedIndexIsNotVectorizable) {
+  BuildElementwiseLoop(kExternalFloat32Array, kDistinctArrays, kShiftedIndex);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+TEST_F(LoopVectorizationAnalysisTest, LowerBoundIsNotVectorizable) {
+  // The trip count of the loop is not bounded by {n}.
+  BuildElementwiseLoop(kExternalFloat32Array, kDistinctArrays,
+                       kInductionIndex, 2.0, kAboveBound);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
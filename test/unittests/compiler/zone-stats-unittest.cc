@@ -155,6 +155,32 @@ TEST_F(ZoneStatsTest, SimpleAllocationLoop) {
   ExpectForPool(0, max_loop_allocation, total_allocated);
 }
 
+TEST_F(ZoneStatsTest, PeakPhase) {
+  ZoneStats::Scope graph_scope(zone_stats(), ZONE_NAME);
+  size_t graph_allocated = Allocate(graph_scope.zone());
+  EXPECT_EQ(nullptr, zone_stats()->peak_phase_name());
+  EXPECT_EQ(0u, zone_stats()->peak_phase_bytes());
+
+  size_t big_phase_allocated = 0;
+  {
+    ZoneStats::Scope temp_scope(zone_stats(), ZONE_NAME);
+    for (int i = 0; i < 20; ++i) {
+      big_phase_allocated += Allocate(temp_scope.zone());
+    }
+    zone_stats()->RecordPhase("big phase");
+  }
+  {
+    ZoneStats::Scope temp_scope(zone_stats(), ZONE_NAME);
+    Allocate(temp_scope.zone());
+    zone_stats()->RecordPhase("small phase");
+  }
+  EXPECT_STREQ("big phase", zone_stats()->peak_phase_name());
+  EXPECT_EQ(graph_allocated + big_phase_allocated,
+            zone_stats()->peak_phase_bytes());
+  EXPECT_EQ(graph_allocated + big_phase_allocated,
+            zone_stats()->GetMaxAllocatedBytes());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
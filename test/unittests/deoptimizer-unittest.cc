@@ -0,0 +1,89 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer.h"
+#include "src/objects-inl.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+
+using TranslationBufferTest = TestWithIsolateAndZone;
+
+TEST_F(TranslationBufferTest, DeduplicateIdenticalTranslations) {
+  TranslationBuffer buffer(zone());
+
+  int first = buffer.CurrentIndex();
+  buffer.Add(Translation::BEGIN);
+  buffer.Add(1);
+  buffer.Add(-200);
+  EXPECT_EQ(first, buffer.Deduplicate(first));
+  int size = buffer.CurrentIndex();
+
+  int second = buffer.CurrentIndex();
+  buffer.Add(Translation::BEGIN);
+  buffer.Add(1);
+  buffer.Add(-200);
+  EXPECT_EQ(first, buffer.Deduplicate(second));
+  EXPECT_EQ(size, buffer.CurrentIndex());
+
+  int third = buffer.CurrentIndex();
+  buffer.Add(Translation::BEGIN);
+  buffer.Add(2);
+  buffer.Add(-200);
+  EXPECT_EQ(third, buffer.Deduplicate(third));
+  EXPECT_LT(size, buffer.CurrentIndex());
+
+  Handle<ByteArray> array = buffer.CreateByteArray(isolate()->factory());
+  EXPECT_EQ(buffer.CurrentIndex(), array->length());
+  TranslationIterator it(*array, buffer.IndexInByteArray(third));
+  EXPECT_EQ(Translation::BEGIN, it.Next());
+  EXPECT_EQ(2, it.Next());
+  EXPECT_EQ(-200, it.Next());
+  EXPECT_FALSE(it.HasNext());
+}
+
+TEST_F(TranslationBufferTest, DoNotDeduplicatePrefixes) {
+  TranslationBuffer buffer(zone());
+
+  buffer.Add(Translation::BEGIN);
+  buffer.Add(1);
+  buffer.Add(2);
+  EXPECT_EQ(0, buffer.Deduplicate(0));
+
+  int second = buffer.CurrentIndex();
+  buffer.Add(Translation::BEGIN);
+  buffer.Add(1);
+  EXPECT_EQ(second, buffer.Deduplicate(second));
+}
+
+TEST_F(TranslationBufferTest, ReferenceSharedPrefixes) {
+  TranslationBuffer buffer(zone());
+  const int kSharedValues = 20;
+  int indices[3];
+  for (int i = 0; i < 3; i++) {
+    indices[i] = buffer.CurrentIndex();
+    buffer.Add(Translation::BEGIN);
+    for (int j = 0; j < kSharedValues; j++) buffer.Add(1000 + j);
+    buffer.Add(-i);
+    EXPECT_EQ(indices[i], buffer.Deduplicate(indices[i]));
+  }
+
+  // The second and third translation are a three byte reference to the values
+  // they share with the first one, followed by their last value.
+  Handle<ByteArray> array = buffer.CreateByteArray(isolate()->factory());
+  EXPECT_EQ(indices[1] + 2 * 4, array->length());
+  for (int i = 0; i < 3; i++) {
+    TranslationIterator it(*array, buffer.IndexInByteArray(indices[i]));
+    EXPECT_EQ(Translation::BEGIN, it.Next());
+    for (int j = 0; j < kSharedValues; j++) EXPECT_EQ(1000 + j, it.Next());
+    EXPECT_EQ(-i, it.Next());
+    // Reading on gets to the start of the next translation.
+    EXPECT_EQ(i < 2, it.HasNext());
+    if (i < 2) EXPECT_EQ(Translation::BEGIN, it.Next());
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
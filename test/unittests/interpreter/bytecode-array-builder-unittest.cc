@@ -469,6 +469,13 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   // Type Information for DevTools is turned on.
   scorecard[Bytecodes::ToByte(Bytecode::kCollectTypeProfile)] = 1;
 
+  // Short Star bytecodes are only emitted with --ignition-short-star, which
+  // is tested separately below.
+#define MARK_SHORT_STAR(Name, ...) \
+  scorecard[Bytecodes::ToByte(Bytecode::k##Name)] = 1;
+  SHORT_STAR_BYTECODE_LIST(MARK_SHORT_STAR)
+#undef MARK_SHORT_STAR
+
   // Check return occurs at the end and only once in the BytecodeArray.
   CHECK_EQ(final_bytecode, Bytecode::kReturn);
   CHECK_EQ(scorecard[Bytecodes::ToByte(final_bytecode)], 1);
@@ -510,6 +517,36 @@ TEST_F(BytecodeArrayBuilderTest, FrameSizesLookGood) {
 }
 
 
+TEST_F(BytecodeArrayBuilderTest, ShortStar) {
+  SaveFlags saved_flags;
+  FLAG_ignition_short_star = true;
+  FLAG_ignition_reo = false;
+
+  const int kLocals = Bytecodes::kShortStarCount + 2;
+  BytecodeArrayBuilder builder(zone(), 1, kLocals);
+  for (int i = 0; i < kLocals; ++i) {
+    builder.LoadLiteral(Smi::FromInt(i + 1)).StoreAccumulatorInRegister(
+        Register(i));
+  }
+  builder.Return();
+
+  BytecodeArrayIterator iterator(builder.ToBytecodeArray(isolate()));
+  for (int i = 0; i < kLocals; ++i) {
+    EXPECT_EQ(Bytecode::kLdaSmi, iterator.current_bytecode());
+    iterator.Advance();
+    if (i < Bytecodes::kShortStarCount) {
+      EXPECT_EQ(Bytecodes::GetShortStarForRegisterIndex(i),
+                iterator.current_bytecode());
+      EXPECT_EQ(1, iterator.current_bytecode_size());
+    } else {
+      EXPECT_EQ(Bytecode::kStar, iterator.current_bytecode());
+    }
+    EXPECT_EQ(i, iterator.GetStarTargetRegister().index());
+    iterator.Advance();
+  }
+  EXPECT_EQ(Bytecode::kReturn, iterator.current_bytecode());
+}
+
 TEST_F(BytecodeArrayBuilderTest, RegisterValues) {
   int index = 1;
 
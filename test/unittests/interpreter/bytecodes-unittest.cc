@@ -319,6 +319,28 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef TEST_BYTECODE
 }
 
+TEST(Bytecodes, IsShortStar) {
+#define TEST_BYTECODE(Name, ...)                                             \
+  if (IN_BYTECODE_LIST(Bytecode::k##Name, SHORT_STAR_BYTECODE_LIST)) {       \
+    EXPECT_TRUE(Bytecodes::IsShortStar(Bytecode::k##Name));                  \
+    EXPECT_EQ(1, Bytecodes::Size(Bytecode::k##Name, OperandScale::kSingle)); \
+  } else {                                                                   \
+    EXPECT_FALSE(Bytecodes::IsShortStar(Bytecode::k##Name));                 \
+  }
+
+  BYTECODE_LIST(TEST_BYTECODE)
+#undef TEST_BYTECODE
+
+  for (int i = 0; i < Bytecodes::kShortStarCount; ++i) {
+    Bytecode short_star = Bytecodes::GetShortStarForRegisterIndex(i);
+    EXPECT_EQ(i, Bytecodes::GetShortStarRegisterIndex(short_star));
+  }
+  EXPECT_EQ(Bytecode::kStar0, Bytecodes::GetShortStarForRegisterIndex(0));
+  EXPECT_EQ(Bytecode::kStar15, Bytecodes::GetShortStarForRegisterIndex(15));
+  EXPECT_TRUE(Bytecodes::IsAnyStar(Bytecode::kStar));
+  EXPECT_FALSE(Bytecodes::IsShortStar(Bytecode::kStar));
+}
+
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 